@@ -45,6 +45,7 @@ set(BS_BANSHEECORE_INC_PHYSICS
 
 set(BS_BANSHEECORE_INC_CORETHREAD
 	"Include/BsCoreThreadAccessor.h"
+	"Include/BsCommandRingBuffer.h"
 	"Include/BsCoreThread.h"
 	"Include/BsCoreObjectManager.h"
 	"Include/BsCoreObject.h"
@@ -69,9 +70,11 @@ set(BS_BANSHEECORE_INC_SCENE
 	"Include/BsGameObjectManager.h"
 	"Include/BsSceneObject.h"
 	"Include/BsCoreSceneManager.h"
+	"Include/BsTransformHierarchy.h"
 	"Include/BsPrefab.h"
 	"Include/BsPrefabDiff.h"
 	"Include/BsPrefabUtility.h"
+	"Include/BsPrefabPool.h"
 )
 
 set(BS_BANSHEECORE_INC_INPUT
@@ -164,6 +167,7 @@ set(BS_BANSHEECORE_SRC_CORETHREAD
 	"Source/BsCoreObjectManager.cpp"
 	"Source/BsCoreThread.cpp"
 	"Source/BsCoreThreadAccessor.cpp"
+	"Source/BsCommandRingBuffer.cpp"
 	"Source/BsCoreObjectCore.cpp"
 )
 
@@ -191,6 +195,7 @@ set(BS_BANSHEECORE_INC_RESOURCES
 	"Include/BsTexture.h"
 	"Include/BsResources.h"
 	"Include/BsResourceManifest.h"
+	"Include/BsResourcePackage.h"
 	"Include/BsResourceHandle.h"
 	"Include/BsResource.h"
 	"Include/BsPixelData.h"
@@ -222,6 +227,7 @@ set(BS_BANSHEECORE_INC_TEXT
 	"Include/BsFontImportOptions.h"
 	"Include/BsFontDesc.h"
 	"Include/BsFont.h"
+	"Include/BsDynamicFontAtlas.h"
 )
 
 set(BS_BANSHEECORE_SRC_PROFILING
@@ -355,6 +361,7 @@ set(BS_BANSHEECORE_SRC_RESOURCES
 	"Source/BsResource.cpp"
 	"Source/BsResourceHandle.cpp"
 	"Source/BsResourceManifest.cpp"
+	"Source/BsResourcePackage.cpp"
 	"Source/BsResources.cpp"
 	"Source/BsTexture.cpp"
 	"Source/BsTextureManager.cpp"
@@ -395,6 +402,7 @@ set(BS_BANSHEECORE_SRC_TEXT
 	"Source/BsFontImportOptions.cpp"
 	"Source/BsFontManager.cpp"
 	"Source/BsTextData.cpp"
+	"Source/BsDynamicFontAtlas.cpp"
 )
 
 set(BS_BANSHEECORE_SRC_RENDERAPI
@@ -469,9 +477,11 @@ set(BS_BANSHEECORE_SRC_SCENE
 	"Source/BsGameObjectManager.cpp"
 	"Source/BsSceneObject.cpp"
 	"Source/BsCoreSceneManager.cpp"
+	"Source/BsTransformHierarchy.cpp"
 	"Source/BsPrefab.cpp"
 	"Source/BsPrefabDiff.cpp"
 	"Source/BsPrefabUtility.cpp"
+	"Source/BsPrefabPool.cpp"
 )
 
 set(BS_BANSHEECORE_INC_AUDIO
@@ -482,6 +492,7 @@ set(BS_BANSHEECORE_INC_AUDIO
 	"Include/BsAudioClipImportOptions.h"
 	"Include/BsAudioUtility.h"
 	"Include/BsAudioManager.h"
+	"Include/BsAudioMixer.h"
 )
 
 set(BS_BANSHEECORE_SRC_AUDIO
@@ -492,6 +503,7 @@ set(BS_BANSHEECORE_SRC_AUDIO
 	"Source/BsAudioClipImportOptions.cpp"
 	"Source/BsAudioUtility.cpp"
 	"Source/BsAudioManager.cpp"
+	"Source/BsAudioMixer.cpp"
 )
 
 source_group("Header Files\\Components" FILES ${BS_BANSHEECORE_INC_COMPONENTS})
@@ -0,0 +1,212 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsVector3.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Audio-Internal
+	 *  @{
+	 */
+
+	/** Destination that audio mixed by AudioMixer is written to. */
+	class BS_CORE_EXPORT AudioSink
+	{
+	public:
+		virtual ~AudioSink() { }
+
+		/**
+		 * Writes a block of mixed audio.
+		 *
+		 * @param[in]	samples		Interleaved stereo samples in [-1, 1] range. Contains @p numFrames * 2 values.
+		 * @param[in]	numFrames	Number of samples per channel.
+		 */
+		virtual void write(const float* samples, UINT32 numFrames) = 0;
+	};
+
+	/** Audio sink that discards all audio written to it. Useful for running the mixer without an output device. */
+	class BS_CORE_EXPORT NullAudioSink : public AudioSink
+	{
+	public:
+		NullAudioSink();
+
+		/** @copydoc AudioSink::write */
+		void write(const float* samples, UINT32 numFrames) override;
+
+		/** Returns the total number of frames written to the sink. */
+		UINT64 getNumFrames() const { return mNumFrames; }
+
+	private:
+		UINT64 mNumFrames;
+	};
+
+	/** Audio sink that records all audio written to it into a 16-bit stereo WAVE file. */
+	class BS_CORE_EXPORT WaveFileAudioSink : public AudioSink
+	{
+	public:
+		/**
+		 * Creates a new sink writing to the specified file, overwriting it if it exists.
+		 *
+		 * @param[in]	path		Path to the output file.
+		 * @param[in]	sampleRate	Sample rate of the audio that will be written to the sink.
+		 */
+		WaveFileAudioSink(const Path& path, UINT32 sampleRate);
+		~WaveFileAudioSink();
+
+		/** @copydoc AudioSink::write */
+		void write(const float* samples, UINT32 numFrames) override;
+
+	private:
+		/** Writes the WAVE header, describing all data written so far. */
+		void writeHeader();
+
+		SPtr<DataStream> mStream;
+		UINT32 mSampleRate;
+		UINT32 mNumFrames;
+	};
+
+	/** Sound played through the AudioMixer. */
+	struct AudioMixerVoice
+	{
+		const float* samples = nullptr; /**< Samples to play, in [-1, 1] range. Channels are interleaved. */
+		UINT32 numFrames = 0; /**< Number of samples per channel. */
+		UINT32 numChannels = 1; /**< Number of channels in the sample data. Only mono and stereo are supported. */
+		UINT32 sampleRate = 44100; /**< Number of samples per second, per channel. */
+
+		Vector3 position = Vector3::ZERO; /**< World position of the voice. Only relevant for 3D voices. */
+		float volume = 1.0f; /**< Volume in [0, 1] range. */
+		float pitch = 1.0f; /**< Playback speed multiplier. */
+		float minDistance = 1.0f; /**< Distance at which attenuation starts. Only relevant for 3D voices. */
+		float attenuation = 1.0f; /**< Rate at which the volume drops with distance. Only relevant for 3D voices. */
+		INT32 priority = 0; /**< Voices with higher priority are kept audible before voices with lower priority. */
+		bool is3D = true; /**< Determines is the voice attenuated and panned according to the listener position. */
+		bool loop = false; /**< Determines does playback restart once the voice reaches the end of its samples. */
+
+		/** Current playback position, in frames. Advanced by the mixer. */
+		double playPosition = 0.0;
+
+		/** Determines is the voice playing. Cleared by the mixer once a non-looping voice reaches the end. */
+		bool playing = false;
+
+		/** Set by the mixer to true if the voice was skipped during the last mixed block, false if it was heard. */
+		bool isVirtual = true;
+
+		/** Channel gains used during the last mixed block. Used by the mixer for smoothing gain changes. */
+		float gains[2] = { 0.0f, 0.0f };
+	};
+
+	/** Position and orientation of a listener voices are mixed for. */
+	struct AudioMixerListener
+	{
+		Vector3 position = Vector3::ZERO;
+		Vector3 direction = -Vector3::UNIT_Z;
+		Vector3 up = Vector3::UNIT_Y;
+	};
+
+	/**
+	 * Mixes a set of voices into a stereo output on the CPU, and writes the result to an AudioSink. Voices are resampled
+	 * to the output sample rate, attenuated by distance and panned relative to the listener.
+	 *
+	 * Only a limited number of voices is mixed at once. Voices exceeding the limit, or too quiet to be heard, become
+	 * virtual: they are faded out over one block, after which their playback position keeps advancing but their samples
+	 * are never read. This way the cost of mixing is determined by the voice limit, rather than by the number of playing
+	 * voices.
+	 */
+	class BS_CORE_EXPORT AudioMixer
+	{
+	public:
+		/** Number of frames mixed at once. Voices are re-evaluated and virtualized once per block. */
+		static const UINT32 BLOCK_SIZE = 256;
+
+		/**
+		 * Creates a new mixer.
+		 *
+		 * @param[in]	sampleRate	Sample rate of the mixed output.
+		 * @param[in]	maxVoices	Maximum number of voices that can be heard at once.
+		 */
+		AudioMixer(UINT32 sampleRate = 48000, UINT32 maxVoices = 64);
+
+		/** Sets the sink mixed audio is written to. If null, the mixed audio is discarded. */
+		void setSink(const SPtr<AudioSink>& sink) { mSink = sink; }
+
+		/** Returns the sink mixed audio is written to. */
+		const SPtr<AudioSink>& getSink() const { return mSink; }
+
+		/** Sets the maximum number of voices that can be heard at once. */
+		void setMaxVoices(UINT32 maxVoices) { mMaxVoices = maxVoices; }
+
+		/** Returns the maximum number of voices that can be heard at once. */
+		UINT32 getMaxVoices() const { return mMaxVoices; }
+
+		/** Sets the volume all voices are scaled with, in [0, 1] range. */
+		void setVolume(float volume);
+
+		/** Returns the volume all voices are scaled with, in [0, 1] range. */
+		float getVolume() const { return mVolume; }
+
+		/** Returns the sample rate of the mixed output. */
+		UINT32 getSampleRate() const { return mSampleRate; }
+
+		/** Returns the number of voices that were heard during the most recently mixed block. */
+		UINT32 getNumAudibleVoices() const { return mNumAudibleVoices; }
+
+		/**
+		 * Mixes the provided voices and writes the result to the sink. Playback position of every playing voice is
+		 * advanced, whether it was heard or not.
+		 *
+		 * @param[in]	voices			Voices to mix. Voices that aren't playing are ignored.
+		 * @param[in]	numVoices		Number of entries in @p voices.
+		 * @param[in]	listeners		Listeners to mix 3D voices for. Each voice is heard through the listener that hears
+		 *								it the loudest. If none are provided a listener at the origin is assumed.
+		 * @param[in]	numListeners	Number of entries in @p listeners.
+		 * @param[in]	numFrames		Number of frames to mix.
+		 */
+		void mix(AudioMixerVoice* const* voices, UINT32 numVoices, const AudioMixerListener* listeners,
+			UINT32 numListeners, UINT32 numFrames);
+
+	private:
+		/** Voice that is a candidate to be heard during the current block. */
+		struct AudibleVoice
+		{
+			AudioMixerVoice* voice;
+			float gains[2];
+			float loudness;
+		};
+
+		/** Voices quieter than this are never heard. */
+		static const float MIN_AUDIBLE_GAIN;
+
+		/** Mixes a single block of at most BLOCK_SIZE frames. */
+		void mixBlock(AudioMixerVoice* const* voices, UINT32 numVoices, const AudioMixerListener* listeners,
+			UINT32 numListeners, UINT32 numFrames);
+
+		/** Calculates the per-channel gains of the voice, as heard by the provided listener. */
+		static void calculateGains(const AudioMixerVoice& voice, const AudioMixerListener& listener, float* gains);
+
+		/** Resamples the voice and adds it to the mix buffers, linearly ramping from the last used gains to new ones. */
+		void mixVoice(AudioMixerVoice& voice, const float* gains, UINT32 numFrames);
+
+		/**
+		 * Marks the voice as virtual and advances its playback position. If the voice was heard during the previous block
+		 * it is faded out over this block first.
+		 */
+		void virtualize(AudioMixerVoice& voice, UINT32 numFrames);
+
+		/** Advances the voice's playback position by the provided number of output frames. */
+		void advance(AudioMixerVoice& voice, UINT32 numFrames) const;
+
+		UINT32 mSampleRate;
+		UINT32 mMaxVoices;
+		float mVolume;
+		SPtr<AudioSink> mSink;
+		UINT32 mNumAudibleVoices;
+
+		Vector<AudibleVoice> mAudibleVoices;
+		float mMixBuffers[2][BLOCK_SIZE];
+		float mOutputBuffer[BLOCK_SIZE * 2];
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include <atomic>
+
+namespace BansheeEngine
+{
+	/** @addtogroup CoreThread-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Fixed capacity command queue that records commands into a preallocated block of memory, used as a ring buffer.
+	 * Commands are arbitrary callables constructed directly in the buffer, so queuing a command performs no heap 
+	 * allocations (unless the callable is very large, in which case it is stored on the heap instead).
+	 *
+	 * Commands are recorded by a single producer thread and executed by a single consumer thread. Producer makes recorded
+	 * commands available by calling submit(), after which the consumer can retrieve the submitted position through
+	 * getSubmitPosition() and call playback() with it. No locking is performed by the buffer itself.
+	 */
+	class BS_CORE_EXPORT CommandRingBuffer
+	{
+		/** Header preceding each command in the buffer. */
+		struct CommandHeader
+		{
+			/** 
+			 * Executes (if @p execute is true) and destroys the command stored right after the header. If null the header 
+			 * marks the end of usable data and the rest of the buffer should be skipped.
+			 */
+			void(*invoke)(void* data, bool execute);
+
+			/** Total size of the command in bytes, including the header and any padding. */
+			UINT32 size;
+		};
+
+		/** Alignment of every command in the buffer. */
+		static const UINT32 ALIGNMENT = 16;
+
+		/** Size of the command header, including padding required for the command data to be aligned. */
+		static const UINT32 HEADER_SIZE = (sizeof(CommandHeader) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+	public:
+		/** 
+		 * Constructs a new ring buffer.
+		 *
+		 * @param[in]	capacity	Size of the buffer in bytes. Determines how many commands can be queued before the
+		 *							consumer needs to catch up.
+		 */
+		CommandRingBuffer(UINT32 capacity);
+		~CommandRingBuffer();
+
+		/**
+		 * Attempts to record a new command. 
+		 *
+		 * @param[in]	callable	Callable object that takes no parameters. It will be executed and destroyed by the
+		 *							consumer thread.
+		 * @return					True if the command was recorded, false if there is not enough free space in the
+		 *							buffer. In which case the callable is left untouched.
+		 *
+		 * @note	Producer thread only.
+		 */
+		template<class T>
+		bool tryQueue(T&& callable)
+		{
+			typedef typename std::decay<T>::type CallableType;
+
+			if(sizeof(CallableType) > mMaxInlineSize || alignof(CallableType) > ALIGNMENT)
+			{
+				// Too large to store directly, store a pointer to a heap allocated copy instead
+				UINT8* data = allocate(HEADER_SIZE + sizeof(CallableType*));
+				if (data == nullptr)
+					return false;
+
+				CallableType** ptr = (CallableType**)data;
+				*ptr = bs_new<CallableType>(std::forward<T>(callable));
+
+				commit(data, &invokeIndirect<CallableType>);
+				return true;
+			}
+
+			UINT8* data = allocate(HEADER_SIZE + sizeof(CallableType));
+			if (data == nullptr)
+				return false;
+
+			new (data) CallableType(std::forward<T>(callable));
+
+			commit(data, &invoke<CallableType>);
+			return true;
+		}
+
+		/**
+		 * Makes all commands recorded so far available to the consumer. 
+		 *
+		 * @return	Position up to which the consumer may execute commands. Provide it to playback().
+		 *
+		 * @note	Producer thread only.
+		 */
+		UINT64 submit();
+
+		/** 
+		 * Returns the position up to which the producer submitted commands. 
+		 *
+		 * @note	Consumer thread only.
+		 */
+		UINT64 getSubmitPosition() const { return mPublishedPos.load(); }
+
+		/** 
+		 * Returns the position up to which the consumer executed commands. 
+		 *
+		 * @note	Consumer thread only.
+		 */
+		UINT64 getPlaybackPosition() const { return mReadPos.load(std::memory_order_relaxed); }
+
+		/** 
+		 * Destroys all commands that were recorded but not yet submitted, without executing them. 
+		 *
+		 * @note	Producer thread only.
+		 */
+		void cancelAll();
+
+		/** 
+		 * Returns true if there are recorded commands that have not yet been submitted. 
+		 *
+		 * @note	Producer thread only.
+		 */
+		bool hasPending() const { return mWritePos != mSubmitPos; }
+
+		/**
+		 * Blocks until the consumer executes at least one more command, or until it consumes everything submitted so far.
+		 * Used when the buffer is full.
+		 *
+		 * @note	Producer thread only.
+		 */
+		void waitForSpace();
+
+		/**
+		 * Executes and destroys all commands up to the provided position, in the order they were recorded.
+		 *
+		 * @param[in]	end		Position returned by submit().
+		 *
+		 * @note	Consumer thread only.
+		 */
+		void playback(UINT64 end);
+
+	private:
+		/**
+		 * Reserves a block of memory for a new command with the provided total size (including the header). Returns a 
+		 * pointer to the memory right after the header, or null if there's not enough space.
+		 */
+		UINT8* allocate(UINT32 size);
+
+		/** Finalizes a command previously reserved with allocate(), making it part of the current (unsubmitted) segment. */
+		void commit(UINT8* data, void(*invokeFunc)(void*, bool));
+
+		/** Destroys commands in the provided range without executing them. */
+		void destroyRange(UINT64 start, UINT64 end);
+
+		/**	Executes and/or destroys a callable stored directly in the buffer. */
+		template<class T>
+		static void invoke(void* data, bool execute)
+		{
+			T* callable = (T*)data;
+
+			if (execute)
+				(*callable)();
+
+			callable->~T();
+		}
+
+		/**	Executes and/or destroys a callable stored on the heap. */
+		template<class T>
+		static void invokeIndirect(void* data, bool execute)
+		{
+			T* callable = *(T**)data;
+
+			if (execute)
+				(*callable)();
+
+			bs_delete(callable);
+		}
+
+		UINT8* mBuffer;
+		UINT32 mCapacity;
+		UINT32 mMaxInlineSize;
+
+		UINT64 mWritePos; /**< Producer only. Position at which the next command will be recorded. */
+		UINT64 mSubmitPos; /**< Producer only. Position up to which the commands were submitted. */
+		UINT64 mPendingSize; /**< Producer only. Size of the most recent reservation made by allocate(). */
+		std::atomic<UINT64> mPublishedPos; /**< Written by producer. Position up to which commands were submitted. */
+		std::atomic<UINT64> mReadPos; /**< Written by consumer. Position up to which commands were executed. */
+	};
+
+	/** @} */
+}
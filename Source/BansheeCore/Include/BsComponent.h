@@ -27,6 +27,14 @@ namespace BansheeEngine
 
 		/**
 		 * Called once per frame on all components.
+		 *
+		 * Components are updated one type at a time, with types ordered by when their first component was enabled. 
+		 * Components of the same type are updated in the order they were enabled in. Since scene objects enable their
+		 * components while being added to the scene, parents are updated before their children for components that stay
+		 * enabled, but a component that gets disabled and enabled again moves to the end of its type. Components of
+		 * different types are not interleaved by scene object, so update() must not rely on a component of another type
+		 * having been updated first. Components enabled during the update might not be updated until the next frame. When
+		 * parallel updates are enabled, types marked with setThreadSafeUpdate() are updated after all the others.
 		 * 			
 		 * @note	Internal method.
 		 */
@@ -61,6 +69,7 @@ namespace BansheeEngine
 	protected:
 		friend class SceneObject;
 		friend class SceneObjectRTTI;
+		friend class CoreSceneManager;
 
 		Component(const HSceneObject& parent);
 		virtual ~Component();
@@ -92,6 +101,17 @@ namespace BansheeEngine
 		/** Checks whether the component wants to received the specified transform changed message. */
 		bool supportsNotify(TransformChangedFlags flags) const { return (mNotifyFlags & flags) != 0; }
 
+		/**
+		 * Marks the component's update() method as safe to call from any thread, in parallel with update() of other
+		 * components of the same type. Such update() must not modify the scene (e.g. create, destroy, enable or disable
+		 * objects) and must not access other components. Should be set before the component is enabled, usually in the
+		 * constructor.
+		 */
+		void setThreadSafeUpdate(bool threadSafe) { mThreadSafeUpdate = threadSafe; }
+
+		/** Checks can update() of this component be called in parallel. See setThreadSafeUpdate(). */
+		bool isThreadSafeUpdate() const { return mThreadSafeUpdate; }
+
 		/**
 		 * Destroys this component.
 		 *
@@ -108,10 +128,14 @@ namespace BansheeEngine
 	protected:
 		HComponent mThisHandle;
 		TransformChangedFlags mNotifyFlags;
+		bool mThreadSafeUpdate;
 
 	private:
 		HSceneObject mParent;
 
+		UINT32 mUpdateGroup;
+		UINT32 mUpdateIdx;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -121,7 +145,7 @@ namespace BansheeEngine
 		RTTITypeBase* getRTTI() const override;
 
 	protected:
-		Component() {} // Serialization only
+		Component(); // Serialization only
 	};
 
 	/** @} */
@@ -12,6 +12,14 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
+	/** Statistics about a single CoreObjectManager::syncToCore() call. */
+	struct CoreSyncStats
+	{
+		UINT32 numObjects = 0; /**< Number of objects whose data was transferred to the core thread. */
+		UINT64 numBytes = 0; /**< Total size of the transferred data, in bytes. */
+		UINT32 numWorkers = 0; /**< Number of threads the data was prepared on. */
+	};
+
 	// TODO Low priority - Add debug option that would remember a call stack for each resource initialization,
 	// so when we fail to release one we know which one it is.
 	
@@ -30,16 +38,18 @@ namespace BansheeEngine
 		struct CoreStoredSyncObjData
 		{
 			CoreStoredSyncObjData()
-				:internalId(0)
+				:internalId(0), alloc(nullptr)
 			{ }
 
-			CoreStoredSyncObjData(const SPtr<CoreObjectCore> destObj, UINT64 internalId, const CoreSyncData& syncData)
-				:destinationObj(destObj), syncData(syncData), internalId(internalId)
+			CoreStoredSyncObjData(const SPtr<CoreObjectCore> destObj, UINT64 internalId, const CoreSyncData& syncData,
+				FrameAlloc* alloc)
+				:destinationObj(destObj), syncData(syncData), internalId(internalId), alloc(alloc)
 			{ }
 
 			std::weak_ptr<CoreObjectCore> destinationObj;
 			CoreSyncData syncData;
 			UINT64 internalId;
+			FrameAlloc* alloc;
 		};
 
 		/**
@@ -48,7 +58,6 @@ namespace BansheeEngine
 		 */
 		struct CoreStoredSyncData
 		{
-			FrameAlloc* alloc = nullptr;
 			Vector<CoreStoredSyncObjData> entries;
 		};
 
@@ -97,12 +106,35 @@ namespace BansheeEngine
 		 */
 		void clearDirty();
 
+		/**
+		 * Enables or disables parallel sync. When enabled, syncToCore() prepares the data of dirty objects on multiple 
+		 * worker threads, each allocating from its own frame allocator. Requires CoreObject::syncToCore() implementations
+		 * to only access the data of the object they are called on.
+		 *
+		 * @note	Sim thread only.
+		 */
+		void setParallelSync(bool enabled) { mParallelSync = enabled; }
+
+		/** Checks is parallel sync enabled. See setParallelSync(). */
+		bool getParallelSync() const { return mParallelSync; }
+
+		/** 
+		 * Returns statistics about the most recent syncToCore(CoreAccessor&) call. 
+		 *
+		 * @note	Sim thread only.
+		 */
+		const CoreSyncStats& getSyncStats() const { return mSyncStats; }
+
 	private:
+		/** Minimum number of objects each worker thread needs to sync, when parallel sync is enabled. */
+		static const UINT32 MIN_OBJECTS_PER_WORKER = 64;
+
 		/**
 		 * Stores all syncable data from dirty core objects into memory allocated by the provided allocator. Additional 
 		 * meta-data is stored internally to be used by call to syncUpload().
 		 *
-		 * @param[in]	allocator Allocator to use for allocating memory for stored data.
+		 * @param[in]	allocator Allocator to use for allocating memory for stored data. When parallel sync is enabled
+		 *						  each additional worker thread uses its own allocator.
 		 *
 		 * @note	Sim thread only.
 		 * @note	Must be followed by a call to syncUpload() with the same type.
@@ -134,6 +166,9 @@ namespace BansheeEngine
 		Vector<CoreStoredSyncObjData> mDestroyedSyncData;
 		List<CoreStoredSyncData> mCoreSyncData;
 
+		bool mParallelSync;
+		CoreSyncStats mSyncStats;
+
 		Mutex mObjectsMutex;
 	};
 
@@ -157,6 +157,12 @@
 #define BS_MAX_MULTIPLE_RENDER_TARGETS 8
 #define BS_FORCE_SINGLETHREADED_RENDERING 0
 
+/** 
+ * If non-zero, core thread accessors used by individual threads record their commands into a preallocated lock-free
+ * ring buffer of this size (in bytes), instead of a dynamically allocated command queue.
+ */
+#define BS_CORE_THREAD_RING_BUFFER_SIZE 0
+
 // Windows Settings
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 
@@ -269,6 +275,8 @@ namespace BansheeEngine
 	class GpuProgramImportOptions;
 	class MeshImportOptions;
 	struct FontBitmap;
+	class DynamicFontAtlas;
+	class GlyphRasterizer;
 	class GameObject;
 	class GpuResourceData;
 	struct RenderOperation;
@@ -306,6 +314,7 @@ namespace BansheeEngine
 	class TextureProperties;
 	class IShaderIncludeHandler;
 	class Prefab;
+	class PrefabPool;
 	class PrefabDiff;
 	class RendererMeshData;
 	class LightCore;
@@ -358,6 +367,7 @@ namespace BansheeEngine
 	class Resource;
 	class Resources;
 	class ResourceManifest;
+	class ResourcePackage;
 	class Texture;
 	class Mesh;
 	class MeshBase;
@@ -375,6 +385,7 @@ namespace BansheeEngine
 	class SceneObject;
 	class Component;
 	class SceneManager;
+	class TransformHierarchy;
 	// RTTI
 	class MeshRTTI;
 	// Desc structs
@@ -386,6 +397,7 @@ namespace BansheeEngine
 	struct RENDER_TEXTURE_DESC;
 	struct RENDER_WINDOW_DESC;
 	struct FONT_DESC;
+	struct DYNAMIC_FONT_DESC;
 	struct CHAR_CONTROLLER_DESC;
 	struct JOINT_DESC;
 	struct FIXED_JOINT_DESC;
@@ -501,7 +513,8 @@ namespace BansheeEngine
 		TID_AudioClip = 1111,
 		TID_AudioClipImportOptions = 1112,
 		TID_CAudioListener = 1113,
-		TID_CAudioSource = 1114
+		TID_CAudioSource = 1114,
+		TID_DYNAMIC_FONT_DESC = 1115
 	};
 }
 
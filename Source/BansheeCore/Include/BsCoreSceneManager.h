@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
 #include "BsGameObject.h"
+#include "BsTransformHierarchy.h"
 
 namespace BansheeEngine
 {
@@ -38,9 +39,37 @@ namespace BansheeEngine
 		/** Called every frame. Calls update methods on all scene objects and their components. */
 		virtual void _update();
 
+		/** 
+		 * Calls update() on all active components in the scene. Components are stored in flat arrays grouped by type, 
+		 * and are updated one type at a time. Called automatically by _update(). See Component::update() for the order
+		 * in which components are updated.
+		 */
+		void _updateComponents();
+
+		/**
+		 * Determines should components that have been marked with Component::setThreadSafeUpdate() be updated in parallel,
+		 * on multiple threads. Disabled by default.
+		 */
+		void setParallelComponentUpdate(bool enabled) { mParallelComponentUpdate = enabled; }
+
+		/** Checks are thread safe components updated in parallel. See setParallelComponentUpdate(). */
+		bool getParallelComponentUpdate() const { return mParallelComponentUpdate; }
+
+		/** Notifies the manager that a component in the scene was enabled and should start receiving updates. */
+		void _notifyComponentActivated(Component* component);
+
+		/** Notifies the manager that a component in the scene was disabled or destroyed and should stop receiving updates. */
+		void _notifyComponentDeactivated(Component* component);
+
 		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
 		virtual void _updateCoreObjectTransforms() { }
 
+		/** 
+		 * Returns the optional flat storage for scene object transforms. When enabled, all dirty world transforms are 
+		 * updated in a single pass at the end of _update().
+		 */
+		TransformHierarchy& getTransformHierarchy() { return mTransformHierarchy; }
+
 	protected:
 		friend class SceneObject;
 
@@ -58,7 +87,27 @@ namespace BansheeEngine
 		void registerNewSO(const HSceneObject& node);
 
 	protected:
+		/** Minimum number of components each worker thread needs to update, when updating in parallel. */
+		static const UINT32 MIN_COMPONENTS_PER_TASK = 256;
+
+		/** Active components of a single type. */
+		struct ComponentGroup
+		{
+			UINT32 typeId;
+			bool threadSafe;
+			bool hasRemovedEntries;
+			Vector<Component*> components;
+		};
+
+		/** Removes entries of deactivated components from all component groups, keeping the order of the rest. */
+		void compactComponentGroups();
+
 		HSceneObject mRootNode;
+		TransformHierarchy mTransformHierarchy;
+
+		Vector<ComponentGroup> mComponentGroups;
+		UnorderedMap<UINT64, UINT32> mComponentGroupLookup;
+		bool mParallelComponentUpdate;
 	};
 
 	/**
@@ -49,6 +49,20 @@ namespace BansheeEngine
 			static BS_THREADLOCAL AccessorContainer* current;
 		};
 
+		/** Ring buffer of an accessor, registered with the core thread. */
+		struct RingBufferData
+		{
+			SPtr<CommandRingBuffer> buffer;
+			UINT64 scheduledPos; /**< Position up to which the core thread was scheduled to execute the commands. */
+		};
+
+		/** Range of submitted ring buffer commands, scheduled for execution on the core thread. */
+		struct RingBufferSegment
+		{
+			SPtr<CommandRingBuffer> buffer;
+			UINT64 end;
+		};
+
 public:
 	CoreThread();
 	~CoreThread();
@@ -122,6 +136,26 @@ public:
 	 * @note	Sim thread only.
 	 */
 	FrameAlloc* getFrameAlloc() const;
+
+	/**
+	 * Returns a frame allocator with the same lifetime as the one returned by getFrameAlloc(), but meant to be used by
+	 * a worker thread when preparing core thread data in parallel. Each worker should use an allocator with a unique 
+	 * index. Allocators are created on first use.
+	 *
+	 * @note	Sim thread only. Caller is responsible for setting the allocator's owner thread before handing it off to a
+	 *			worker, and restoring it to the sim thread once the worker is done.
+	 */
+	FrameAlloc* getWorkerFrameAlloc(UINT32 idx);
+
+	/**
+	 * Notifies the core thread that new commands were submitted to an accessor's ring buffer. Doesn't lock unless the
+	 * core thread is idle and needs to be woken up.
+	 *
+	 * @param[in]	blockUntilComplete	If true the thread will be blocked until the submitted commands execute.
+	 *
+	 * @note	Internal method.
+	 */
+	void _notifyRingBufferSubmitted(bool blockUntilComplete);
 private:
 	static const int NUM_FRAME_ALLOCS = 2;
 
@@ -130,6 +164,7 @@ private:
 	 * you should be able to easily add more).
 	 */
 	FrameAlloc* mFrameAllocs[NUM_FRAME_ALLOCS];
+	Vector<FrameAlloc*> mWorkerFrameAllocs[NUM_FRAME_ALLOCS];
 	UINT32 mActiveFrameAlloc;
 
 	static AccessorData mAccessor;
@@ -151,6 +186,13 @@ private:
 
 	CommandQueue<CommandQueueSync>* mCommandQueue;
 
+	/** 
+	 * Ring buffers of all accessors that use them. Buffers of the main accessor are kept last, so worker commands are
+	 * executed first, same as in submitAccessors().
+	 */
+	Vector<RingBufferData> mRingBuffers;
+	std::atomic<bool> mCoreThreadWaiting; /**< True while the core thread is idle, waiting for new commands. */
+
 	UINT32 mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
 	Vector<UINT32> mCommandsCompleted; /**< Completed commands that have notifier callbacks set up */
 
@@ -162,6 +204,18 @@ private:
 	/**	Main worker method of the core thread. Called once thread is started. */
 	void runCoreThread();
 
+	/** Checks are there any submitted ring buffer commands not yet scheduled for execution. Queue mutex must be held. */
+	bool hasUnscheduledRingBufferCommands() const;
+
+	/**
+	 * Schedules all submitted ring buffer commands for execution, by outputting segments that need to be played back. 
+	 * Returns false if there was nothing to schedule. Queue mutex must be held.
+	 */
+	bool scheduleRingBufferCommands(Vector<RingBufferSegment>& segments);
+
+	/** Executes ring buffer commands previously scheduled with scheduleRingBufferCommands(). */
+	static void playbackRingBufferCommands(const Vector<RingBufferSegment>& segments);
+
 	/** Shutdowns the core thread. It will complete all ready commands before shutdown. */
 	void shutdownCoreThread();
 
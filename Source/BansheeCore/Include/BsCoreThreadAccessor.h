@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "BsCommandQueue.h"
+#include "BsCommandRingBuffer.h"
 #include "BsAsyncOp.h"
 
 namespace BansheeEngine
@@ -20,17 +21,50 @@ namespace BansheeEngine
 	class BS_CORE_EXPORT CoreThreadAccessorBase
 	{
 	public:
-		CoreThreadAccessorBase(CommandQueueBase* commandQueue);
+		/**
+		 * Constructor.
+		 *
+		 * @param[in]	commandQueue	Queue to record the commands in. Accessor takes ownership of the queue.
+		 * @param[in]	ringBufferSize	If non-zero, commands will instead be recorded in a preallocated ring buffer of
+		 *								this size (in bytes). This avoids any locking or allocations when queuing
+		 *								commands, but the accessor must only ever be used from a single thread.
+		 */
+		CoreThreadAccessorBase(CommandQueueBase* commandQueue, UINT32 ringBufferSize = 0);
 		virtual ~CoreThreadAccessorBase();
 
 		/**
 		 * Queues a new generic command that will be added to the command queue. Returns an async operation object that you 
 		 * may use to check if the operation has finished, and to retrieve the return value once finished.
 		 */
-		AsyncOp queueReturnCommand(std::function<void(AsyncOp&)> commandCallback);
+		template<class T>
+		AsyncOp queueReturnCommand(T&& commandCallback)
+		{
+			if(mRingBuffer == nullptr)
+				return mCommandQueue->queueReturn(std::function<void(AsyncOp&)>(std::forward<T>(commandCallback)));
+
+			AsyncOp op(mAsyncOpSyncData);
+			queueCommand(ReturnCommand<typename std::decay<T>::type>(std::forward<T>(commandCallback), op));
+
+			return op;
+		}
 
 		/** Queues a new generic command that will be added to the command queue. */
-		void queueCommand(std::function<void()> commandCallback);
+		template<class T>
+		void queueCommand(T&& commandCallback)
+		{
+			if(mRingBuffer == nullptr)
+			{
+				mCommandQueue->queue(std::function<void()>(std::forward<T>(commandCallback)));
+				return;
+			}
+
+			while(!mRingBuffer->tryQueue(std::forward<T>(commandCallback)))
+			{
+				// Buffer is full, let the core thread process what we have so far and wait until it frees up some space
+				submitToCoreThread();
+				mRingBuffer->waitForSpace();
+			}
+		}
 
 		/**
 		 * Makes all the currently queued commands available to the core thread. They will be executed as soon as the core 
@@ -45,8 +79,35 @@ namespace BansheeEngine
 		/** Cancels all commands in the queue. */
 		void cancelAll();
 
+		/** Returns the ring buffer the commands are recorded in, or null if the accessor uses a command queue. */
+		const SPtr<CommandRingBuffer>& _getRingBuffer() const { return mRingBuffer; }
+
 	private:
+		/** Wraps a command with a return value so it can be recorded in the ring buffer. */
+		template<class T>
+		struct ReturnCommand
+		{
+			template<class U>
+			ReturnCommand(U&& callback, const AsyncOp& op)
+				:callback(std::forward<U>(callback)), op(op)
+			{ }
+
+			void operator()()
+			{
+				callback(op);
+				completeReturnCommand(op);
+			}
+
+			T callback;
+			AsyncOp op;
+		};
+
+		/** Resolves the async operation of a return command, in case the command itself didn't. */
+		static void completeReturnCommand(AsyncOp& op);
+
 		CommandQueueBase* mCommandQueue;
+		SPtr<CommandRingBuffer> mRingBuffer;
+		SPtr<AsyncOpSyncData> mAsyncOpSyncData;
 	};
 
 	/**
@@ -63,9 +124,12 @@ namespace BansheeEngine
 		 * Constructor.
 		 *
 		 * @param[in]	threadId		Identifier for the thread that created the accessor.
+		 * @param[in]	ringBufferSize	If non-zero, commands are recorded in a lock-free ring buffer of this size (in 
+		 *								bytes) instead of the command queue. Only valid for accessors used by a single
+		 *								thread.
 		 */
-		CoreThreadAccessor(ThreadId threadId)
-			:CoreThreadAccessorBase(bs_new<CommandQueue<CommandQueueSyncPolicy>>(threadId))
+		CoreThreadAccessor(ThreadId threadId, UINT32 ringBufferSize = 0)
+			:CoreThreadAccessorBase(bs_new<CommandQueue<CommandQueueSyncPolicy>>(threadId), ringBufferSize)
 		{
 
 		}
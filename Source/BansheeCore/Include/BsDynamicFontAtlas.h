@@ -0,0 +1,190 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsFontDesc.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Renders characters of a single font face at a specific size, on demand. */
+	class BS_CORE_EXPORT GlyphRasterizer
+	{
+	public:
+		virtual ~GlyphRasterizer() { }
+
+		/**
+		 * Renders a single character.
+		 *
+		 * @param[in]	charId	Unicode key of the character to render.
+		 * @param[out]	desc	Metrics of the rendered character. Texture page and coordinates are not assigned.
+		 * @param[out]	pixels	Coverage of the rendered character, one byte per pixel. Rows are stored top to bottom,
+		 *						each row being @p desc.width bytes long.
+		 * @return				True if the character was rendered, false if the font doesn't contain it.
+		 */
+		virtual bool renderGlyph(UINT32 charId, CHAR_DESC& desc, Vector<UINT8>& pixels) = 0;
+
+		/**
+		 * Returns the amount by which to move the second character closer or further away from the first, when the two
+		 * are placed next to each other. In pixels.
+		 */
+		virtual INT32 getKerning(UINT32 firstCharId, UINT32 secondCharId) = 0;
+
+		/** Returns the largest width or height of any character in the font, in pixels. */
+		virtual UINT32 getMaxGlyphSize() const = 0;
+	};
+
+	/**
+	 * Set of texture pages that characters of a single font size are rendered into at runtime, as they are requested.
+	 * Each page is split into a grid of equally sized cells, each holding a single character. When the atlas is full
+	 * the least recently used characters are evicted to make room for new ones.
+	 *
+	 * A character is assigned a page the first time it is rendered, and is only ever moved to other cells within that
+	 * same page. This ensures the per-page quad counts of previously built text remain valid.
+	 *
+	 * Text that keeps the texture coordinates of its characters around (e.g. in a vertex buffer) must pin the characters
+	 * for as long as it is displayed, as cells of evicted characters get reused by others. Pinned characters are never
+	 * evicted. If all cells of a page are pinned or used during the current frame, new characters assigned to the page
+	 * have their texture coordinates collapsed to an empty texel, and render blank until the text is rebuilt.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT DynamicFontAtlas
+	{
+	public:
+		/**
+		 * Creates a new atlas.
+		 *
+		 * @param[in]	rasterizer		Rasterizer used for rendering the characters.
+		 * @param[in]	pageSize		Width and height of a single texture page, in pixels.
+		 * @param[in]	numPages		Maximum number of texture pages in the atlas.
+		 * @param[in]	firstPageIdx	Index to assign to the first page of the atlas, when referenced from CHAR_DESC.
+		 *								Normally equal to the number of pre-rendered texture pages in the font bitmap.
+		 */
+		DynamicFontAtlas(const SPtr<GlyphRasterizer>& rasterizer, UINT32 pageSize, UINT32 numPages, UINT32 firstPageIdx);
+		~DynamicFontAtlas();
+
+		/**
+		 * Returns a description of the character with the specified Unicode key, rendering it into the atlas if it isn't
+		 * already present. Returns null if the font doesn't contain the character. If the atlas is full of pinned
+		 * characters or characters used during the current frame, the character is returned without any visible pixels,
+		 * and will be rendered when requested during a later frame.
+		 *
+		 * @note	Returned pointer remains valid for the lifetime of the atlas, but the description it points to is only
+		 *			guaranteed not to change until the end of the current frame. After that an unpinned character may be
+		 *			evicted or moved to a different cell, which modifies its texture coordinates.
+		 */
+		const CHAR_DESC* getCharDesc(UINT32 charId);
+
+		/**
+		 * Prevents the character with the specified Unicode key from being evicted from the atlas, until a matching call
+		 * to unpinChar(). Calls can be nested. Returns false if the character was never requested from the atlas or the
+		 * font doesn't contain it, in which case nothing is pinned.
+		 */
+		bool pinChar(UINT32 charId);
+
+		/** Releases a character pinned with pinChar(), making it eligible for eviction once no pins remain. */
+		void unpinChar(UINT32 charId);
+
+		/**
+		 * Returns the amount by which to move the second character closer or further away from the first, when the two
+		 * are placed next to each other. In pixels.
+		 */
+		INT32 getKerning(UINT32 firstCharId, UINT32 secondCharId);
+
+		/**
+		 * Returns the texture for the specified page. Page index is relative to the first page of the atlas. Returns
+		 * an empty handle if no characters have been rendered into the page yet.
+		 */
+		const HTexture& getTexture(UINT32 page) const;
+
+		/** Returns the maximum number of pages in the atlas. */
+		UINT32 getNumPages() const { return (UINT32)mPages.size(); }
+
+		/** Returns the index assigned to the first page of the atlas, when referenced from CHAR_DESC. */
+		UINT32 getFirstPageIdx() const { return mFirstPageIdx; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Uploads the contents of pages modified since the last call to the GPU. Called by FontManager once per frame.
+		 *
+		 * @note	Sim thread only.
+		 */
+		void _updatePages();
+
+		/** @} */
+
+	private:
+		static const UINT32 INVALID_CELL_IDX;
+		static const UINT32 MAX_CACHED_KERNING_PAIRS;
+
+		/** Character rendered by the atlas. */
+		struct Glyph
+		{
+			CHAR_DESC desc;
+			UINT32 page;
+			UINT32 cellIdx;
+			UINT32 numPins;
+			bool exists;
+		};
+
+		/** Area of a page that can hold a single character. */
+		struct Cell
+		{
+			UINT32 x, y;
+			UINT32 charId;
+			UINT64 lastUsedFrame;
+			List<UINT32>::iterator usageIter;
+		};
+
+		/** A single texture of the atlas, along with a copy of its pixels. */
+		struct Page
+		{
+			HTexture texture;
+			SPtr<PixelData> pixels;
+			Vector<Cell> cells;
+			Vector<UINT32> freeCells;
+			List<UINT32> cellUsage; /**< Occupied unpinned cell indices, with most recently used ones at the front. */
+			bool isDirty;
+		};
+
+		/**
+		 * Finds a cell on the specified page that a character can be rendered into, evicting the least recently used
+		 * character if needed. Returns INVALID_CELL_IDX if all cells are occupied by characters used this frame.
+		 */
+		UINT32 allocateCell(UINT32 page, UINT64 frameIdx);
+
+		/** 
+		 * Copies the most recently rendered character pixels into the provided cell, and assigns the character its
+		 * metrics and texture coordinates.
+		 */
+		void writeToCell(Glyph& glyph, const CHAR_DESC& desc, UINT32 cellIdx, UINT64 frameIdx);
+
+		/** Allocates the page texture and its pixel buffer, if not already allocated. */
+		void preparePage(Page& page);
+
+		/** Marks the cell as used during the specified frame. */
+		void touchCell(Page& page, UINT32 cellIdx, UINT64 frameIdx);
+
+		SPtr<GlyphRasterizer> mRasterizer;
+		UINT32 mPageSize;
+		UINT32 mCellSize;
+		UINT32 mFirstPageIdx;
+
+		Vector<Page> mPages;
+		UnorderedMap<UINT32, Glyph> mGlyphs;
+		UnorderedMap<UINT64, INT32> mKerningPairs; /**< Kerning amount keyed by (first char ID << 32 | second char ID). */
+		Vector<UINT8> mGlyphPixels;
+
+		mutable Mutex mMutex;
+	};
+
+	/** @} */
+}
@@ -15,13 +15,74 @@ namespace BansheeEngine
 	/**	Contains textures and data about every character for a bitmap font of a specific size. */
 	struct BS_CORE_EXPORT FontBitmap : public IReflectable
 	{
+		FontBitmap();
+
 		/**	Returns a character description for the character with the specified Unicode key. */
 		const CHAR_DESC& getCharDesc(UINT32 charId) const;
 
+		/**
+		 * Returns the amount by which to move the second character closer or further away from the first, when the two
+		 * are placed next to each other. In pixels.
+		 */
+		INT32 getKerning(UINT32 firstCharId, UINT32 secondCharId) const;
+
+		/** 
+		 * Returns the texture for the specified page. This includes both the pre-rendered pages in texturePages, and 
+		 * pages of characters rendered at runtime, which follow them.
+		 */
+		const HTexture& getTexture(UINT32 page) const;
+
+		/** Returns the total number of texture pages, including pages of characters rendered at runtime. */
+		UINT32 getNumPages() const;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Builds the lookup tables used by getCharDesc() and getKerning(). Must be called after fontDesc is modified.
+		 * Font will call this automatically for all of its bitmaps when it is initialized. Until called, lookups are 
+		 * performed by searching fontDesc directly.
+		 */
+		void _buildLookupTables();
+
+		/** 
+		 * Assigns an atlas that characters not present in fontDesc will be rendered into when requested. Font will
+		 * assign the atlas automatically when it is initialized, if it supports rendering characters at runtime.
+		 */
+		void _setDynamicAtlas(const SPtr<DynamicFontAtlas>& atlas) { mDynamicAtlas = atlas; }
+
+		/**
+		 * Pins the characters of the provided text that were rendered at runtime, so they aren't evicted from the atlas
+		 * while text built from their texture coordinates is displayed. IDs of the pinned characters are appended to
+		 * @p pinnedChars, and must be released with _unpinChars() once the text is no longer displayed.
+		 */
+		void _pinChars(const WString& text, Vector<UINT32>& pinnedChars) const;
+
+		/** Releases characters pinned by _pinChars(). */
+		void _unpinChars(const Vector<UINT32>& pinnedChars) const;
+
+		/** @} */
+
 		UINT32 size; /**< Font size for which the data is contained. */
 		FONT_DESC fontDesc; /**< Font description containing per-character and general font data. */
 		Vector<HTexture> texturePages; /**< Textures in which the character's pixels are stored. */
 
+	private:
+		/** Returns the description of a pre-rendered character, or null if the character wasn't pre-rendered. */
+		const CHAR_DESC* findCharDesc(UINT32 charId) const;
+
+		static const UINT32 INVALID_CHAR_IDX;
+		static const UINT32 NUM_BMP_CHARS;
+
+		Vector<CHAR_DESC> mCharDescs; /**< Copies of all characters from fontDesc, referenced by the tables below. */
+		Vector<UINT32> mBMPCharLookup; /**< Index into mCharDescs for each code point in the Basic Multilingual Plane. */
+		UnorderedMap<UINT32, UINT32> mOtherCharLookup; /**< Index into mCharDescs for code points outside the BMP. */
+		UnorderedMap<UINT64, INT32> mKerningLookup; /**< Kerning amount keyed by (first char ID << 32 | second char ID). */
+		bool mHasLookupTables;
+
+		SPtr<DynamicFontAtlas> mDynamicAtlas;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -53,9 +114,18 @@ namespace BansheeEngine
 		/**	Finds the available font bitmap size closest to the provided size. */
 		INT32 getClosestSize(UINT32 size) const;
 
+		/**	Returns true if characters not present in the font bitmaps can be rendered at runtime. */
+		bool isDynamic() const { return !mDynamicDesc.fontData.empty(); }
+
 		/**	Creates a new font from the provided per-size font data. */
 		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/**
+		 * Creates a new font from the provided per-size font data. Characters not present in the font data will be
+		 * rendered at runtime as they are requested, using the provided dynamic font description.
+		 */
+		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData, const DYNAMIC_FONT_DESC& dynamicDesc);
+
 	public: // ***** INTERNAL ******
 		using Resource::initialize;
 
@@ -70,9 +140,20 @@ namespace BansheeEngine
 		 */
 		void initialize(const Vector<SPtr<FontBitmap>>& fontData);
 
+		/**
+		 * Initializes the font with specified per-size font data, and a description used for rendering characters
+		 * missing from the font data at runtime.
+		 *
+		 * @note	Internal method. Factory methods will call this automatically for you.
+		 */
+		void initialize(const Vector<SPtr<FontBitmap>>& fontData, const DYNAMIC_FONT_DESC& dynamicDesc);
+
 		/** Creates a new font as a pointer instead of a resource handle. */
 		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/** Creates a new font as a pointer instead of a resource handle. */
+		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData, const DYNAMIC_FONT_DESC& dynamicDesc);
+
 		/** @} */
 
 	protected:
@@ -88,6 +169,7 @@ namespace BansheeEngine
 
 	private:
 		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
+		DYNAMIC_FONT_DESC mDynamicDesc;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -45,6 +45,32 @@ namespace BansheeEngine
 		UINT32 spaceWidth; /**< Width of a space in pixels. */
 	};
 
+	/**	Determines how is a font rendered into the bitmap texture. */
+	enum class FontRenderMode
+	{
+		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
+		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
+		HintedSmooth, /*< Render antialiased fonts with hinting. */
+		HintedRaster /*< Render non-antialiased fonts with hinting. */
+	};
+
+	/** 
+	 * Describes a font whose characters can be rendered at runtime, for characters that weren't rendered into the font
+	 * bitmap during import. 
+	 */
+	struct DYNAMIC_FONT_DESC
+	{
+		DYNAMIC_FONT_DESC()
+			:dpi(96), renderMode(FontRenderMode::HintedSmooth), pageSize(512), numPages(1)
+		{ }
+
+		Vector<UINT8> fontData; /**< Contents of the source font file. If empty no characters will be rendered at runtime. */
+		UINT32 dpi; /**< Dots per inch resolution to use when rendering the characters. */
+		FontRenderMode renderMode; /**< Determines how are the characters rendered. */
+		UINT32 pageSize; /**< Width and height of a single atlas texture page, in pixels. */
+		UINT32 numPages; /**< Number of atlas texture pages available to each font size. */
+	};
+
 	/** @cond SPECIALIZATIONS */
 
 	// Make CHAR_DESC serializable
@@ -167,6 +193,54 @@ namespace BansheeEngine
 		}	
 	}; 
 
+	// Make DYNAMIC_FONT_DESC serializable
+	template<> struct RTTIPlainType<DYNAMIC_FONT_DESC>
+	{	
+		enum { id = TID_DYNAMIC_FONT_DESC }; enum { hasDynamicSize = 1 };
+
+		static void toMemory(const DYNAMIC_FONT_DESC& data, char* memory)
+		{ 
+			UINT32 size = sizeof(UINT32);
+			char* memoryStart = memory;
+			memory += sizeof(UINT32);
+			
+			memory = rttiWriteElem(data.fontData, memory, size);
+			memory = rttiWriteElem(data.dpi, memory, size);
+			memory = rttiWriteElem(data.renderMode, memory, size);
+			memory = rttiWriteElem(data.pageSize, memory, size);
+			memory = rttiWriteElem(data.numPages, memory, size);
+
+			memcpy(memoryStart, &size, sizeof(UINT32));
+		}
+
+		static UINT32 fromMemory(DYNAMIC_FONT_DESC& data, char* memory)
+		{ 
+			UINT32 size;
+			memcpy(&size, memory, sizeof(UINT32)); 
+			memory += sizeof(UINT32);
+
+			memory = rttiReadElem(data.fontData, memory);
+			memory = rttiReadElem(data.dpi, memory);
+			memory = rttiReadElem(data.renderMode, memory);
+			memory = rttiReadElem(data.pageSize, memory);
+			memory = rttiReadElem(data.numPages, memory);
+
+			return size;
+		}
+
+		static UINT32 getDynamicSize(const DYNAMIC_FONT_DESC& data)	
+		{ 
+			UINT64 dataSize = sizeof(UINT32);
+			dataSize += rttiGetElemSize(data.fontData);
+			dataSize += rttiGetElemSize(data.dpi);
+			dataSize += rttiGetElemSize(data.renderMode);
+			dataSize += rttiGetElemSize(data.pageSize);
+			dataSize += rttiGetElemSize(data.numPages);
+
+			return (UINT32)dataSize;
+		}	
+	}; 
+
 	/** @endcond */
 	/** @} */
 }
\ No newline at end of file
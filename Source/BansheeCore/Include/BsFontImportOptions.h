@@ -12,15 +12,6 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
-	/**	Determines how is a font rendered into the bitmap texture. */
-	enum class FontRenderMode
-	{
-		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
-		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
-		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
-	};
-
 	/**	Import options that allow you to control how is a font imported. */
 	class BS_CORE_EXPORT FontImportOptions : public ImportOptions
 	{
@@ -48,6 +39,19 @@ namespace BansheeEngine
 		/**	Sets whether the italic font style should be used when rendering. */
 		void setItalic(bool italic) { mItalic = italic; }
 
+		/**
+		 * Sets whether characters outside of the imported character ranges should be rendered at runtime, as they are
+		 * requested. This requires the source font file to be stored along with the font, and the font importer plugin
+		 * to be loaded by the application that displays the font.
+		 */
+		void setDynamic(bool dynamic) { mDynamic = dynamic; }
+
+		/**	Sets the width and height of a texture page that characters rendered at runtime are stored in, in pixels. */
+		void setDynamicPageSize(UINT32 size) { mDynamicPageSize = size; }
+
+		/**	Sets the number of texture pages available to characters rendered at runtime, per font size. */
+		void setDynamicNumPages(UINT32 numPages) { mDynamicNumPages = numPages; }
+
 		/**	Gets the sizes that are to be imported. Ranges are defined as unicode numbers. */
 		Vector<UINT32> getFontSizes() const { return mFontSizes; }
 
@@ -66,6 +70,15 @@ namespace BansheeEngine
 		/**	Sets whether the italic font style should be used when rendering. */
 		bool getItalic() const { return mItalic; }
 
+		/**	Checks whether characters outside of the imported character ranges should be rendered at runtime. */
+		bool getDynamic() const { return mDynamic; }
+
+		/**	Returns the width and height of a texture page that characters rendered at runtime are stored in, in pixels. */
+		UINT32 getDynamicPageSize() const { return mDynamicPageSize; }
+
+		/**	Returns the number of texture pages available to characters rendered at runtime, per font size. */
+		UINT32 getDynamicNumPages() const { return mDynamicNumPages; }
+
 	private:
 		Vector<UINT32> mFontSizes;
 		Vector<std::pair<UINT32, UINT32>> mCharIndexRanges;
@@ -73,6 +86,9 @@ namespace BansheeEngine
 		FontRenderMode mRenderMode;
 		bool mBold;
 		bool mItalic;
+		bool mDynamic;
+		UINT32 mDynamicPageSize;
+		UINT32 mDynamicNumPages;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -34,6 +34,15 @@ namespace BansheeEngine
 		bool& getItalic(FontImportOptions* obj) { return obj->mItalic; }
 		void setItalic(FontImportOptions* obj, bool& value) { obj->mItalic = value; }
 
+		bool& getDynamic(FontImportOptions* obj) { return obj->mDynamic; }
+		void setDynamic(FontImportOptions* obj, bool& value) { obj->mDynamic = value; }
+
+		UINT32& getDynamicPageSize(FontImportOptions* obj) { return obj->mDynamicPageSize; }
+		void setDynamicPageSize(FontImportOptions* obj, UINT32& value) { obj->mDynamicPageSize = value; }
+
+		UINT32& getDynamicNumPages(FontImportOptions* obj) { return obj->mDynamicNumPages; }
+		void setDynamicNumPages(FontImportOptions* obj, UINT32& value) { obj->mDynamicNumPages = value; }
+
 	public:
 		FontImportOptionsRTTI()
 		{
@@ -43,6 +52,9 @@ namespace BansheeEngine
 			addPlainField("mRenderMode", 3, &FontImportOptionsRTTI::getRenderMode, &FontImportOptionsRTTI::setRenderMode);
 			addPlainField("mBold", 4, &FontImportOptionsRTTI::getBold, &FontImportOptionsRTTI::setBold);
 			addPlainField("mItalic", 5, &FontImportOptionsRTTI::getItalic, &FontImportOptionsRTTI::setItalic);
+			addPlainField("mDynamic", 6, &FontImportOptionsRTTI::getDynamic, &FontImportOptionsRTTI::setDynamic);
+			addPlainField("mDynamicPageSize", 7, &FontImportOptionsRTTI::getDynamicPageSize, &FontImportOptionsRTTI::setDynamicPageSize);
+			addPlainField("mDynamicNumPages", 8, &FontImportOptionsRTTI::getDynamicNumPages, &FontImportOptionsRTTI::setDynamicNumPages);
 		}
 
 		const String& getRTTIName() override
@@ -15,15 +15,50 @@ namespace BansheeEngine
 	class BS_CORE_EXPORT FontManager : public Module<FontManager>
 	{
 	public:
+		/** Callback that creates a rasterizer for the font described by the provided descriptor, at a specific size. */
+		typedef std::function<SPtr<GlyphRasterizer>(const DYNAMIC_FONT_DESC&, UINT32)> GlyphRasterizerFactory;
+
 		/**	Creates a new font from the provided populated font data structure. */
 		SPtr<Font> create(const Vector<SPtr<FontBitmap>>& fontData) const;
 
+		/**
+		 * Creates a new font from the provided populated font data structure. Characters not present in the font data
+		 * will be rendered at runtime as they are requested, using the provided dynamic font description.
+		 */
+		SPtr<Font> create(const Vector<SPtr<FontBitmap>>& fontData, const DYNAMIC_FONT_DESC& dynamicDesc) const;
+
 		/**
 		 * Creates an empty font.
 		 *
 		 * @note	Internal method. Used by factory methods.
 		 */
 		SPtr<Font> _createEmpty() const;
+
+		/** 
+		 * Registers a factory used for creating rasterizers for fonts that render characters at runtime. Normally 
+		 * registered by the font importer plugin, which must be loaded on start-up before any fonts are loaded.
+		 */
+		void _registerGlyphRasterizerFactory(const GlyphRasterizerFactory& factory);
+
+		/** 
+		 * Creates a rasterizer for the specified font and size. Returns null if no rasterizer factory is registered or the
+		 * font data cannot be parsed.
+		 */
+		SPtr<GlyphRasterizer> _createGlyphRasterizer(const DYNAMIC_FONT_DESC& desc, UINT32 size) const;
+
+		/** Registers an atlas whose pages will be updated every frame. Called by the atlas when it is constructed. */
+		void _registerDynamicAtlas(DynamicFontAtlas* atlas);
+
+		/** Unregisters an atlas registered with _registerDynamicAtlas(). */
+		void _unregisterDynamicAtlas(DynamicFontAtlas* atlas);
+
+		/** Uploads any characters rendered at runtime to their atlas textures. Called once per frame. */
+		void _update();
+
+	private:
+		GlyphRasterizerFactory mRasterizerFactory;
+		UnorderedSet<DynamicFontAtlas*> mDynamicAtlases;
+		mutable Mutex mMutex;
 	};
 
 	/** @} */
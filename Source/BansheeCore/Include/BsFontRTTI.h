@@ -60,6 +60,7 @@ namespace BansheeEngine
 		struct FontInitData
 		{
 			Vector<SPtr<FontBitmap>> fontDataPerSize;
+			DYNAMIC_FONT_DESC dynamicDesc;
 		};
 
 	private:
@@ -95,10 +96,19 @@ namespace BansheeEngine
 			initData->fontDataPerSize.resize(size);
 		}
 
+		DYNAMIC_FONT_DESC& getDynamicDesc(Font* obj) { return obj->mDynamicDesc; }
+		void setDynamicDesc(Font* obj, DYNAMIC_FONT_DESC& value)
+		{
+			FontInitData* initData = any_cast<FontInitData*>(obj->mRTTIData);
+
+			initData->dynamicDesc = value;
+		}
+
 	public:
 		FontRTTI()
 		{
 			addReflectableArrayField("mBitmaps", 0, &FontRTTI::getBitmap, &FontRTTI::getNumBitmaps, &FontRTTI::setBitmap, &FontRTTI::setNumBitmaps);
+			addPlainField("mDynamicDesc", 1, &FontRTTI::getDynamicDesc, &FontRTTI::setDynamicDesc);
 		}
 
 		const String& getRTTIName() override
@@ -131,7 +141,7 @@ namespace BansheeEngine
 			Font* font = static_cast<Font*>(obj);
 			FontInitData* initData = any_cast<FontInitData*>(font->mRTTIData);
 
-			font->initialize(initData->fontDataPerSize);
+			font->initialize(initData->fontDataPerSize, initData->dynamicDesc);
 
 			bs_delete(initData);
 		}
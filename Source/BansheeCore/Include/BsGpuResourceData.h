@@ -66,6 +66,25 @@ namespace BansheeEngine
 		 */
 		void setExternalBuffer(UINT8* data);
 
+		/**
+		 * Makes the internal data pointer point to memory owned by the provided data stream (for example a memory mapped
+		 * file). No copying is done, and the stream is kept alive for as long as this object references the data.
+		 *
+		 * @note	If any internal data is allocated, it is freed.
+		 * @note	Data is treated as read-only, and must be detached (see detachDataSource()) before it is written to.
+		 */
+		void setExternalBuffer(UINT8* data, const SPtr<DataStream>& dataSource);
+
+		/**
+		 * If the data is referenced from an external data source (see setExternalBuffer(UINT8*, const SPtr<DataStream>&)),
+		 * copies it into an internal buffer and releases the source. Should be called on data that is kept around long
+		 * term, so it doesn't keep the source (e.g. a memory mapped file) alive.
+		 */
+		void detachDataSource();
+
+		/** Returns the stream the data is referenced from, if any. See setExternalBuffer(UINT8*, const SPtr<DataStream>&). */
+		const SPtr<DataStream>& getDataSource() const { return mDataSource; }
+
 		/** Checks if the internal buffer is locked due to some other thread using it. */
 		bool isLocked() const { return mLocked; }
 
@@ -84,6 +103,7 @@ namespace BansheeEngine
 
 	private:
 		UINT8* mData;
+		SPtr<DataStream> mDataSource;
 		bool mOwnsData;
 		mutable bool mLocked;
 
@@ -23,6 +23,7 @@ namespace BansheeEngine
 		void setSubMesh(MeshBase* obj, UINT32 arrayIdx, SubMesh& value) { obj->mProperties.mSubMeshes[arrayIdx] = value; }
 		UINT32 getNumSubmeshes(MeshBase* obj) { return (UINT32)obj->mProperties.mSubMeshes.size(); }
 		void setNumSubmeshes(MeshBase* obj, UINT32 numElements) { obj->mProperties.mSubMeshes.resize(numElements); }
+		SubMesh* getSubMeshData(MeshBase* obj) { return obj->mProperties.mSubMeshes.data(); }
 
 		UINT32& getNumVertices(MeshBase* obj) { return obj->mProperties.mNumVertices; }
 		void setNumVertices(MeshBase* obj, UINT32& value) { obj->mProperties.mNumVertices = value; }
@@ -37,7 +38,8 @@ namespace BansheeEngine
 			addPlainField("mNumIndices", 1, &MeshBaseRTTI::getNumIndices, &MeshBaseRTTI::setNumIndices);
 
 			addPlainArrayField("mSubMeshes", 2, &MeshBaseRTTI::getSubMesh, 
-				&MeshBaseRTTI::getNumSubmeshes, &MeshBaseRTTI::setSubMesh, &MeshBaseRTTI::setNumSubmeshes);
+				&MeshBaseRTTI::getNumSubmeshes, &MeshBaseRTTI::setSubMesh, &MeshBaseRTTI::setNumSubmeshes, 
+				&MeshBaseRTTI::getSubMeshData);
 		}
 
 		SPtr<IReflectable> newRTTIObject() override
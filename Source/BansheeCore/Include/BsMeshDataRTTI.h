@@ -41,6 +41,16 @@ namespace BansheeEngine
 
 		void setData(MeshData* obj, const SPtr<DataStream>& value, UINT32 size)
 		{
+			// Reference mapped data directly, the mapping stays alive until the data is released (normally once uploaded)
+			if (value->isMemoryMapped())
+			{
+				SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(value);
+				obj->setExternalBuffer(memStream->getCurrentPtr(), value);
+
+				value->skip(size);
+				return;
+			}
+
 			obj->allocateInternalBuffer(size);
 			value->read(obj->getData(), size);
 		}
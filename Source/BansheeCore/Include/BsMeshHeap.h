@@ -44,6 +44,9 @@ namespace BansheeEngine
 			UseFlags useFlags;
 			UINT32 eventQueryIdx;
 			SPtr<TransientMeshCore> mesh;
+
+			/** Vertex chunks the mesh was moved out of, that can be freed once the GPU is done with the mesh. */
+			Vector<UINT32> retiredVertChunks;
 		};
 
 		/**	Data about a GPU query. */
@@ -78,6 +81,35 @@ namespace BansheeEngine
 		/** Deallocates the provided mesh. Freed memory will be re-used as soon as the GPU is done with the mesh. */
 		void dealloc(SPtr<TransientMeshCore> mesh);
 
+		/**
+		 * Overwrites a range of vertices of an existing mesh. If the GPU might still be using the mesh, its vertices
+		 * are moved to a new chunk instead of being overwritten, and the old chunk is freed once the GPU is done with
+		 * the mesh.
+		 *
+		 * @param[in]	mesh		Mesh whose vertices to overwrite.
+		 * @param[in]	meshData	Vertices to write. Index data is ignored.
+		 * @param[in]	firstVertex	Index of the first vertex of the mesh to overwrite.
+		 */
+		void update(SPtr<TransientMeshCore> mesh, const SPtr<MeshData>& meshData, UINT32 firstVertex);
+
+		/**
+		 * Finds a free chunk of the vertex buffer large enough to hold the provided number of vertices, growing the
+		 * buffer if needed. Returns the index of the chunk.
+		 */
+		UINT32 allocVertChunk(UINT32 numVertices);
+
+		/**
+		 * Copies vertices from the provided mesh data into the CPU copy of the vertex buffer, starting at the
+		 * specified vertex.
+		 */
+		void writeVertexData(const SPtr<MeshData>& meshData, UINT32 vertexOffset);
+
+		/** Uploads a range of vertices from the CPU copy of the vertex buffer to the GPU. */
+		void uploadVertexData(UINT32 vertexOffset, UINT32 numVertices);
+
+		/** Frees any vertex chunks the provided mesh was moved out of during updates. */
+		void freeRetiredChunks(AllocatedData& allocData);
+
 		/** Resizes the vertex buffers so they max contain the provided number of vertices. */
 		void growVertexBuffer(UINT32 numVertices);
 
@@ -129,6 +161,9 @@ namespace BansheeEngine
 		 */
 		void mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx);
 
+		/** Same as mergeWithNearbyChunks(), but only merges vertex buffer chunks. */
+		void mergeWithNearbyVertChunks(UINT32 chunkVertIdx);
+
 	private:
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
@@ -197,6 +232,16 @@ namespace BansheeEngine
 		 */
 		void dealloc(const SPtr<TransientMesh>& mesh);
 
+		/**
+		 * Overwrites a range of vertices of a mesh allocated from this heap, without re-allocating the mesh. Number of
+		 * vertices and the index data of the mesh remain unchanged.
+		 *
+		 * @param[in]	mesh		Mesh to update.
+		 * @param[in]	meshData	Vertices to write. Any index data is ignored.
+		 * @param[in]	firstVertex	Index of the first vertex in @p mesh to overwrite.
+		 */
+		void update(const SPtr<TransientMesh>& mesh, const SPtr<MeshData>& meshData, UINT32 firstVertex);
+
 		/** Retrieves a core implementation of a mesh heap usable only from the core thread. */
 		SPtr<MeshHeapCore> getCore() const;
 
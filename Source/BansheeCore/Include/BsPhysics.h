@@ -44,7 +44,21 @@ namespace BansheeEngine
 		 * Enables continous collision detection. This will prevent fast-moving objects from tunneling through each other.
 		 * You must also enable CCD for individual Rigidbodies. This option can have a significant performance impact.
 		 */
-		CCD_Enable = 1<<3
+		CCD_Enable = 1<<3,
+		/**
+		 * Runs the physics simulation step in parallel with the rest of the frame. The step is started at the end of the
+		 * frame and its results are retrieved during the physics update of the next frame. Rigidbody transforms are
+		 * displayed two simulation steps behind the frame time, interpolated between the retrieved step results so that
+		 * motion stays smooth regardless of when a step finishes.
+		 *
+		 * A step runs from the end of a frame until the physics update of the next frame, which means it overlaps
+		 * component updates. While it is running:
+		 *  - Queries, and rigidbody and collider getters report the state from before the step.
+		 *  - Changes to rigidbodies, colliders and joints are buffered and applied once the step completes. Transform
+		 *    or velocity set on a rigidbody this way replaces the result of the step for that rigidbody.
+		 *  - Creating, destroying, moving or resizing a character controller first waits for the step to complete.
+		 */
+		AsyncSimulation = 1<<4
 	};
 
 	/** @copydoc CharacterCollisionFlag */
@@ -399,6 +413,44 @@ namespace BansheeEngine
 		virtual bool convexOverlapAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
 			UINT64 layer = BS_ALL_LAYERS) const = 0;
 
+		/**
+		 * Casts multiple rays into the scene and returns the closest hit for each. The rays are cast in parallel and no
+		 * memory is allocated per ray, making this preferable to individual ray casts when casting many rays at once.
+		 *
+		 * @param[in]	queries		Rays to cast into the scene.
+		 * @param[in]	numQueries	Number of entries in @p queries.
+		 * @param[out]	hits		Buffer with room for @p numQueries entries, receiving the closest hit for each ray in
+		 *							the same order as @p queries. Entries of rays that didn't hit anything have a null
+		 *							collider.
+		 * @return					Number of rays that hit something.
+		 */
+		virtual UINT32 rayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const = 0;
+
+		/**
+		 * Checks if any of multiple rays hit anything in the scene. The rays are cast in parallel and no memory is
+		 * allocated per ray. 
+		 *
+		 * @param[in]	queries		Rays to cast into the scene.
+		 * @param[in]	numQueries	Number of entries in @p queries.
+		 * @param[out]	hits		Buffer with room for @p numQueries entries, receiving true for each ray that hit
+		 *							something, in the same order as @p queries.
+		 * @return					Number of rays that hit something.
+		 */
+		virtual UINT32 rayCastAnyBatch(const PhysicsRayQuery* queries, UINT32 numQueries, bool* hits) const = 0;
+
+		/**
+		 * Sweeps multiple shapes through the scene and returns the closest hit for each. The sweeps are performed in 
+		 * parallel and no memory is allocated per sweep.
+		 *
+		 * @param[in]	queries		Shapes to sweep through the scene.
+		 * @param[in]	numQueries	Number of entries in @p queries.
+		 * @param[out]	hits		Buffer with room for @p numQueries entries, receiving the closest hit for each sweep in
+		 *							the same order as @p queries. Entries of sweeps that didn't hit anything have a null
+		 *							collider.
+		 * @return					Number of sweeps that hit something.
+		 */
+		virtual UINT32 sweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const = 0;
+
 		/******************************************************************************************************************/
 		/************************************************* OPTIONS ********************************************************/
 		/******************************************************************************************************************/
@@ -412,6 +464,18 @@ namespace BansheeEngine
 		/** Pauses or resumes the physics simulation. */
 		virtual void setPaused(bool paused) = 0;
 
+		/**
+		 * Sets the number of threads dedicated to running the physics simulation. If zero, the simulation runs on the
+		 * global TaskScheduler, sharing its threads with the rest of the engine.
+		 */
+		virtual void setNumSimulationThreads(UINT32 numThreads) = 0;
+
+		/** 
+		 * Returns the number of threads dedicated to running the physics simulation. Zero if the simulation runs on the
+		 * global TaskScheduler.
+		 */
+		virtual UINT32 getNumSimulationThreads() const = 0;
+
 		/** Gets the global gravity value for all objects in the scene. */
 		virtual Vector3 getGravity() const = 0;
 
@@ -513,6 +577,28 @@ namespace BansheeEngine
 		/** Triggers physics simulation update as needed. Should be called once per frame. */
 		virtual void update() = 0;
 
+		/** 
+		 * Same as update(), except the frame is assumed to have lasted @p frameDelta seconds, and the simulation is
+		 * advanced even if it is paused.
+		 */
+		virtual void _update(float frameDelta) = 0;
+
+		/** Returns the interval (in seconds) at which update() advances the simulation. */
+		virtual float _getSimulationStep() const = 0;
+
+		/** 
+		 * Starts the simulation step scheduled by the last call to update(), if PhysicsFlag::AsyncSimulation is enabled.
+		 * Should be called once per frame, after all scene objects have been updated.
+		 */
+		virtual void _startAsyncStep() { }
+
+		/** 
+		 * Immediately advances the simulation by the provided amount of time (in seconds) and waits for it to complete,
+		 * regardless of frame time or the paused state. Rigidbody transforms are updated and events are triggered same as
+		 * with update().
+		 */
+		virtual void _simulate(float step) = 0;
+
 		/** @copydoc Physics::boxOverlap() */
 		virtual Vector<Collider*> _boxOverlap(const AABox& box, const Quaternion& rotation,
 			UINT64 layer = BS_ALL_LAYERS) const = 0;
@@ -570,6 +656,11 @@ namespace BansheeEngine
 		Vector3 gravity = Vector3(0.0f, -9.81f, 0.0f); /**< Initial gravity. */
 		bool initCooking = true; /**< Determines should the cooking library be initialized. */
 		float timeStep = 1.0f / 60.0f; /**< Determines using what interval should the physics update happen. */
+		/** 
+		 * Number of threads dedicated to running the physics simulation. If zero, the simulation runs on the global
+		 * TaskScheduler.
+		 */
+		UINT32 numSimulationThreads = 0;
 		/** Flags that control global physics option. */
 		PhysicsFlags flags = PhysicsFlag::CCT_OverlapRecovery | PhysicsFlag::CCT_PreciseSweeps | PhysicsFlag::CCD_Enable;
 	};
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsVector3.h"
 #include "BsVector2.h"
+#include "BsQuaternion.h"
 
 namespace BansheeEngine
 {
@@ -79,5 +80,36 @@ namespace BansheeEngine
 		HCollider collider;
 	};
 
+	/** Single ray cast performed as a part of a batched query. */
+	struct PhysicsRayQuery
+	{
+		Vector3 origin; /**< Origin of the ray. */
+		Vector3 unitDir; /**< Unit direction of the ray. */
+		float max = FLT_MAX; /**< Maximum distance at which to perform the query. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+	};
+
+	/** Type of shape swept by a sweep performed as a part of a batched query. */
+	enum class PhysicsSweepShape
+	{
+		Sphere,
+		Box,
+		Capsule
+	};
+
+	/** Single sweep performed as a part of a batched query. */
+	struct PhysicsSweepQuery
+	{
+		PhysicsSweepShape shape = PhysicsSweepShape::Sphere; /**< Type of shape to sweep. */
+		Vector3 position; /**< Center of the shape at the start of the sweep. */
+		Quaternion rotation = Quaternion::IDENTITY; /**< Orientation of the box or capsule. */
+		Vector3 halfExtents; /**< Half extents of the box. */
+		float radius = 0.0f; /**< Radius of the sphere or capsule. */
+		float halfHeight = 0.0f; /**< Half length of the capsule's line segment. */
+		Vector3 unitDir; /**< Unit direction along which to sweep the shape. */
+		float max = FLT_MAX; /**< Maximum distance at which to perform the query. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+	};
+
 	/** @} */
 }
\ No newline at end of file
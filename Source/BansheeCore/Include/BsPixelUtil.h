@@ -41,7 +41,8 @@ namespace BansheeEngine
 	{
 		Box,
 		Triangle,
-		Kaiser
+		Kaiser,
+		Lanczos
 	};
 
 	/**	Options used to control texture compression. */
@@ -61,6 +62,9 @@ namespace BansheeEngine
 		MipMapWrapMode wrapMode = MipMapWrapMode::Mirror; /*< Determines how to downsample pixels on borders. */
 		bool isNormalMap = false; /*< Determines does the input data represent a normal map. */
 		bool normalizeMipmaps = false; /*< Should the downsampled values be re-normalized. Only relevant for mip-maps representing normal maps. */
+		bool isSRGB = false; /*< Determines has the input data been gamma corrected. If true, filtering is performed in linear space. */
+		bool preserveAlphaCoverage = false; /*< Should alpha of each mip level be scaled so the fraction of pixels with alpha above alphaCoverageCutoff stays the same as in the base level. Useful for alpha tested textures. */
+		float alphaCoverageCutoff = 0.5f; /*< Alpha value used as the alpha test reference when preserving alpha coverage. */
 	};
 
 	/**	Utility methods for converting and managing pixel data and formats. */
@@ -71,7 +75,9 @@ namespace BansheeEngine
 		enum Filter
 		{
 			FILTER_NEAREST, /*< No filtering is performed and nearest existing value is used. */
-			FILTER_LINEAR /*< Box filter is applied, averaging nearby pixels. */
+			FILTER_LINEAR, /*< Box filter is applied, averaging nearby pixels. */
+			FILTER_KAISER, /*< Kaiser windowed sinc filter is applied. Sharper than the box filter. Only supports 2D images. */
+			FILTER_LANCZOS /*< Lanczos filter with a three pixel window is applied. Sharpest, but may introduce ringing. Only supports 2D images. */
 		};
 
 		/**	Returns the size of a single pixel of the provided pixel format, in bytes. */
@@ -200,8 +206,9 @@ namespace BansheeEngine
 		static void compress(const PixelData& src, PixelData& dst, const CompressionOptions& options);
 
 		/**
-		 * Generates mip-maps from the provided source data using the specified compression options. Returned list includes
-		 * the base level.
+		 * Generates mip-maps from the provided source data using the specified mip-map generation options. Returned list
+		 * includes the base level. Mip levels are filtered from the previous level in full precision, with rows of each
+		 * level processed in parallel if the task scheduler is running. Source data cannot be compressed or 3D.
 		 *
 		 * @return	A list of calculated mip-map data. First entry is the largest mip and other follow in order from 
 		 *			largest to smallest.
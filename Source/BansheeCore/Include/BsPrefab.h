@@ -58,12 +58,20 @@ namespace BansheeEngine
 
 		/**
 		 * Returns a reference to the internal prefab hierarchy. Returned hierarchy is not instantiated and cannot be 
-		 * interacted with in a manner you would with normal scene objects.
+		 * interacted with in a manner you would with normal scene objects. Hierarchy must not be modified, use
+		 * _editRoot() instead.
 		 */
 		HSceneObject _getRoot() const { return mRoot; }
 
 		/**
-		 * Creates the clone of the prefab's current hierarchy but doesn't instantiate it.
+		 * Same as _getRoot(), except the returned hierarchy may be modified. Cached instantiation data is released, so
+		 * any modifications are reflected in clones made afterwards.
+		 */
+		HSceneObject _editRoot();
+
+		/**
+		 * Creates the clone of the prefab's current hierarchy but doesn't instantiate it. The clone is created from 
+		 * the cached instantiation data, which is generated on first use.
 		 *			
 		 * @return	Clone of the prefab's scene object hierarchy.
 		 */
@@ -80,11 +88,26 @@ namespace BansheeEngine
 		/**	Creates an empty and uninitialized prefab. */
 		static SPtr<Prefab> createEmpty();
 
+		/** 
+		 * Encodes the prefab's hierarchy into the instantiation data. Every clone is then only decoded from this data,
+		 * instead of requiring the hierarchy to be encoded again.
+		 */
+		void createInstantiationData();
+
+		/** 
+		 * Releases the cached instantiation data, forcing it to be regenerated from the prefab's hierarchy on the next 
+		 * clone. Must be called whenever the hierarchy is modified.
+		 */
+		void clearInstantiationData();
+
 		HSceneObject mRoot;
 		UINT32 mHash;
 		String mUUID;
 		UINT32 mNextLinkId;
 
+		UINT8* mInstantiationData;
+		UINT32 mInstantiationDataSize;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
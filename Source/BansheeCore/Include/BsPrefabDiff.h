@@ -93,6 +93,13 @@ namespace BansheeEngine
 		 */
 		static SPtr<PrefabDiff> create(const HSceneObject& prefab, const HSceneObject& instance);
 
+		/**
+		 * Creates a new prefab diff containing the modifications required to revert the provided instanced scene object
+		 * hierarchy back to the state of the prefab scene object hierarchy. Apply the diff to @p instance to perform the 
+		 * revert.
+		 */
+		static SPtr<PrefabDiff> createRevert(const HSceneObject& prefab, const HSceneObject& instance);
+
 		/**
 		 * Applies the internal prefab diff to the provided object. The object should have similar hierarchy as the prefab
 		 * the diff was created for, otherwise the results are undefined.
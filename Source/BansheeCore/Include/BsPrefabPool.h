@@ -0,0 +1,66 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsGameObject.h"
+#include "BsPrefab.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Scene
+	 *  @{
+	 */
+
+	/**
+	 * Keeps a set of inactive prefab instances that can be reused, instead of destroying instances and instantiating new
+	 * ones. Released instances are reverted back to the state of the prefab, modifying only the state that differs from 
+	 * the prefab. Useful for objects that get spawned and destroyed often.
+	 */
+	class BS_CORE_EXPORT PrefabPool
+	{
+	public:
+		/**
+		 * Creates a new pool for the provided prefab.
+		 *
+		 * @param[in]	prefab		Prefab whose instances to pool. 
+		 * @param[in]	initialSize	Number of instances to create up front.
+		 */
+		PrefabPool(const HPrefab& prefab, UINT32 initialSize = 0);
+		~PrefabPool();
+
+		/**
+		 * Returns an active instance of the prefab. Instance is taken from the pool if available, otherwise a new one
+		 * is instantiated. The returned hierarchy is parented to world root.
+		 */
+		HSceneObject instantiate();
+
+		/**
+		 * Returns an instance created by instantiate() back to the pool. The instance is reverted to the prefab's state,
+		 * deactivated and parented to world root. Caller must not use the instance after it has been released.
+		 */
+		void release(const HSceneObject& instance);
+
+		/** Destroys all instances currently in the pool. Instances not currently in the pool are unaffected. */
+		void clear();
+
+		/** Returns the number of inactive instances currently in the pool. */
+		UINT32 getNumPooled() const { return (UINT32)mPooled.size(); }
+
+		/** Returns the prefab whose instances are pooled. */
+		const HPrefab& getPrefab() const { return mPrefab; }
+
+	private:
+		/** 
+		 * Checks if the prefab changed since the pooled instances were created, and if so destroys them. Returns false if
+		 * the prefab isn't loaded. 
+		 */
+		bool checkPrefabHash();
+
+		HPrefab mPrefab;
+		UINT32 mPrefabHash;
+		Vector<HSceneObject> mPooled;
+	};
+
+	/** @} */
+}
@@ -18,7 +18,11 @@ namespace BansheeEngine
 	{
 	private:
 		SPtr<SceneObject> getSceneObject(Prefab* obj) { return obj->mRoot.getInternalPtr(); }
-		void setSceneObject(Prefab* obj, SPtr<SceneObject> value) { obj->mRoot = value->getHandle(); }
+		void setSceneObject(Prefab* obj, SPtr<SceneObject> value)
+		{
+			obj->mRoot = value->getHandle();
+			obj->clearInstantiationData();
+		}
 
 		UINT32& getHash(Prefab* obj) { return obj->mHash; }
 		void setHash(Prefab* obj, UINT32& val) { obj->mHash = val; }
@@ -0,0 +1,126 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/** Flags that describe how an entry in a ResourcePackage is stored. */
+	enum class ResourcePackageEntryFlag
+	{
+		/** No flags. */
+		None = 0,
+		/**
+		 * Entry data is compressed. Reserved in the format, but packages are currently always written uncompressed as
+		 * the engine doesn't ship with a compression codec. Loading a compressed entry will fail.
+		 */
+		Compressed = 1 << 0
+	};
+
+	typedef Flags<ResourcePackageEntryFlag> ResourcePackageEntryFlags;
+	BS_FLAGS_OPERATORS(ResourcePackageEntryFlag);
+
+	/** Information about a single resource that should be stored in a ResourcePackage. */
+	struct RESOURCE_PACKAGE_ENTRY_DESC
+	{
+		String uuid; /**< UUID of the resource. */
+		Path filePath; /**< Path to the saved resource file (as written by Resources::save()). */
+	};
+
+	/**
+	 * Archive containing many saved resources stored contiguously in a single file. Used by shipping builds to avoid
+	 * opening a separate file for each resource.
+	 *
+	 * Package starts with a header, followed by the data of each entry (aligned to the package alignment), and ends with
+	 * a table of contents sorted by resource UUID so individual entries can be found using a binary search. The package
+	 * file is mapped into memory when loaded and entries are read directly from the mapping.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT ResourcePackage
+	{
+		struct ConstructPrivately {};
+
+		/** Header written at the start of the package file. */
+		struct Header
+		{
+			UINT32 magic;
+			UINT32 version;
+			UINT32 numEntries;
+			UINT32 alignment;
+			UINT64 tocOffset;
+		};
+
+		/** Entry in the table of contents. */
+		struct TOCEntry
+		{
+			char uuid[36];
+			UINT32 flags;
+			UINT64 offset;
+			UINT64 size;
+		};
+
+	public:
+		ResourcePackage(const ConstructPrivately& dummy, const Path& filePath);
+
+		/** Returns the path of the package file. */
+		const Path& getPath() const { return mPath; }
+
+		/** Returns the number of resources stored in the package. */
+		UINT32 getNumEntries() const { return mNumEntries; }
+
+		/** Checks if the package contains a resource with the specified UUID. */
+		bool contains(const String& uuid) const;
+
+		/**
+		 * Opens a stream to the saved resource data of the resource with the specified UUID. The data is in the same
+		 * format as a resource file written by Resources::save(). Returns null if the package doesn't contain the resource.
+		 *
+		 * @note	Stream references the mapped package memory directly and keeps the mapping alive while in use.
+		 */
+		SPtr<DataStream> openEntry(const String& uuid) const;
+
+		/**
+		 * Loads a package from the specified location. Returns null if the file doesn't exist or isn't a valid package.
+		 */
+		static SPtr<ResourcePackage> load(const Path& filePath);
+
+		/**
+		 * Creates a new package containing the provided resources and saves it at the specified location.
+		 *
+		 * @param[in]	resources	Resources to store in the package. Entries with invalid UUIDs, missing files or
+		 *							files larger than 4 GB are skipped.
+		 * @param[in]	filePath	Location to save the package to. Any existing file will be overwritten.
+		 * @param[in]	alignment	Alignment in bytes of the data of each entry. Must be a power of two. Aligning the
+		 *							entries to page size allows the OS to map only the pages belonging to the resources
+		 *							being loaded.
+		 * @return					True if the package was successfully written.
+		 */
+		static bool create(const Vector<RESOURCE_PACKAGE_ENTRY_DESC>& resources, const Path& filePath,
+			UINT32 alignment = DEFAULT_ALIGNMENT);
+
+		/** Default alignment of entries in the package. */
+		static const UINT32 DEFAULT_ALIGNMENT = 4096;
+
+	private:
+		/** Returns the table of contents entry for the resource with the specified UUID, or null if not found. */
+		const TOCEntry* findEntry(const String& uuid) const;
+
+		static const UINT32 MAGIC = 0x4B504253; // "SBPK"
+		static const UINT32 VERSION = 1;
+		static const UINT32 UUID_LENGTH = 36;
+		static const UINT64 MAX_ENTRY_SIZE = 0xFFFFFFFF;
+
+		Path mPath;
+		SPtr<MemoryMappedDataStream> mData;
+		const TOCEntry* mEntries;
+		UINT32 mNumEntries;
+	};
+
+	/** @} */
+}
@@ -237,6 +237,19 @@ namespace BansheeEngine
 		/**	Unregisters a resource manifest previously registered with registerResourceManifest(). */
 		void unregisterResourceManifest(const SPtr<ResourceManifest>& manifest);
 
+		/**
+		 * Registers a resource package. Resources loaded by UUID will be read from the package if it contains them,
+		 * instead of being looked up in the registered resource manifests. Resources loaded by path are read from the
+		 * package if a registered manifest maps the path to a UUID the package contains. Packages registered later take
+		 * priority.
+		 *
+		 * @see		ResourcePackage
+		 */
+		void registerResourcePackage(const SPtr<ResourcePackage>& package);
+
+		/**	Unregisters a resource package previously registered with registerResourcePackage(). */
+		void unregisterResourcePackage(const SPtr<ResourcePackage>& package);
+
 		/**
 		 * Allows you to retrieve resource manifest containing UUID <-> file path mapping that is used when resolving 
 		 * resource references.
@@ -299,18 +312,27 @@ namespace BansheeEngine
 		/**
 		 * Starts resource loading or returns an already loaded resource. Both UUID and filePath must match the	same 
 		 * resource, although you may provide an empty path in which case the resource will be retrieved from memory if its
-		 * currently loaded.
+		 * currently loaded. If a package is provided the resource is read from the package instead of the file path.
+		 */
+		HResource loadInternal(const String& UUID, const Path& filePath, const SPtr<ResourcePackage>& package, 
+			bool synchronous, ResourceLoadFlags loadFlags);
+
+		/**
+		 * Performs actually reading and deserializing of the resource file, or of the package entry if a package is
+		 * provided. Called from various worker threads.
 		 */
-		HResource loadInternal(const String& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags);
+		SPtr<Resource> loadFromDiskAndDeserialize(const String& UUID, const Path& filePath, 
+			const SPtr<ResourcePackage>& package, bool loadWithSaveData);
 
-		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
-		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData);
+		/** Returns the most recently registered package containing the resource with the specified UUID, or null. */
+		SPtr<ResourcePackage> findPackage(const String& uuid) const;
 
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource);
 
 		/**	Callback triggered when the task manager is ready to process the loading task. */
-		void loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData);
+		void loadCallback(const Path& filePath, const SPtr<ResourcePackage>& package, HResource& resource, 
+			bool loadWithSaveData);
 
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
@@ -318,9 +340,11 @@ namespace BansheeEngine
 	private:
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
+		Vector<SPtr<ResourcePackage>> mResourcePackages;
 
 		Mutex mInProgressResourcesMutex;
 		Mutex mLoadedResourceMutex;
+		mutable Mutex mResourcePackagesMutex;
 
 		UnorderedMap<String, WeakResourceHandle<Resource>> mHandles;
 		UnorderedMap<String, LoadedResourceData> mLoadedResources;
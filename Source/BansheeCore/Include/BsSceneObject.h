@@ -29,6 +29,14 @@ namespace BansheeEngine
 										 user created ones. */
 	};
 
+	/** New world space position and rotation of a scene object, used for bulk transform updates. */
+	struct SceneObjectTransformUpdate
+	{
+		SceneObject* sceneObject;
+		Vector3 position;
+		Quaternion rotation;
+	};
+
 	/**
 	 * An object in the scene graph. It has a world position, place in the hierarchy and optionally a number of attached 
 	 * components.
@@ -43,6 +51,7 @@ namespace BansheeEngine
 		};
 
 		friend class CoreSceneManager;
+		friend class TransformHierarchy;
 		friend class Prefab;
 		friend class PrefabDiff;
 		friend class PrefabUtility;
@@ -128,6 +137,20 @@ namespace BansheeEngine
 		/** Assigns a new prefab diff object. Caller must ensure the prefab diff was generated for this object. */
 		void _setPrefabDiff(const SPtr<PrefabDiff>& diff) { mPrefabDiff = diff; }
 
+		/**
+		 * Assigns new world positions and rotations to a set of scene objects. Equivalent to calling setWorldPosition()
+		 * and setWorldRotation() on each object, except that all transforms are assigned first, and objects are then
+		 * notified of the change once each. When the transforms are stored in a TransformHierarchy entries are processed
+		 * in storage order.
+		 *
+		 * @param[in, out]	updates		Objects to update along with their new world transforms. Entries will be re-ordered.
+		 * @param[in]		count		Number of entries in @p updates.
+		 * @param[in]		parallel	If true, local transforms of large sets of objects will be calculated on multiple
+		 *								threads. Objects that are descendants of other objects in the set are always 
+		 *								processed on the calling thread.
+		 */
+		static void _setWorldTransforms(SceneObjectTransformUpdate* updates, UINT32 count, bool parallel);
+
 		/** @} */
 
 	private:
@@ -352,6 +375,23 @@ namespace BansheeEngine
 		mutable UINT32 mDirtyFlags;
 		mutable UINT32 mDirtyHash;
 
+		TransformHierarchy* mTfrmHierarchy;
+		UINT32 mTfrmIdx;
+		UINT32 mTfrmGeneration;
+		UINT32 mTfrmUpdateStamp; /**< Identifies the last bulk transform update the object was part of. */
+
+		/** 
+		 * Checks are the transforms of this object stored in a TransformHierarchy. If true, world transform accessors are 
+		 * served from there, instead of the object's own cache.
+		 */
+		bool isTfrmManaged() const;
+
+		/** 
+		 * Notifies the transform hierarchy (if any) that this object was added, removed or re-parented. Must be called 
+		 * after the parent is changed.
+		 */
+		void notifyTfrmHierarchyChanged();
+
 		/** 
 		 * Notifies components and child scene object that a transform has been changed.  
 		 * 
@@ -359,6 +399,24 @@ namespace BansheeEngine
 		 */
 		void notifyTransformChanged(TransformChangedFlags flags) const;
 
+		/** Marks the cached transforms as dirty, without notifying components or child objects. */
+		void markTfrmDirty() const;
+
+		/** 
+		 * Marks the object's own transform caches as dirty. Unlike markTfrmDirty() doesn't touch the transform hierarchy,
+		 * as it is meant to be used when a parent transform changes.
+		 */
+		void markCachedTfrmDirty() const;
+
+		/** Notifies components and child scene objects that a transform has been changed. See notifyTransformChanged(). */
+		void notifyTfrmListeners(TransformChangedFlags flags) const;
+
+		/** 
+		 * Converts the provided world position and rotation into local space and assigns them, without notifying anyone
+		 * of the change. Parent world transform must be up to date.
+		 */
+		void setWorldTfrmNoNotify(const Vector3& position, const Quaternion& rotation);
+
 		/** Updates the local transform. Normally just reconstructs the transform matrix from the position/rotation/scale. */
 		void updateLocalTfrm() const;
 
@@ -489,6 +547,12 @@ namespace BansheeEngine
 		/** Changes the object active in hierarchy state, and triggers necessary events. */
 		void setActiveHierarchy(bool active, bool triggerEvents = true);
 
+		/** Triggers the enabled event on the component, and registers it for updates if the object is in the scene. */
+		void enableComponent(const HComponent& component);
+
+		/** Triggers the disabled event on the component, and stops it from receiving updates. */
+		void disableComponent(const HComponent& component);
+
 		/************************************************************************/
 		/* 								Component	                     		*/
 		/************************************************************************/
@@ -516,7 +580,7 @@ namespace BansheeEngine
 				newComponent->onInitialized();
 
 				if (getActive())
-					newComponent->onEnabled();
+					enableComponent(newComponent);
 			}
 
 			return newComponent;
@@ -642,6 +706,12 @@ namespace BansheeEngine
 		/**	Adds the component to the internal component array. */
 		void addComponentInternal(const SPtr<Component> component);
 
+		/**
+		 * Adds the component to the internal component array, and if this object is instantiated initializes the component
+		 * and (if active) enables it, same as addComponent(). 
+		 */
+		void addAndInitializeComponent(const SPtr<Component> component);
+
 		Vector<HComponent> mComponents;
 
 		/************************************************************************/
@@ -37,9 +37,10 @@ namespace BansheeEngine
 			 *
 			 * @param[in]	charIdx		Sequential index of the character in the original string.
 			 * @param[in]	desc		Character description from the font.
+			 * @param[in]	fontData	Font the character belongs to.
 			 * @return					How many pixels did the added character expand the word by.
 			 */
-			UINT32 addChar(UINT32 charIdx, const CHAR_DESC& desc);
+			UINT32 addChar(UINT32 charIdx, const CHAR_DESC& desc, const FontBitmap& fontData);
 
 			/** Adds a space to the word. Word must have previously have been declared as a "spacer". */
 			void addSpace(UINT32 spaceWidth);
@@ -53,10 +54,11 @@ namespace BansheeEngine
 			/**
 			 * Calculates new width of the word if we were to add the provided character, without actually adding it.
 			 *
-			 * @param[in]	desc	Character description from the font.
-			 * @return				Width of the word in pixels with the character appended to it.
+			 * @param[in]	desc		Character description from the font.
+			 * @param[in]	fontData	Font the character belongs to.
+			 * @return					Width of the word in pixels with the character appended to it.
 			 */
-			UINT32 calcWidthWithChar(const CHAR_DESC& desc);
+			UINT32 calcWidthWithChar(const CHAR_DESC& desc, const FontBitmap& fontData);
 
 			/**
 			 * Returns true if word is a spacer. Spacers contain just a space of a certain length with no actual characters.
@@ -77,9 +79,10 @@ namespace BansheeEngine
 			 *
 			 * @param[in]	prevDesc	Descriptor of the character preceding the one we need the width for. Can be null.
 			 * @param[in]	desc		Character description from the font.
+			 * @param[in]	fontData	Font the characters belong to. Used for looking up kerning between the characters.
 			 * @return 					How many pixels would the added character expand the word by.
 			 */
-			static UINT32 calcCharWidth(const CHAR_DESC* prevDesc, const CHAR_DESC& desc);
+			static UINT32 calcCharWidth(const CHAR_DESC* prevDesc, const CHAR_DESC& desc, const FontBitmap& fontData);
 
 		private:
 			UINT32 mCharsStart, mCharsEnd;
@@ -245,6 +248,26 @@ namespace BansheeEngine
 		/**	Returns the height of the actual text in pixels. */
 		BS_CORE_EXPORT UINT32 getHeight() const;
 
+		/**	Returns the font data the text was generated from. Null if the font has no data to render the text with. */
+		BS_CORE_EXPORT const SPtr<const FontBitmap>& getFontData() const { return mFontData; }
+
+		/**
+		 * Returns how many layouts generated on the calling thread were restored from the layout cache (hits), and how
+		 * many had to be generated (misses). @p numCollisions is the number of misses that found a cached layout with
+		 * the same hash but different parameters.
+		 *
+		 * @note	Internal method.
+		 */
+		BS_CORE_EXPORT static void _getLayoutCacheStats(UINT32& numHits, UINT32& numMisses, UINT32& numCollisions);
+
+		/**
+		 * Sets a mask that is applied to the hashes of layouts generated on the calling thread. Any mask other than
+		 * the default (all bits set) introduces hash collisions, so this should only be used for testing.
+		 *
+		 * @note	Internal method.
+		 */
+		BS_CORE_EXPORT static void _setLayoutHashMask(size_t mask);
+
 	protected:
 		/**
 		 * Copies internally stored data in temporary buffers to a persistent buffer.
@@ -292,6 +315,22 @@ namespace BansheeEngine
 
 		// Static buffers used to reduce runtime memory allocation
 	protected:
+		/** Words, lines and page infos generated for a specific piece of text, along with the layout parameters used. */
+		struct CachedLayout
+		{
+			WString text;
+			std::weak_ptr<const FontBitmap> fontData;
+			UINT32 width;
+			bool wordWrap;
+			bool wordBreak;
+
+			Vector<TextWord> words;
+			Vector<TextLine> lines;
+			Vector<PageInfo> pageInfos;
+
+			List<size_t>::iterator usageIter;
+		};
+
 		/** Stores per-thread memory buffers used to reduce memory allocation. */
 		// Note: I could replace this with the global frame allocator to avoid the extra logic
 		struct BufferData
@@ -319,6 +358,26 @@ namespace BansheeEngine
 			/**	Resets all allocation counters, but doesn't actually release memory. */
 			void deallocAll();
 
+			/**
+			 * Looks for a layout previously stored by storeLayout() with the same parameters and, if found, copies its 
+			 * words, lines and page infos into the (empty) temporary buffers.
+			 *
+			 * @return	True if the layout was found, false otherwise.
+			 */
+			bool restoreLayout(const WString& text, const SPtr<const FontBitmap>& fontData, UINT32 width, bool wordWrap, 
+				bool wordBreak);
+
+			/** 
+			 * Stores the contents of the temporary buffers so they can be restored by future calls to restoreLayout() with
+			 * the same parameters. If the cache is full, the least recently used layout is discarded.
+			 */
+			void storeLayout(const WString& text, const SPtr<const FontBitmap>& fontData, UINT32 width, bool wordWrap, 
+				bool wordBreak);
+
+			/** Generates a hash used for looking up a cached layout with the provided parameters. */
+			static size_t getLayoutHash(const WString& text, const FontBitmap* fontData, UINT32 width, bool wordWrap, 
+				bool wordBreak);
+
 			TextWord* WordBuffer;
 			UINT32 WordBufferSize;
 			UINT32 NextFreeWord;
@@ -330,8 +389,18 @@ namespace BansheeEngine
 			PageInfo* PageBuffer;
 			UINT32 PageBufferSize;
 			UINT32 NextFreePageInfo;
+
+			UnorderedMap<size_t, CachedLayout> LayoutCache;
+			List<size_t> LayoutUsage; // Most recently used layout hash first
+			size_t LayoutHashMask;
+
+			UINT32 NumLayoutHits;
+			UINT32 NumLayoutMisses;
+			UINT32 NumLayoutCollisions;
 		};
 
+		static const UINT32 MAX_CACHED_LAYOUTS;
+
 		static BS_THREADLOCAL BufferData* MemBuffer;
 
 		/**	Allocates an initial set of buffers that will be reused while parsing text data. */
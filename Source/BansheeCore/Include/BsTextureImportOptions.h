@@ -39,6 +39,18 @@ namespace BansheeEngine
 		 */
 		void setSRGB(bool sRGB) { mSRGB = sRGB; }
 
+		/** Sets the filter to use when downsampling the texture into mipmaps. */
+		void setMipmapFilter(MipMapFilter filter) { mMipFilter = filter; }
+
+		/**
+		 * Sets whether mipmap alpha should be scaled so that the fraction of pixels passing the alpha test stays the same
+		 * as in the full size texture. Prevents alpha tested geometry (e.g. foliage) from thinning out in the distance.
+		 */
+		void setPreserveAlphaCoverage(bool preserve) { mPreserveAlphaCoverage = preserve; }
+
+		/** Sets the alpha test reference value used when preserving alpha coverage. */
+		void setAlphaCoverageCutoff(float cutoff) { mAlphaCoverageCutoff = cutoff; }
+
 		/** Gets the pixel format to import as. */
 		PixelFormat getFormat() const { return mFormat; }
 
@@ -60,6 +72,18 @@ namespace BansheeEngine
 		 */
 		bool getSRGB() const { return mSRGB; }
 
+		/** Gets the filter to use when downsampling the texture into mipmaps. */
+		MipMapFilter getMipmapFilter() const { return mMipFilter; }
+
+		/**
+		 * Checks whether mipmap alpha should be scaled so that the fraction of pixels passing the alpha test stays the 
+		 * same as in the full size texture.
+		 */
+		bool getPreserveAlphaCoverage() const { return mPreserveAlphaCoverage; }
+
+		/** Gets the alpha test reference value used when preserving alpha coverage. */
+		float getAlphaCoverageCutoff() const { return mAlphaCoverageCutoff; }
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -74,6 +98,9 @@ namespace BansheeEngine
 		UINT32 mMaxMip;
 		bool mCPUReadable;
 		bool mSRGB;
+		MipMapFilter mMipFilter;
+		bool mPreserveAlphaCoverage;
+		float mAlphaCoverageCutoff;
 	};
 
 	/** @} */
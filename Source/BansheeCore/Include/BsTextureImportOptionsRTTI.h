@@ -31,6 +31,15 @@ namespace BansheeEngine
 		bool& getSRGB(TextureImportOptions* obj) { return obj->mSRGB; }
 		void setSRGB(TextureImportOptions* obj, bool& value) { obj->mSRGB = value; }
 
+		MipMapFilter& getMipFilter(TextureImportOptions* obj) { return obj->mMipFilter; }
+		void setMipFilter(TextureImportOptions* obj, MipMapFilter& value) { obj->mMipFilter = value; }
+
+		bool& getPreserveAlphaCoverage(TextureImportOptions* obj) { return obj->mPreserveAlphaCoverage; }
+		void setPreserveAlphaCoverage(TextureImportOptions* obj, bool& value) { obj->mPreserveAlphaCoverage = value; }
+
+		float& getAlphaCoverageCutoff(TextureImportOptions* obj) { return obj->mAlphaCoverageCutoff; }
+		void setAlphaCoverageCutoff(TextureImportOptions* obj, float& value) { obj->mAlphaCoverageCutoff = value; }
+
 	public:
 		TextureImportOptionsRTTI()
 		{
@@ -39,6 +48,11 @@ namespace BansheeEngine
 			addPlainField("mMaxMip", 2, &TextureImportOptionsRTTI::getMaxMip, &TextureImportOptionsRTTI::setMaxMip);
 			addPlainField("mCPUReadable", 3, &TextureImportOptionsRTTI::getCPUReadable, &TextureImportOptionsRTTI::setCPUReadable);
 			addPlainField("mSRGB", 4, &TextureImportOptionsRTTI::getSRGB, &TextureImportOptionsRTTI::setSRGB);
+			addPlainField("mMipFilter", 5, &TextureImportOptionsRTTI::getMipFilter, &TextureImportOptionsRTTI::setMipFilter);
+			addPlainField("mPreserveAlphaCoverage", 6, &TextureImportOptionsRTTI::getPreserveAlphaCoverage, 
+				&TextureImportOptionsRTTI::setPreserveAlphaCoverage);
+			addPlainField("mAlphaCoverageCutoff", 7, &TextureImportOptionsRTTI::getAlphaCoverageCutoff, 
+				&TextureImportOptionsRTTI::setAlphaCoverageCutoff);
 		}
 
 		const String& getRTTIName() override
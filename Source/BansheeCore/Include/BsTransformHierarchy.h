@@ -0,0 +1,194 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsVector3.h"
+#include "BsQuaternion.h"
+#include "BsMatrix4.h"
+#include <atomic>
+
+namespace BansheeEngine
+{
+	/** @addtogroup Scene-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Optional storage for the transforms of all scene objects in the scene. Transforms are stored in flat arrays where
+	 * each parent comes before all of its children. This allows world transforms to be updated in a single linear pass
+	 * without following any pointers.
+	 *
+	 * The storage starts out in depth-first order, where each sub-tree is contiguous and groups of top-level sub-trees can
+	 * be updated on multiple threads. Objects added to the scene or moved to a new parent are appended to the end of the
+	 * storage, and removed objects leave holes behind, so structural changes only touch the affected sub-tree. Once
+	 * enough of the storage is made up of holes and appended entries, or once it runs out of reserved space, it is 
+	 * rebuilt during the next update(). Until then any objects not in the storage fall back to their own transform 
+	 * caches.
+	 *
+	 * Changing a local transform only marks its own entry as dirty. Children notice the change by comparing the version
+	 * of their parent's world transform with the version they were last calculated from.
+	 *
+	 * While enabled, SceneObject world transform accessors are served from this storage.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT TransformHierarchy
+	{
+	public:
+		TransformHierarchy();
+
+		/** Enables or disables the transform storage. Disabled by default. */
+		void setEnabled(bool enabled);
+
+		/** Checks is the transform storage enabled. */
+		bool isEnabled() const { return mEnabled; }
+
+		/** Determines should update() split the work between multiple worker threads when there is enough of it. */
+		void setParallel(bool parallel) { mParallel = parallel; }
+
+		/** Checks is the update performed on multiple threads. See setParallel(). */
+		bool isParallel() const { return mParallel; }
+
+		/** Returns the number of transforms currently stored, including holes left behind by removed objects. */
+		UINT32 getNumEntries() const { return (UINT32)mParents.size(); }
+
+		/** Returns the number of times the storage was rebuilt from scratch. */
+		UINT32 getNumRebuilds() const { return mNumRebuilds; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Rebuilds the storage if required, and updates all dirty world transforms.
+		 *
+		 * @param[in]	root	Root of the scene hierarchy.
+		 */
+		void _update(const HSceneObject& root);
+
+		/** Invalidates the entire storage, forcing it to be rebuilt during the next update. */
+		void _notifyStructureChanged();
+
+		/**
+		 * Updates the storage after the provided scene object was assigned a new parent, or was removed from its parent.
+		 * Must be called after the object's parent was changed.
+		 */
+		void _notifyParentChanged(SceneObject* so);
+
+		/** Checks can the data stored at the time of the provided generation still be used. */
+		bool _isValid(UINT32 generation) const { return mEnabled && generation == mGeneration; }
+
+		/** Updates the local transform of the entry at the specified index, and marks its world transform as dirty. */
+		void _setLocal(UINT32 idx, const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+		/** Updates the world transform of the entry at the specified index (and its parents), if out of date. */
+		void _updateIfDirty(UINT32 idx)
+		{
+			if (!mUpToDate.load(std::memory_order_relaxed))
+				updateLazy(idx);
+		}
+
+		/**
+		 * Returns the world position of the entry at the specified index. Updates the world transform if dirty.
+		 *
+		 * @note	Returned reference only remains valid until the storage is modified.
+		 */
+		const Vector3& _getWorldPosition(UINT32 idx) { _updateIfDirty(idx); return mWorldPositions[idx]; }
+
+		/** @copydoc _getWorldPosition */
+		const Quaternion& _getWorldRotation(UINT32 idx) { _updateIfDirty(idx); return mWorldRotations[idx]; }
+
+		/** @copydoc _getWorldPosition */
+		const Vector3& _getWorldScale(UINT32 idx) { _updateIfDirty(idx); return mWorldScales[idx]; }
+
+		/** @copydoc _getWorldPosition */
+		const Matrix4& _getWorldTfrm(UINT32 idx) { _updateIfDirty(idx); return mWorldTfrms[idx]; }
+
+		/** @} */
+
+	private:
+		/** Minimum number of entries each worker thread needs to update, when parallel update is enabled. */
+		static const UINT32 MIN_ENTRIES_PER_TASK = 2048;
+
+		/** Minimum number of entries to reserve space for when rebuilding. */
+		static const UINT32 MIN_CAPACITY = 64;
+
+		/** Parent index of entries belonging to removed objects. */
+		static const INT32 REMOVED_ENTRY = -2;
+
+		/** Rebuilds the storage from the hierarchy starting at the provided root. */
+		void rebuild(const HSceneObject& root);
+
+		/** Clears all entries and invalidates any indices held by scene objects. */
+		void clear();
+
+		/** Reserves space for the provided number of entries. */
+		void reserve(UINT32 capacity);
+
+		/** 
+		 * Appends the provided object and all of its children to the end of the storage. Returns false if there was not
+		 * enough reserved space, in which case nothing is appended. 
+		 */
+		bool appendSubtree(SceneObject* so, INT32 parentIdx);
+
+		/** Marks entries of the provided object and all of its children as removed. */
+		void removeSubtree(SceneObject* so);
+
+		/** Checks is the provided scene object stored in this storage. */
+		bool contains(const SceneObject* so) const;
+
+		/** Notifies the storage that some world transforms might be out of date. */
+		void markOutOfDate() { mUpToDate.store(false, std::memory_order_relaxed); }
+
+		/** Updates all out of date world transforms in the provided range. Parents of the entries must be up to date. */
+		void updateRange(UINT32 start, UINT32 end);
+
+		/** Updates the world transform of the entry at the specified index, updating any out of date parents first. */
+		void updateLazy(UINT32 idx);
+
+		/** Checks does the entry need its world transform recalculated. Parent must be up to date. */
+		bool isOutOfDate(UINT32 idx) const
+		{
+			INT32 parentIdx = mParents[idx];
+			return mDirty[idx] || (parentIdx >= 0 && mParentVersions[idx] != mVersions[parentIdx]);
+		}
+
+		/** Calculates the world transform of the entry at the specified index. Parent must be up to date. */
+		void updateWorld(UINT32 idx);
+
+		bool mEnabled;
+		bool mParallel;
+		bool mRebuildRequired;
+		bool mGrowRequired;
+		UINT32 mGeneration;
+		UINT32 mNumRebuilds;
+
+		UINT32 mContiguousEnd; /**< Entries up to this index are in depth-first order. Later entries were appended. */
+		UINT32 mNumRemoved; /**< Number of entries belonging to removed objects. */
+
+		/** 
+		 * True if no transforms changed since the last update, in which case the lazy updates can be skipped. Atomic as
+		 * transforms of independent objects may be written from multiple threads, see SceneObject::_setWorldTransforms.
+		 */
+		std::atomic<bool> mUpToDate;
+
+		Vector<INT32> mParents;
+		Vector<UINT32> mRootSubtrees; /**< Start indices of the depth-first ordered sub-trees of the root's children. */
+
+		Vector<Vector3> mLocalPositions;
+		Vector<Quaternion> mLocalRotations;
+		Vector<Vector3> mLocalScales;
+
+		Vector<Vector3> mWorldPositions;
+		Vector<Quaternion> mWorldRotations;
+		Vector<Vector3> mWorldScales;
+		Vector<Matrix4> mWorldTfrms;
+
+		Vector<UINT8> mDirty; /**< Set when the local transform changes. */
+		Vector<UINT32> mVersions; /**< Incremented whenever the world transform is recalculated. */
+		Vector<UINT32> mParentVersions; /**< Version of the parent's world transform this entry was calculated from. */
+	};
+
+	/** @} */
+}
@@ -0,0 +1,433 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsAudioMixer.h"
+#include "BsDataStream.h"
+#include "BsFileSystem.h"
+#include "BsMath.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define BS_AUDIO_SSE 1
+#	include <emmintrin.h>
+#else
+#	define BS_AUDIO_SSE 0
+#endif
+
+namespace BansheeEngine
+{
+	NullAudioSink::NullAudioSink()
+		:mNumFrames(0)
+	{ }
+
+	void NullAudioSink::write(const float* samples, UINT32 numFrames)
+	{
+		mNumFrames += numFrames;
+	}
+
+	WaveFileAudioSink::WaveFileAudioSink(const Path& path, UINT32 sampleRate)
+		:mSampleRate(sampleRate), mNumFrames(0)
+	{
+		mStream = FileSystem::createAndOpenFile(path);
+
+		// Reserve space for the header, it gets written once the amount of data is known
+		if (mStream != nullptr)
+			writeHeader();
+	}
+
+	WaveFileAudioSink::~WaveFileAudioSink()
+	{
+		if (mStream == nullptr)
+			return;
+
+		mStream->seek(0);
+		writeHeader();
+		mStream->close();
+	}
+
+	void WaveFileAudioSink::write(const float* samples, UINT32 numFrames)
+	{
+		if (mStream == nullptr)
+			return;
+
+		static const UINT32 FRAMES_PER_CHUNK = 1024;
+		INT16 buffer[FRAMES_PER_CHUNK * 2];
+
+		UINT32 numRemaining = numFrames;
+		while (numRemaining > 0)
+		{
+			UINT32 numChunkFrames = std::min(numRemaining, FRAMES_PER_CHUNK);
+			for (UINT32 i = 0; i < numChunkFrames * 2; i++)
+				buffer[i] = (INT16)(Math::clamp(samples[i], -1.0f, 1.0f) * 32767.0f);
+
+			mStream->write(buffer, numChunkFrames * 2 * sizeof(INT16));
+
+			samples += numChunkFrames * 2;
+			numRemaining -= numChunkFrames;
+		}
+
+		mNumFrames += numFrames;
+	}
+
+	void WaveFileAudioSink::writeHeader()
+	{
+		UINT32 dataSize = mNumFrames * 2 * sizeof(INT16);
+
+		UINT8 header[44];
+		auto writeUINT32 = [&](UINT32 offset, UINT32 value) { memcpy(header + offset, &value, sizeof(value)); };
+		auto writeUINT16 = [&](UINT32 offset, UINT16 value) { memcpy(header + offset, &value, sizeof(value)); };
+
+		memcpy(header + 0, "RIFF", 4);
+		writeUINT32(4, 36 + dataSize);
+		memcpy(header + 8, "WAVE", 4);
+
+		memcpy(header + 12, "fmt ", 4);
+		writeUINT32(16, 16); // Format chunk size
+		writeUINT16(20, 1); // PCM
+		writeUINT16(22, 2); // Number of channels
+		writeUINT32(24, mSampleRate);
+		writeUINT32(28, mSampleRate * 2 * sizeof(INT16)); // Bytes per second
+		writeUINT16(32, 2 * sizeof(INT16)); // Bytes per frame
+		writeUINT16(34, 16); // Bits per sample
+
+		memcpy(header + 36, "data", 4);
+		writeUINT32(40, dataSize);
+
+		mStream->write(header, sizeof(header));
+	}
+
+	const float AudioMixer::MIN_AUDIBLE_GAIN = 0.0005f;
+
+	AudioMixer::AudioMixer(UINT32 sampleRate, UINT32 maxVoices)
+		:mSampleRate(sampleRate), mMaxVoices(maxVoices), mVolume(1.0f), mNumAudibleVoices(0)
+	{ }
+
+	void AudioMixer::setVolume(float volume)
+	{
+		mVolume = Math::clamp01(volume);
+	}
+
+	void AudioMixer::mix(AudioMixerVoice* const* voices, UINT32 numVoices, const AudioMixerListener* listeners,
+		UINT32 numListeners, UINT32 numFrames)
+	{
+		AudioMixerListener defaultListener;
+		if (numListeners == 0)
+		{
+			listeners = &defaultListener;
+			numListeners = 1;
+		}
+
+		while (numFrames > 0)
+		{
+			UINT32 numBlockFrames = std::min(numFrames, BLOCK_SIZE);
+			mixBlock(voices, numVoices, listeners, numListeners, numBlockFrames);
+
+			numFrames -= numBlockFrames;
+		}
+	}
+
+	void AudioMixer::mixBlock(AudioMixerVoice* const* voices, UINT32 numVoices, const AudioMixerListener* listeners,
+		UINT32 numListeners, UINT32 numFrames)
+	{
+		memset(mMixBuffers, 0, sizeof(mMixBuffers));
+
+		// Find out how loud each voice is, and virtualize the ones that can't be heard
+		mAudibleVoices.clear();
+		for (UINT32 i = 0; i < numVoices; i++)
+		{
+			AudioMixerVoice* voice = voices[i];
+			if (!voice->playing)
+				continue;
+
+			AudibleVoice entry;
+			entry.voice = voice;
+			entry.loudness = 0.0f;
+
+			for (UINT32 j = 0; j < numListeners; j++)
+			{
+				float gains[2];
+				calculateGains(*voice, listeners[j], gains);
+
+				float loudness = std::max(gains[0], gains[1]);
+				if (j == 0 || loudness > entry.loudness)
+				{
+					entry.gains[0] = gains[0];
+					entry.gains[1] = gains[1];
+					entry.loudness = loudness;
+				}
+			}
+
+			if (entry.loudness < MIN_AUDIBLE_GAIN || voice->samples == nullptr || voice->numFrames == 0)
+			{
+				virtualize(*voice, numFrames);
+				continue;
+			}
+
+			mAudibleVoices.push_back(entry);
+		}
+
+		// Keep only the most important voices
+		if ((UINT32)mAudibleVoices.size() > mMaxVoices)
+		{
+			auto isMoreImportant = [](const AudibleVoice& a, const AudibleVoice& b)
+			{
+				if (a.voice->priority != b.voice->priority)
+					return a.voice->priority > b.voice->priority;
+
+				return a.loudness > b.loudness;
+			};
+
+			std::nth_element(mAudibleVoices.begin(), mAudibleVoices.begin() + mMaxVoices, mAudibleVoices.end(),
+				isMoreImportant);
+
+			for (UINT32 i = mMaxVoices; i < (UINT32)mAudibleVoices.size(); i++)
+				virtualize(*mAudibleVoices[i].voice, numFrames);
+
+			mAudibleVoices.resize(mMaxVoices);
+		}
+
+		for (auto& entry : mAudibleVoices)
+		{
+			AudioMixerVoice* voice = entry.voice;
+
+			mixVoice(*voice, entry.gains, numFrames);
+			voice->isVirtual = false;
+
+			advance(*voice, numFrames);
+		}
+
+		mNumAudibleVoices = (UINT32)mAudibleVoices.size();
+
+		// Apply global volume, clamp and interleave
+		const float* left = mMixBuffers[0];
+		const float* right = mMixBuffers[1];
+
+		UINT32 i = 0;
+#if BS_AUDIO_SSE
+		const __m128 volume = _mm_set1_ps(mVolume);
+		const __m128 minValue = _mm_set1_ps(-1.0f);
+		const __m128 maxValue = _mm_set1_ps(1.0f);
+
+		for (; i + 4 <= numFrames; i += 4)
+		{
+			__m128 l = _mm_mul_ps(_mm_loadu_ps(left + i), volume);
+			__m128 r = _mm_mul_ps(_mm_loadu_ps(right + i), volume);
+
+			l = _mm_min_ps(_mm_max_ps(l, minValue), maxValue);
+			r = _mm_min_ps(_mm_max_ps(r, minValue), maxValue);
+
+			_mm_storeu_ps(mOutputBuffer + i * 2, _mm_unpacklo_ps(l, r));
+			_mm_storeu_ps(mOutputBuffer + i * 2 + 4, _mm_unpackhi_ps(l, r));
+		}
+#endif
+
+		for (; i < numFrames; i++)
+		{
+			mOutputBuffer[i * 2 + 0] = Math::clamp(left[i] * mVolume, -1.0f, 1.0f);
+			mOutputBuffer[i * 2 + 1] = Math::clamp(right[i] * mVolume, -1.0f, 1.0f);
+		}
+
+		if (mSink != nullptr)
+			mSink->write(mOutputBuffer, numFrames);
+	}
+
+	void AudioMixer::calculateGains(const AudioMixerVoice& voice, const AudioMixerListener& listener, float* gains)
+	{
+		// Equal power panning, so the voice is equally loud no matter the direction
+		static const float CENTER_GAIN = std::sqrt(0.5f);
+
+		if (!voice.is3D)
+		{
+			float gain = voice.numChannels == 1 ? voice.volume * CENTER_GAIN : voice.volume;
+
+			gains[0] = gain;
+			gains[1] = gain;
+			return;
+		}
+
+		// Inverse distance attenuation, clamped at the minimum distance
+		Vector3 toVoice = voice.position - listener.position;
+		float distance = toVoice.length();
+
+		float clampedDistance = std::max(distance, voice.minDistance);
+		float denominator = voice.minDistance + voice.attenuation * (clampedDistance - voice.minDistance);
+
+		float gain = voice.volume;
+		if (denominator > 0.0f)
+			gain *= voice.minDistance / denominator;
+
+		// Only mono voices can be panned
+		if (voice.numChannels != 1)
+		{
+			gains[0] = gain;
+			gains[1] = gain;
+			return;
+		}
+
+		float pan = 0.0f;
+		if (distance > 0.0001f)
+		{
+			Vector3 right = Vector3::normalize(listener.direction.cross(listener.up));
+			pan = Math::clamp(right.dot(toVoice) / distance, -1.0f, 1.0f);
+		}
+
+		float angle = (pan + 1.0f) * Math::PI * 0.25f;
+		gains[0] = gain * Math::cos(angle);
+		gains[1] = gain * Math::sin(angle);
+	}
+
+	void AudioMixer::mixVoice(AudioMixerVoice& voice, const float* gains, UINT32 numFrames)
+	{
+		float step = std::max(voice.pitch, 0.0f) * voice.sampleRate / (float)mSampleRate;
+
+		float startGains[2] = { voice.gains[0], voice.gains[1] };
+		float gainSteps[2] =
+		{
+			(gains[0] - startGains[0]) / numFrames,
+			(gains[1] - startGains[1]) / numFrames
+		};
+
+		UINT32 stride = voice.numChannels;
+		UINT32 rightChannel = voice.numChannels > 1 ? 1 : 0;
+		bool isMono = rightChannel == 0;
+
+		float* left = mMixBuffers[0];
+		float* right = mMixBuffers[1];
+
+		// Common case where all read samples are within the sample data, so no wrapping or end checks are needed. Extra
+		// sample of margin accounts for positions below being calculated with lower precision.
+		double lastPosition = voice.playPosition + (double)(numFrames - 1) * step;
+		if ((UINT64)lastPosition + 2 < voice.numFrames)
+		{
+			UINT32 base = (UINT32)voice.playPosition;
+			float baseFraction = (float)(voice.playPosition - base);
+			const float* src = voice.samples + base * stride;
+
+			UINT32 i = 0;
+#if BS_AUDIO_SSE
+			const __m128 laneOffsets = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+			const __m128 step4 = _mm_set1_ps(step);
+			const __m128 baseFraction4 = _mm_set1_ps(baseFraction);
+			const __m128 startGainL = _mm_set1_ps(startGains[0]);
+			const __m128 startGainR = _mm_set1_ps(startGains[1]);
+			const __m128 gainStepL = _mm_set1_ps(gainSteps[0]);
+			const __m128 gainStepR = _mm_set1_ps(gainSteps[1]);
+
+			for (; i + 4 <= numFrames; i += 4)
+			{
+				__m128 frame = _mm_add_ps(_mm_set1_ps((float)i), laneOffsets);
+				__m128 position = _mm_add_ps(baseFraction4, _mm_mul_ps(frame, step4));
+
+				__m128i index = _mm_cvttps_epi32(position);
+				__m128 fraction = _mm_sub_ps(position, _mm_cvtepi32_ps(index));
+
+				INT32 indices[4];
+				_mm_storeu_si128((__m128i*)indices, index);
+
+				const float* s0 = src + indices[0] * stride;
+				const float* s1 = src + indices[1] * stride;
+				const float* s2 = src + indices[2] * stride;
+				const float* s3 = src + indices[3] * stride;
+
+				__m128 a = _mm_set_ps(s3[0], s2[0], s1[0], s0[0]);
+				__m128 b = _mm_set_ps(s3[stride], s2[stride], s1[stride], s0[stride]);
+				__m128 sampleL = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), fraction));
+
+				__m128 sampleR = sampleL;
+				if (!isMono)
+				{
+					a = _mm_set_ps(s3[1], s2[1], s1[1], s0[1]);
+					b = _mm_set_ps(s3[stride + 1], s2[stride + 1], s1[stride + 1], s0[stride + 1]);
+					sampleR = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), fraction));
+				}
+
+				__m128 gainL = _mm_add_ps(startGainL, _mm_mul_ps(frame, gainStepL));
+				__m128 gainR = _mm_add_ps(startGainR, _mm_mul_ps(frame, gainStepR));
+
+				_mm_storeu_ps(left + i, _mm_add_ps(_mm_loadu_ps(left + i), _mm_mul_ps(sampleL, gainL)));
+				_mm_storeu_ps(right + i, _mm_add_ps(_mm_loadu_ps(right + i), _mm_mul_ps(sampleR, gainR)));
+			}
+#endif
+
+			for (; i < numFrames; i++)
+			{
+				float position = baseFraction + i * step;
+				UINT32 index = (UINT32)position;
+				float fraction = position - index;
+
+				const float* s = src + index * stride;
+				float sampleL = s[0] + (s[stride] - s[0]) * fraction;
+				float sampleR = s[rightChannel] + (s[stride + rightChannel] - s[rightChannel]) * fraction;
+
+				left[i] += sampleL * (startGains[0] + i * gainSteps[0]);
+				right[i] += sampleR * (startGains[1] + i * gainSteps[1]);
+			}
+		}
+		else
+		{
+			for (UINT32 i = 0; i < numFrames; i++)
+			{
+				double position = voice.playPosition + (double)i * step;
+				if (position >= voice.numFrames)
+				{
+					if (!voice.loop)
+						break;
+
+					position = std::fmod(position, (double)voice.numFrames);
+				}
+
+				UINT32 index = (UINT32)position;
+				float fraction = (float)(position - index);
+
+				UINT32 nextIndex = index + 1;
+				if (nextIndex >= voice.numFrames)
+					nextIndex = voice.loop ? 0 : index;
+
+				const float* s0 = voice.samples + index * stride;
+				const float* s1 = voice.samples + nextIndex * stride;
+
+				float sampleL = s0[0] + (s1[0] - s0[0]) * fraction;
+				float sampleR = s0[rightChannel] + (s1[rightChannel] - s0[rightChannel]) * fraction;
+
+				left[i] += sampleL * (startGains[0] + i * gainSteps[0]);
+				right[i] += sampleR * (startGains[1] + i * gainSteps[1]);
+			}
+		}
+
+		voice.gains[0] = gains[0];
+		voice.gains[1] = gains[1];
+	}
+
+	void AudioMixer::virtualize(AudioMixerVoice& voice, UINT32 numFrames)
+	{
+		// Fade out voices that were heard during the last block, instead of cutting them off which would cause a click
+		if (!voice.isVirtual && voice.samples != nullptr && voice.numFrames > 0)
+		{
+			float gains[2] = { 0.0f, 0.0f };
+			mixVoice(voice, gains, numFrames);
+		}
+
+		voice.isVirtual = true;
+		voice.gains[0] = 0.0f;
+		voice.gains[1] = 0.0f;
+
+		advance(voice, numFrames);
+	}
+
+	void AudioMixer::advance(AudioMixerVoice& voice, UINT32 numFrames) const
+	{
+		float step = std::max(voice.pitch, 0.0f) * voice.sampleRate / (float)mSampleRate;
+
+		double position = voice.playPosition + (double)numFrames * step;
+		if (position >= voice.numFrames)
+		{
+			if (voice.loop && voice.numFrames > 0)
+				position = std::fmod(position, (double)voice.numFrames);
+			else
+			{
+				position = 0.0;
+				voice.playing = false;
+			}
+		}
+
+		voice.playPosition = position;
+	}
+}
\ No newline at end of file
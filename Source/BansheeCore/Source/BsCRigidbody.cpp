@@ -4,6 +4,7 @@
 #include "BsSceneObject.h"
 #include "BsCCollider.h"
 #include "BsCJoint.h"
+#include "BsPhysics.h"
 #include "BsCRigidbodyRTTI.h"
 
 using namespace std::placeholders;
@@ -482,6 +483,11 @@ namespace BansheeEngine
 #endif
 		}
 
+		// Don't update the transform if it's due to Physics update, as the physics object is already at (or, when 
+		// interpolating, ahead of) the new transform
+		if (gPhysics()._isUpdateInProgress())
+			return;
+
 		mInternal->setTransform(SO()->getWorldPosition(), SO()->getWorldRotation());
 
 		if (mParentJoint != nullptr)
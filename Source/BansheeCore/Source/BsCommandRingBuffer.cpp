@@ -0,0 +1,127 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCommandRingBuffer.h"
+#include <thread>
+
+namespace BansheeEngine
+{
+	CommandRingBuffer::CommandRingBuffer(UINT32 capacity)
+		: mBuffer(nullptr), mCapacity(0), mMaxInlineSize(0), mWritePos(0), mSubmitPos(0), mPendingSize(0), mPublishedPos(0), mReadPos(0)
+	{
+		mCapacity = std::max((capacity + ALIGNMENT - 1) & ~(ALIGNMENT - 1), HEADER_SIZE * 8);
+		mBuffer = (UINT8*)bs_alloc_aligned16(mCapacity);
+
+		// Limit command size so a command can always fit, even if the buffer needs to wrap around
+		mMaxInlineSize = mCapacity / 4 - HEADER_SIZE;
+	}
+
+	CommandRingBuffer::~CommandRingBuffer()
+	{
+		// Destroy commands that were never executed
+		destroyRange(mReadPos.load(std::memory_order_acquire), mWritePos);
+
+		bs_free_aligned16(mBuffer);
+	}
+
+	UINT8* CommandRingBuffer::allocate(UINT32 size)
+	{
+		// Keep every command aligned (this also guarantees there's always enough space for a wrap marker)
+		size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+		UINT64 readPos = mReadPos.load(std::memory_order_acquire);
+		UINT64 freeSpace = mCapacity - (mWritePos - readPos);
+
+		UINT32 offset = (UINT32)(mWritePos % mCapacity);
+		UINT32 spaceUntilEnd = mCapacity - offset;
+
+		// Commands must be contiguous, skip to the buffer start if it doesn't fit before the end
+		UINT32 padding = 0;
+		if (spaceUntilEnd < size)
+			padding = spaceUntilEnd;
+
+		if (freeSpace < (UINT64)(padding + size))
+			return nullptr;
+
+		if (padding > 0)
+		{
+			CommandHeader* wrapHeader = (CommandHeader*)(mBuffer + offset);
+			wrapHeader->invoke = nullptr;
+			wrapHeader->size = padding;
+
+			mWritePos += padding;
+			offset = 0;
+		}
+
+		CommandHeader* header = (CommandHeader*)(mBuffer + offset);
+		header->invoke = nullptr;
+		header->size = size;
+
+		mPendingSize = size;
+		return mBuffer + offset + HEADER_SIZE;
+	}
+
+	void CommandRingBuffer::commit(UINT8* data, void(*invokeFunc)(void*, bool))
+	{
+		CommandHeader* header = (CommandHeader*)(data - HEADER_SIZE);
+		header->invoke = invokeFunc;
+
+		mWritePos += mPendingSize;
+		mPendingSize = 0;
+	}
+
+	UINT64 CommandRingBuffer::submit()
+	{
+		mSubmitPos = mWritePos;
+		mPublishedPos.store(mSubmitPos);
+
+		return mSubmitPos;
+	}
+
+	void CommandRingBuffer::cancelAll()
+	{
+		destroyRange(mSubmitPos, mWritePos);
+		mWritePos = mSubmitPos;
+	}
+
+	void CommandRingBuffer::destroyRange(UINT64 start, UINT64 end)
+	{
+		UINT64 pos = start;
+		while (pos < end)
+		{
+			CommandHeader* header = (CommandHeader*)(mBuffer + (pos % mCapacity));
+			if (header->invoke != nullptr)
+				header->invoke((UINT8*)header + HEADER_SIZE, false);
+
+			pos += header->size;
+		}
+	}
+
+	void CommandRingBuffer::waitForSpace()
+	{
+		UINT64 readPos = mReadPos.load(std::memory_order_acquire);
+		while (readPos < mSubmitPos)
+		{
+			std::this_thread::yield();
+
+			UINT64 newReadPos = mReadPos.load(std::memory_order_acquire);
+			if (newReadPos != readPos)
+				break;
+		}
+	}
+
+	void CommandRingBuffer::playback(UINT64 end)
+	{
+		UINT64 pos = mReadPos.load(std::memory_order_relaxed);
+		while (pos < end)
+		{
+			CommandHeader* header = (CommandHeader*)(mBuffer + (pos % mCapacity));
+			if (header->invoke != nullptr)
+				header->invoke((UINT8*)header + HEADER_SIZE, true);
+
+			pos += header->size;
+
+			// Release each command individually, so the producer can start reusing the memory as soon as possible
+			mReadPos.store(pos, std::memory_order_release);
+		}
+	}
+}
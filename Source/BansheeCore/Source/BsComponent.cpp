@@ -6,8 +6,13 @@
 
 namespace BansheeEngine
 {
+	Component::Component()
+		:mNotifyFlags(TCF_None), mThreadSafeUpdate(false), mUpdateGroup((UINT32)-1), mUpdateIdx((UINT32)-1)
+	{ }
+
 	Component::Component(const HSceneObject& parent)
-		:mNotifyFlags(TCF_None), mParent(parent)
+		:mNotifyFlags(TCF_None), mThreadSafeUpdate(false), mParent(parent), mUpdateGroup((UINT32)-1)
+		, mUpdateIdx((UINT32)-1)
 	{
 		setName("Component");
 	}
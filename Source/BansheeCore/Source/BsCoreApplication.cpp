@@ -124,7 +124,10 @@ namespace BansheeEngine
 		MessageHandler::startUp();
 		ProfilerCPU::startUp();
 		ProfilingManager::startUp();
-		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>((numWorkerThreads));
+		// Task scheduler workers are persistent, so leave room for them on top of the other threads
+		UINT32 maxThreads = ThreadPool::DEFAULT_MAX_CAPACITY + TaskScheduler::getDefaultNumWorkers();
+
+		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>(numWorkerThreads, maxThreads);
 		TaskScheduler::startUp();
 		TaskScheduler::instance().removeWorker();
 		RenderStats::startUp();
@@ -227,9 +230,15 @@ namespace BansheeEngine
 
 			postUpdate();
 
+			// Upload any font characters rendered during this frame
+			FontManager::instance()._update();
+
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
 
+			// Start the physics step (if asynchronous) so it runs in parallel with rendering and the next frame's updates
+			gPhysics()._startAsyncStep();
+
 			gCoreSceneManager()._updateCoreObjectTransforms();
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(), "Render");
 
@@ -7,11 +7,12 @@
 #include "BsMath.h"
 #include "BsFrameAlloc.h"
 #include "BsCoreThread.h"
+#include "BsTaskScheduler.h"
 
 namespace BansheeEngine
 {
 	CoreObjectManager::CoreObjectManager()
-		:mNextAvailableID(1)
+		:mNextAvailableID(1), mParallelSync(false)
 	{
 
 	} 
@@ -61,9 +62,10 @@ namespace BansheeEngine
 				SPtr<CoreObjectCore> coreObject = object->getCore();
 				if (coreObject != nullptr)
 				{
-					CoreSyncData objSyncData = object->syncToCore(gCoreThread().getFrameAlloc());
+					FrameAlloc* allocator = gCoreThread().getFrameAlloc();
+					CoreSyncData objSyncData = object->syncToCore(allocator);
 				
-					mDestroyedSyncData.push_back(CoreStoredSyncObjData(coreObject, internalId, objSyncData));
+					mDestroyedSyncData.push_back(CoreStoredSyncObjData(coreObject, internalId, objSyncData, allocator));
 
 					DirtyObjectData& dirtyObjData = mDirtyObjects[internalId];
 					dirtyObjData.syncDataId = (INT32)mDestroyedSyncData.size() - 1;
@@ -291,8 +293,6 @@ namespace BansheeEngine
 		mCoreSyncData.push_back(CoreStoredSyncData());
 		CoreStoredSyncData& syncData = mCoreSyncData.back();
 
-		syncData.alloc = allocator;
-		
 		// Add all objects dependant on the dirty objects
 		bs_frame_mark();
 		{
@@ -323,20 +323,27 @@ namespace BansheeEngine
 		}
 
 		bs_frame_clear();
-		
-		// Order in which objects are recursed in matters, ones with lower ID will have been created before
-		// ones with higher ones and should be updated first.
-		for (auto& objectData : mDirtyObjects)
+
+		bs_frame_mark();
 		{
-			std::function<void(CoreObject*)> syncObject = [&](CoreObject* curObj)
+			// Determine the order in which to sync the objects first, so the actual sync can be split between threads.
+			// Order in which objects are recursed in matters, ones with lower ID will have been created before
+			// ones with higher ones and should be updated first.
+			FrameVector<DirtyObjectData> syncList;
+			FrameSet<CoreObject*> visited;
+
+			std::function<void(CoreObject*)> addObject = [&](CoreObject* curObj)
 			{
 				if (!curObj->isCoreDirty())
+					return;
+
+				if (!visited.insert(curObj).second)
 					return; // We already processed it as some other object's dependency
 
 				// Sync dependencies before dependants
 				// Note: I don't check for recursion. Possible infinite loop if two objects
 				// are dependent on one another.
-				
+
 				UINT64 id = curObj->getInternalID();
 				auto iterFind = mDependencies.find(id);
 
@@ -344,33 +351,125 @@ namespace BansheeEngine
 				{
 					const Vector<CoreObject*>& dependencies = iterFind->second;
 					for (auto& dependency : dependencies)
-						syncObject(dependency);
+						addObject(dependency);
 				}
 
-				SPtr<CoreObjectCore> objectCore = curObj->getCore();
-				if (objectCore == nullptr)
+				syncList.push_back({ curObj, -1 });
+			};
+
+			for (auto& objectData : mDirtyObjects)
+			{
+				CoreObject* object = objectData.second.object;
+				if (object != nullptr)
+					addObject(object);
+				else
 				{
-					curObj->markCoreClean();
-					return;
+					// Object was destroyed but we still need to sync its modifications before it was destroyed
+					if (objectData.second.syncDataId != -1)
+						syncList.push_back(objectData.second);
 				}
+			}
 
-				CoreSyncData objSyncData = curObj->syncToCore(allocator);
-				curObj->markCoreClean();
+			// Store the sync data for a contiguous range of objects
+			auto syncRange = [&](UINT32 start, UINT32 end, FrameAlloc* alloc, Vector<CoreStoredSyncObjData>& entries, 
+				UINT64& numBytes)
+			{
+				for (UINT32 i = start; i < end; i++)
+				{
+					const DirtyObjectData& objectData = syncList[i];
+					if (objectData.object == nullptr)
+					{
+						const CoreStoredSyncObjData& destroyedData = mDestroyedSyncData[objectData.syncDataId];
+
+						entries.push_back(destroyedData);
+						numBytes += destroyedData.syncData.getBufferSize();
+						continue;
+					}
+
+					CoreObject* curObj = objectData.object;
+					SPtr<CoreObjectCore> objectCore = curObj->getCore();
+					if (objectCore == nullptr)
+					{
+						curObj->markCoreClean();
+						continue;
+					}
+
+					CoreSyncData objSyncData = curObj->syncToCore(alloc);
+					curObj->markCoreClean();
 
-				syncData.entries.push_back(CoreStoredSyncObjData(objectCore,
-					curObj->getInternalID(), objSyncData));
+					entries.push_back(CoreStoredSyncObjData(objectCore, curObj->getInternalID(), objSyncData, alloc));
+					numBytes += objSyncData.getBufferSize();
+				}
 			};
 
-			CoreObject* object = objectData.second.object;
-			if (object != nullptr)
-				syncObject(object);
+			UINT32 numObjects = (UINT32)syncList.size();
+			UINT32 numWorkers = 1;
+			if (mParallelSync)
+			{
+				UINT32 maxWorkers = std::max(TaskScheduler::instance().getNumWorkers(), 1U);
+				numWorkers = Math::clamp(numObjects / MIN_OBJECTS_PER_WORKER, 1U, maxWorkers);
+			}
+
+			if (numWorkers == 1)
+			{
+				UINT64 numBytes = 0;
+				syncRange(0, numObjects, allocator, syncData.entries, numBytes);
+
+				mSyncStats.numBytes = numBytes;
+			}
 			else
 			{
-				// Object was destroyed but we still need to sync its modifications before it was destroyed
-				if (objectData.second.syncDataId != -1)
-					syncData.entries.push_back(mDestroyedSyncData[objectData.second.syncDataId]);
+				// Each worker stores its data in its own buffer using its own allocator, buffers are then spliced in order
+				Vector<Vector<CoreStoredSyncObjData>> workerEntries(numWorkers);
+				Vector<UINT64> workerBytes(numWorkers, 0);
+				Vector<SPtr<Task>> tasks;
+
+				UINT32 objectsPerWorker = (numObjects + numWorkers - 1) / numWorkers;
+				for (UINT32 i = 1; i < numWorkers; i++)
+				{
+					UINT32 start = std::min(i * objectsPerWorker, numObjects);
+					UINT32 end = std::min(start + objectsPerWorker, numObjects);
+					FrameAlloc* workerAlloc = gCoreThread().getWorkerFrameAlloc(i - 1);
+
+					auto worker = [&syncRange, &workerEntries, &workerBytes, start, end, workerAlloc, i]()
+					{
+						workerAlloc->setOwnerThread(BS_THREAD_CURRENT_ID);
+						syncRange(start, end, workerAlloc, workerEntries[i], workerBytes[i]);
+					};
+
+					SPtr<Task> task = Task::create("CoreObjectSync", worker, TaskPriority::High);
+					TaskScheduler::instance().addTask(task);
+
+					tasks.push_back(task);
+				}
+
+				// First range is handled on this thread, using the provided allocator
+				syncRange(0, std::min(objectsPerWorker, numObjects), allocator, workerEntries[0], workerBytes[0]);
+
+				for (auto& task : tasks)
+					task->wait();
+
+				UINT32 numEntries = 0;
+				for (auto& entries : workerEntries)
+					numEntries += (UINT32)entries.size();
+
+				syncData.entries.reserve(numEntries);
+
+				mSyncStats.numBytes = 0;
+				for (UINT32 i = 0; i < numWorkers; i++)
+				{
+					if (i > 0)
+						gCoreThread().getWorkerFrameAlloc(i - 1)->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
+
+					syncData.entries.insert(syncData.entries.end(), workerEntries[i].begin(), workerEntries[i].end());
+					mSyncStats.numBytes += workerBytes[i];
+				}
 			}
+
+			mSyncStats.numObjects = (UINT32)syncData.entries.size();
+			mSyncStats.numWorkers = numWorkers;
 		}
+		bs_frame_clear();
 
 		mDirtyObjects.clear();
 		mDestroyedSyncData.clear();
@@ -394,7 +493,7 @@ namespace BansheeEngine
 			UINT8* data = objSyncData.syncData.getBuffer();
 
 			if (data != nullptr)
-				syncData.alloc->dealloc(data);
+				objSyncData.alloc->dealloc(data);
 		}
 
 		syncData.entries.clear();
@@ -405,7 +504,6 @@ namespace BansheeEngine
 	{
 		Lock lock(mObjectsMutex);
 
-		FrameAlloc* allocator = gCoreThread().getFrameAlloc();
 		for (auto& objectData : mDirtyObjects)
 		{
 			if (objectData.second.syncDataId != -1)
@@ -415,7 +513,7 @@ namespace BansheeEngine
 				UINT8* data = objSyncData.syncData.getBuffer();
 
 				if (data != nullptr)
-					allocator->dealloc(data);
+					objSyncData.alloc->dealloc(data);
 			}
 		}
 
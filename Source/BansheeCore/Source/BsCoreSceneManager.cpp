@@ -4,12 +4,15 @@
 #include "BsSceneObject.h"
 #include "BsComponent.h"
 #include "BsGameObjectManager.h"
+#include "BsTaskScheduler.h"
+#include "BsMath.h"
 
 namespace BansheeEngine
 {
 	std::function<void()> SceneManagerFactory::mFactoryMethod;
 
 	CoreSceneManager::CoreSceneManager()
+		:mParallelComponentUpdate(false)
 	{
 		mRootNode = SceneObject::createInternal("SceneRoot");
 	}
@@ -66,35 +69,140 @@ namespace BansheeEngine
 
 		mRootNode = root;
 		mRootNode->_setParent(HSceneObject());
+		mTransformHierarchy._notifyStructureChanged();
 
 		oldRoot->destroy();
 	}
 
 	void CoreSceneManager::_update()
 	{
-		Stack<HSceneObject> todo;
-		todo.push(mRootNode);
+		_updateComponents();
 
-		while(!todo.empty())
-		{
-			HSceneObject currentGO = todo.top();
-			todo.pop();
+		GameObjectManager::instance().destroyQueuedObjects();
+		mTransformHierarchy._update(mRootNode);
+	}
+
+	void CoreSceneManager::_updateComponents()
+	{
+		compactComponentGroups();
 
-			if (!currentGO->getActive(true))
+		// Note: Groups and components may get added during iteration, so don't hold on to any references
+		UINT32 numGroups = (UINT32)mComponentGroups.size();
+		for (UINT32 i = 0; i < numGroups; i++)
+		{
+			if (mParallelComponentUpdate && mComponentGroups[i].threadSafe)
 				continue;
-			                  
-			const Vector<HComponent>& components = currentGO->getComponents();
 
-			for(auto iter = components.begin(); iter != components.end(); ++iter)
+			for (UINT32 j = 0; j < (UINT32)mComponentGroups[i].components.size(); j++)
 			{
-				(*iter)->update();
+				Component* component = mComponentGroups[i].components[j];
+				if (component != nullptr)
+					component->update();
 			}
+		}
 
-			for(UINT32 i = 0; i < currentGO->getNumChildren(); i++)
-				todo.push(currentGO->getChild(i));
+		if (mParallelComponentUpdate)
+		{
+			UINT32 maxTasks = std::max(TaskScheduler::instance().getNumWorkers(), 1U);
+
+			Vector<SPtr<Task>> tasks;
+			for (UINT32 i = 0; i < numGroups; i++)
+			{
+				ComponentGroup& group = mComponentGroups[i];
+				if (!group.threadSafe)
+					continue;
+
+				UINT32 numComponents = (UINT32)group.components.size();
+				UINT32 numTasks = Math::clamp(numComponents / MIN_COMPONENTS_PER_TASK, 1U, maxTasks);
+				UINT32 componentsPerTask = (numComponents + numTasks - 1) / numTasks;
+
+				for (UINT32 j = 0; j < numTasks; j++)
+				{
+					Component** start = group.components.data() + std::min(j * componentsPerTask, numComponents);
+					Component** end = group.components.data() + std::min((j + 1) * componentsPerTask, numComponents);
+
+					auto worker = [start, end]()
+					{
+						for (Component** iter = start; iter != end; ++iter)
+						{
+							if (*iter != nullptr)
+								(*iter)->update();
+						}
+					};
+
+					SPtr<Task> task = Task::create("ComponentUpdate", worker, TaskPriority::High);
+					TaskScheduler::instance().addTask(task);
+
+					tasks.push_back(task);
+				}
+			}
+
+			for (auto& task : tasks)
+				task->wait();
 		}
+	}
 
-		GameObjectManager::instance().destroyQueuedObjects();
+	void CoreSceneManager::_notifyComponentActivated(Component* component)
+	{
+		if (component->mUpdateGroup != (UINT32)-1)
+			return; // Already active
+
+		UINT32 typeId = component->getRTTI()->getRTTIId();
+		UINT64 key = ((UINT64)typeId << 1) | (component->isThreadSafeUpdate() ? 1 : 0);
+
+		UINT32 groupIdx;
+		auto iterFind = mComponentGroupLookup.find(key);
+		if (iterFind != mComponentGroupLookup.end())
+			groupIdx = iterFind->second;
+		else
+		{
+			groupIdx = (UINT32)mComponentGroups.size();
+			mComponentGroups.push_back({ typeId, component->isThreadSafeUpdate(), false, Vector<Component*>() });
+			mComponentGroupLookup[key] = groupIdx;
+		}
+
+		Vector<Component*>& components = mComponentGroups[groupIdx].components;
+		component->mUpdateGroup = groupIdx;
+		component->mUpdateIdx = (UINT32)components.size();
+
+		components.push_back(component);
+	}
+
+	void CoreSceneManager::_notifyComponentDeactivated(Component* component)
+	{
+		if (component->mUpdateGroup == (UINT32)-1)
+			return; // Not active
+
+		// Entries are only cleared here and removed before the next update. This keeps the update order of the remaining
+		// components intact, and allows removal while the group is being iterated over.
+		ComponentGroup& group = mComponentGroups[component->mUpdateGroup];
+		group.components[component->mUpdateIdx] = nullptr;
+		group.hasRemovedEntries = true;
+
+		component->mUpdateGroup = (UINT32)-1;
+		component->mUpdateIdx = (UINT32)-1;
+	}
+
+	void CoreSceneManager::compactComponentGroups()
+	{
+		for (auto& group : mComponentGroups)
+		{
+			if (!group.hasRemovedEntries)
+				continue;
+
+			UINT32 numActive = 0;
+			for (auto& component : group.components)
+			{
+				if (component == nullptr)
+					continue;
+
+				component->mUpdateIdx = numActive;
+				group.components[numActive++] = component;
+			}
+
+			group.components.resize(numActive);
+			group.hasRemovedEntries = false;
+		}
 	}
 
 	void CoreSceneManager::registerNewSO(const HSceneObject& node) 
@@ -18,6 +18,7 @@ namespace BansheeEngine
 		, mCoreThreadShutdown(false)
 		, mCoreThreadStarted(false)
 		, mCommandQueue(nullptr)
+		, mCoreThreadWaiting(false)
 		, mMaxCommandNotifyId(0)
 		, mSyncedCoreAccessor(nullptr)
 	{
@@ -60,6 +61,12 @@ namespace BansheeEngine
 		{
 			mFrameAllocs[i]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
 			bs_delete(mFrameAllocs[i]);
+
+			for (auto& workerAlloc : mWorkerFrameAllocs[i])
+			{
+				workerAlloc->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
+				bs_delete(workerAlloc);
+			}
 		}
 	}
 
@@ -99,10 +106,11 @@ namespace BansheeEngine
 		{
 			// Wait until we get some ready commands
 			Queue<QueuedCommand>* commands = nullptr;
+			Vector<RingBufferSegment> ringBufferSegments;
 			{
 				Lock lock(mCommandQueueMutex);
 
-				while(mCommandQueue->isEmpty())
+				while(mCommandQueue->isEmpty() && !hasUnscheduledRingBufferCommands())
 				{
 					if(mCoreThreadShutdown)
 					{
@@ -111,16 +119,32 @@ namespace BansheeEngine
 						return;
 					}
 
+					// Ring buffers are submitted without locking. Their producers only wake us if they see this flag, so
+					// check again after setting it, in case something was submitted in the meantime.
+					mCoreThreadWaiting = true;
+					if(hasUnscheduledRingBufferCommands())
+					{
+						mCoreThreadWaiting = false;
+						break;
+					}
+
 					TaskScheduler::instance().addWorker(); // Do something else while we wait, otherwise this core will be unused
 					mCommandReadyCondition.wait(lock);
 					TaskScheduler::instance().removeWorker();
+
+					mCoreThreadWaiting = false;
 				}
 
 				commands = mCommandQueue->flush();
+
+				// Anything submitted before the flushed commands were queued was already scheduled in front of them, so
+				// the remaining ring buffer commands go after them
+				scheduleRingBufferCommands(ringBufferSegments);
 			}
 
 			// Play commands
 			mCommandQueue->playbackWithNotify(commands, std::bind(&CoreThread::commandCompletedNotify, this, _1)); 
+			playbackRingBufferCommands(ringBufferSegments);
 		}
 #endif
 	}
@@ -147,11 +171,26 @@ namespace BansheeEngine
 	{
 		if(mAccessor.current == nullptr)
 		{
-			SPtr<CoreThreadAccessor<CommandQueueNoSync>> newAccessor = bs_shared_ptr_new<CoreThreadAccessor<CommandQueueNoSync>>(BS_THREAD_CURRENT_ID);
+			SPtr<CoreThreadAccessor<CommandQueueNoSync>> newAccessor = bs_shared_ptr_new<CoreThreadAccessor<CommandQueueNoSync>>(BS_THREAD_CURRENT_ID, 
+				BS_CORE_THREAD_RING_BUFFER_SIZE);
 			mAccessor.current = bs_new<AccessorContainer>();
 			mAccessor.current->accessor = newAccessor;
 			mAccessor.current->isMain = BS_THREAD_CURRENT_ID == mSimThreadId;
 
+			const SPtr<CommandRingBuffer>& ringBuffer = newAccessor->_getRingBuffer();
+			if(ringBuffer != nullptr)
+			{
+				RingBufferData ringBufferData;
+				ringBufferData.buffer = ringBuffer;
+				ringBufferData.scheduledPos = 0;
+
+				Lock lock(mCommandQueueMutex);
+				if (mAccessor.current->isMain)
+					mRingBuffers.push_back(ringBufferData);
+				else
+					mRingBuffers.insert(mRingBuffers.begin(), ringBufferData);
+			}
+
 			Lock lock(mAccessorMutex);
 			mAccessors.push_back(mAccessor.current);
 		}
@@ -201,6 +240,11 @@ namespace BansheeEngine
 		{
 			Lock lock(mCommandQueueMutex);
 
+			// Commands submitted to ring buffers by now must execute before this one
+			Vector<RingBufferSegment> ringBufferSegments;
+			if(scheduleRingBufferCommands(ringBufferSegments))
+				mCommandQueue->queue(std::bind(&CoreThread::playbackRingBufferCommands, ringBufferSegments));
+
 			if(blockUntilComplete)
 			{
 				commandId = mMaxCommandNotifyId++;
@@ -226,6 +270,11 @@ namespace BansheeEngine
 		{
 			Lock lock(mCommandQueueMutex);
 
+			// Commands submitted to ring buffers by now must execute before this one
+			Vector<RingBufferSegment> ringBufferSegments;
+			if(scheduleRingBufferCommands(ringBufferSegments))
+				mCommandQueue->queue(std::bind(&CoreThread::playbackRingBufferCommands, ringBufferSegments));
+
 			if(blockUntilComplete)
 			{
 				commandId = mMaxCommandNotifyId++;
@@ -241,14 +290,78 @@ namespace BansheeEngine
 			blockUntilCommandCompleted(commandId);
 	}
 
+	void CoreThread::_notifyRingBufferSubmitted(bool blockUntilComplete)
+	{
+		if(blockUntilComplete)
+		{
+			// Queued commands always execute after previously submitted ring buffer commands, so waiting on an empty one 
+			// is enough
+			queueCommand([]() { }, true);
+			return;
+		}
+
+		if(mCoreThreadWaiting)
+		{
+			Lock lock(mCommandQueueMutex);
+			mCommandReadyCondition.notify_all();
+		}
+	}
+
+	bool CoreThread::hasUnscheduledRingBufferCommands() const
+	{
+		for(auto& entry : mRingBuffers)
+		{
+			if (entry.buffer->getSubmitPosition() > entry.scheduledPos)
+				return true;
+		}
+
+		return false;
+	}
+
+	bool CoreThread::scheduleRingBufferCommands(Vector<RingBufferSegment>& segments)
+	{
+		for(auto& entry : mRingBuffers)
+		{
+			UINT64 submitPos = entry.buffer->getSubmitPosition();
+			if (submitPos <= entry.scheduledPos)
+				continue;
+
+			RingBufferSegment segment;
+			segment.buffer = entry.buffer;
+			segment.end = submitPos;
+
+			segments.push_back(segment);
+			entry.scheduledPos = submitPos;
+		}
+
+		return !segments.empty();
+	}
+
+	void CoreThread::playbackRingBufferCommands(const Vector<RingBufferSegment>& segments)
+	{
+		for (auto& entry : segments)
+			entry.buffer->playback(entry.end);
+	}
+
 	void CoreThread::update()
 	{
 		for (UINT32 i = 0; i < NUM_FRAME_ALLOCS; i++)
+		{
 			mFrameAllocs[i]->setOwnerThread(mCoreThreadId);
 
+			for (auto& workerAlloc : mWorkerFrameAllocs[i])
+				workerAlloc->setOwnerThread(mCoreThreadId);
+		}
+
 		mActiveFrameAlloc = (mActiveFrameAlloc + 1) % 2;
 		mFrameAllocs[mActiveFrameAlloc]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
 		mFrameAllocs[mActiveFrameAlloc]->clear();
+
+		for (auto& workerAlloc : mWorkerFrameAllocs[mActiveFrameAlloc])
+		{
+			workerAlloc->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
+			workerAlloc->clear();
+		}
 	}
 
 	FrameAlloc* CoreThread::getFrameAlloc() const
@@ -256,6 +369,20 @@ namespace BansheeEngine
 		return mFrameAllocs[mActiveFrameAlloc];
 	}
 
+	FrameAlloc* CoreThread::getWorkerFrameAlloc(UINT32 idx)
+	{
+		Vector<FrameAlloc*>& workerAllocs = mWorkerFrameAllocs[mActiveFrameAlloc];
+		while (idx >= (UINT32)workerAllocs.size())
+		{
+			FrameAlloc* alloc = bs_new<FrameAlloc>();
+			alloc->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
+
+			workerAllocs.push_back(alloc);
+		}
+
+		return workerAllocs[idx];
+	}
+
 	void CoreThread::blockUntilCommandCompleted(UINT32 commandId)
 	{
 #if !BS_FORCE_SINGLETHREADED_RENDERING
@@ -17,10 +17,16 @@
 
 namespace BansheeEngine
 {
-	CoreThreadAccessorBase::CoreThreadAccessorBase(CommandQueueBase* commandQueue)
+	CoreThreadAccessorBase::CoreThreadAccessorBase(CommandQueueBase* commandQueue, UINT32 ringBufferSize)
 		:mCommandQueue(commandQueue)
 	{
-
+#if !BS_FORCE_SINGLETHREADED_RENDERING
+		if(ringBufferSize > 0)
+		{
+			mRingBuffer = bs_shared_ptr_new<CommandRingBuffer>(ringBufferSize);
+			mAsyncOpSyncData = bs_shared_ptr_new<AsyncOpSyncData>();
+		}
+#endif
 	}
 
 	CoreThreadAccessorBase::~CoreThreadAccessorBase()
@@ -28,18 +34,27 @@ namespace BansheeEngine
 		bs_delete(mCommandQueue);
 	}
 
-	AsyncOp CoreThreadAccessorBase::queueReturnCommand(std::function<void(AsyncOp&)> commandCallback)
-	{
-		return mCommandQueue->queueReturn(commandCallback);
-	}
-
-	void CoreThreadAccessorBase::queueCommand(std::function<void()> commandCallback)
+	void CoreThreadAccessorBase::completeReturnCommand(AsyncOp& op)
 	{
-		mCommandQueue->queue(commandCallback);
+		if(!op.hasCompleted())
+		{
+			LOGDBG("Async operation return value wasn't resolved properly. Resolving automatically to nullptr. " \
+				"Make sure to complete the operation before returning from the command callback method.");
+			op._completeOperation(nullptr);
+		}
 	}
 
 	void CoreThreadAccessorBase::submitToCoreThread(bool blockUntilComplete)
 	{
+		if(mRingBuffer != nullptr)
+		{
+			// No commands are copied and no lock is taken, the core thread picks up the newly submitted segment on its own
+			mRingBuffer->submit();
+			gCoreThread()._notifyRingBufferSubmitted(blockUntilComplete);
+
+			return;
+		}
+
 		Queue<QueuedCommand>* commands = mCommandQueue->flush();
 
 		gCoreThread().queueCommand(std::bind(&CommandQueueBase::playback, mCommandQueue, commands), blockUntilComplete);
@@ -47,6 +62,12 @@ namespace BansheeEngine
 
 	void CoreThreadAccessorBase::cancelAll()
 	{
+		if(mRingBuffer != nullptr)
+		{
+			mRingBuffer->cancelAll();
+			return;
+		}
+
 		// Note that this won't free any Frame data allocated for all the canceled commands since
 		// frame data will only get cleared at frame start
 		mCommandQueue->cancelAll();
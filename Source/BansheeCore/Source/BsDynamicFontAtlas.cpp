@@ -0,0 +1,407 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsDynamicFontAtlas.h"
+#include "BsFontManager.h"
+#include "BsTexture.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsResources.h"
+#include "BsCoreThread.h"
+#include "BsTime.h"
+
+namespace BansheeEngine
+{
+	const UINT32 DynamicFontAtlas::INVALID_CELL_IDX = (UINT32)-1;
+	const UINT32 DynamicFontAtlas::MAX_CACHED_KERNING_PAIRS = 16384;
+
+	DynamicFontAtlas::DynamicFontAtlas(const SPtr<GlyphRasterizer>& rasterizer, UINT32 pageSize, UINT32 numPages,
+		UINT32 firstPageIdx)
+		:mRasterizer(rasterizer), mPageSize(std::max(pageSize, 3U)), mCellSize(0), mFirstPageIdx(firstPageIdx)
+	{
+		// Cells are separated by a single pixel of padding so filtering doesn't pick up neighboring characters. The
+		// padding texel at (0, 0) is never written to, and evicted characters reference it.
+		mCellSize = std::min(std::max(mRasterizer->getMaxGlyphSize(), 1U), mPageSize - 2);
+
+		UINT32 cellStride = mCellSize + 1;
+		UINT32 numCellsPerAxis = (mPageSize - 1) / cellStride;
+
+		mPages.resize(std::max(numPages, 1U));
+		for(auto& page : mPages)
+		{
+			page.isDirty = false;
+			page.cells.resize(numCellsPerAxis * numCellsPerAxis);
+
+			for(UINT32 y = 0; y < numCellsPerAxis; y++)
+			{
+				for(UINT32 x = 0; x < numCellsPerAxis; x++)
+				{
+					Cell& cell = page.cells[y * numCellsPerAxis + x];
+					cell.x = 1 + x * cellStride;
+					cell.y = 1 + y * cellStride;
+					cell.charId = 0;
+					cell.lastUsedFrame = 0;
+				}
+			}
+
+			// Reversed so cells get filled in row order
+			UINT32 numCells = (UINT32)page.cells.size();
+			page.freeCells.resize(numCells);
+			for(UINT32 i = 0; i < numCells; i++)
+				page.freeCells[i] = numCells - i - 1;
+		}
+
+		FontManager::instance()._registerDynamicAtlas(this);
+	}
+
+	DynamicFontAtlas::~DynamicFontAtlas()
+	{
+		if(FontManager::isStarted())
+			FontManager::instance()._unregisterDynamicAtlas(this);
+
+		if(Resources::isStarted())
+		{
+			for(auto& page : mPages)
+			{
+				if(page.texture != nullptr)
+					gResources().release(page.texture);
+			}
+		}
+	}
+
+	const CHAR_DESC* DynamicFontAtlas::getCharDesc(UINT32 charId)
+	{
+		Lock lock(mMutex);
+
+		UINT64 frameIdx = gTime().getFrameIdx();
+
+		auto iterFind = mGlyphs.find(charId);
+		if(iterFind != mGlyphs.end())
+		{
+			Glyph& glyph = iterFind->second;
+
+			if(!glyph.exists)
+				return nullptr;
+
+			if(glyph.cellIdx != INVALID_CELL_IDX)
+			{
+				// Pinned characters aren't tracked for eviction
+				if(glyph.numPins == 0)
+					touchCell(mPages[glyph.page], glyph.cellIdx, frameIdx);
+
+				return &glyph.desc;
+			}
+
+			if(glyph.desc.width == 0 || glyph.desc.height == 0)
+				return &glyph.desc;
+
+			// Glyph was evicted earlier, find it a new cell within its original page. If there is no room the glyph
+			// remains blank for now.
+			UINT32 cellIdx = allocateCell(glyph.page, frameIdx);
+			if(cellIdx == INVALID_CELL_IDX)
+				return &glyph.desc;
+
+			CHAR_DESC desc;
+			if(!mRasterizer->renderGlyph(charId, desc, mGlyphPixels))
+			{
+				desc = glyph.desc;
+				mGlyphPixels.assign(desc.width * desc.height, 0);
+			}
+
+			desc.charId = charId;
+			writeToCell(glyph, desc, cellIdx, frameIdx);
+
+			return &glyph.desc;
+		}
+
+		CHAR_DESC desc;
+		if(!mRasterizer->renderGlyph(charId, desc, mGlyphPixels))
+		{
+			Glyph& missingGlyph = mGlyphs[charId];
+			missingGlyph.page = 0;
+			missingGlyph.cellIdx = INVALID_CELL_IDX;
+			missingGlyph.numPins = 0;
+			missingGlyph.exists = false;
+
+			return nullptr;
+		}
+
+		desc.charId = charId;
+
+		// Prefer pages with free cells, otherwise evict from the page with the least recently used character
+		UINT32 pageIdx = 0;
+		UINT64 oldestFrame = std::numeric_limits<UINT64>::max();
+		for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			Page& page = mPages[i];
+			if(!page.freeCells.empty())
+			{
+				pageIdx = i;
+				break;
+			}
+
+			// Nothing to evict if all characters on the page are pinned
+			if(page.cellUsage.empty())
+				continue;
+
+			UINT64 lastUsedFrame = page.cells[page.cellUsage.back()].lastUsedFrame;
+			if(lastUsedFrame < oldestFrame)
+			{
+				oldestFrame = lastUsedFrame;
+				pageIdx = i;
+			}
+		}
+
+		preparePage(mPages[pageIdx]);
+
+		// The page is assigned even if the glyph cannot be placed right away, so that the glyph always ends up on the
+		// same page. Text referencing it will then never need its per-page quad counts updated.
+		Glyph& newGlyph = mGlyphs[charId];
+		newGlyph.desc = desc;
+		newGlyph.desc.page = mFirstPageIdx + pageIdx;
+		newGlyph.desc.uvX = 0.0f;
+		newGlyph.desc.uvY = 0.0f;
+		newGlyph.desc.uvWidth = 0.0f;
+		newGlyph.desc.uvHeight = 0.0f;
+		newGlyph.page = pageIdx;
+		newGlyph.cellIdx = INVALID_CELL_IDX;
+		newGlyph.numPins = 0;
+		newGlyph.exists = true;
+
+		// Characters without any visible pixels don't need a cell
+		if(desc.width == 0 || desc.height == 0)
+			return &newGlyph.desc;
+
+		UINT32 cellIdx = allocateCell(pageIdx, frameIdx);
+		if(cellIdx != INVALID_CELL_IDX)
+			writeToCell(newGlyph, desc, cellIdx, frameIdx);
+
+		return &newGlyph.desc;
+	}
+
+	bool DynamicFontAtlas::pinChar(UINT32 charId)
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mGlyphs.find(charId);
+		if(iterFind == mGlyphs.end() || !iterFind->second.exists)
+			return false;
+
+		Glyph& glyph = iterFind->second;
+		glyph.numPins++;
+
+		// Pinned cells are removed from the usage list, so they are never considered for eviction
+		if(glyph.numPins == 1 && glyph.cellIdx != INVALID_CELL_IDX)
+		{
+			Page& page = mPages[glyph.page];
+			page.cellUsage.erase(page.cells[glyph.cellIdx].usageIter);
+		}
+
+		return true;
+	}
+
+	void DynamicFontAtlas::unpinChar(UINT32 charId)
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mGlyphs.find(charId);
+		if(iterFind == mGlyphs.end() || iterFind->second.numPins == 0)
+			return;
+
+		Glyph& glyph = iterFind->second;
+		glyph.numPins--;
+
+		if(glyph.numPins == 0 && glyph.cellIdx != INVALID_CELL_IDX)
+		{
+			Page& page = mPages[glyph.page];
+			Cell& cell = page.cells[glyph.cellIdx];
+
+			page.cellUsage.push_front(glyph.cellIdx);
+			cell.usageIter = page.cellUsage.begin();
+			cell.lastUsedFrame = gTime().getFrameIdx();
+		}
+	}
+
+	INT32 DynamicFontAtlas::getKerning(UINT32 firstCharId, UINT32 secondCharId)
+	{
+		Lock lock(mMutex);
+
+		UINT64 key = ((UINT64)firstCharId << 32) | secondCharId;
+		auto iterFind = mKerningPairs.find(key);
+		if(iterFind != mKerningPairs.end())
+			return iterFind->second;
+
+		INT32 amount = mRasterizer->getKerning(firstCharId, secondCharId);
+
+		if(mKerningPairs.size() >= MAX_CACHED_KERNING_PAIRS)
+			mKerningPairs.clear();
+
+		mKerningPairs[key] = amount;
+		return amount;
+	}
+
+	const HTexture& DynamicFontAtlas::getTexture(UINT32 page) const
+	{
+		static HTexture EMPTY_TEXTURE;
+
+		Lock lock(mMutex);
+
+		if(page >= (UINT32)mPages.size())
+			return EMPTY_TEXTURE;
+
+		return mPages[page].texture;
+	}
+
+	void DynamicFontAtlas::_updatePages()
+	{
+		Lock lock(mMutex);
+
+		for(auto& page : mPages)
+		{
+			if(!page.isDirty)
+				continue;
+
+			// Data is read on the core thread at a later point, so it must not be modified in the meantime
+			SPtr<PixelData> pixels = bs_shared_ptr_new<PixelData>(mPageSize, mPageSize, 1, PF_R8G8);
+			pixels->allocateInternalBuffer();
+			memcpy(pixels->getData(), page.pixels->getData(), page.pixels->getSize());
+
+			UINT32 subresourceIdx = page.texture->getProperties().mapToSubresourceIdx(0, 0);
+
+			// It's possible the formats no longer match
+			if (page.texture->getProperties().getFormat() != pixels->getFormat())
+			{
+				SPtr<PixelData> temp = page.texture->getProperties().allocateSubresourceBuffer(subresourceIdx);
+				PixelUtil::bulkPixelConversion(*pixels, *temp);
+
+				page.texture->writeSubresource(gCoreAccessor(), subresourceIdx, temp, false);
+			}
+			else
+			{
+				page.texture->writeSubresource(gCoreAccessor(), subresourceIdx, pixels, false);
+			}
+
+			page.isDirty = false;
+		}
+	}
+
+	void DynamicFontAtlas::preparePage(Page& page)
+	{
+		if(page.texture != nullptr)
+			return;
+
+		page.pixels = bs_shared_ptr_new<PixelData>(mPageSize, mPageSize, 1, PF_R8G8);
+		page.pixels->allocateInternalBuffer();
+		memset(page.pixels->getData(), 0, page.pixels->getSize());
+
+		page.texture = Texture::create(TEX_TYPE_2D, mPageSize, mPageSize, 0, PF_R8G8);
+		page.texture->setName(L"DynamicFontPage" + toWString(mFirstPageIdx + (UINT32)(&page - &mPages[0])));
+
+		// Upload the cleared contents even if nothing gets rendered into the page
+		page.isDirty = true;
+	}
+
+	UINT32 DynamicFontAtlas::allocateCell(UINT32 pageIdx, UINT64 frameIdx)
+	{
+		Page& page = mPages[pageIdx];
+		preparePage(page);
+
+		if(!page.freeCells.empty())
+		{
+			UINT32 cellIdx = page.freeCells.back();
+			page.freeCells.pop_back();
+
+			page.cellUsage.push_front(cellIdx);
+			page.cells[cellIdx].usageIter = page.cellUsage.begin();
+
+			return cellIdx;
+		}
+
+		if(page.cellUsage.empty())
+			return INVALID_CELL_IDX;
+
+		// Never evict characters used this frame, as text referencing them might still be getting built. Pinned
+		// characters aren't in the usage list, so they are never evicted either.
+		UINT32 cellIdx = page.cellUsage.back();
+		Cell& cell = page.cells[cellIdx];
+		if(cell.lastUsedFrame == frameIdx)
+			return INVALID_CELL_IDX;
+
+		auto iterFind = mGlyphs.find(cell.charId);
+		if(iterFind != mGlyphs.end())
+		{
+			Glyph& evictedGlyph = iterFind->second;
+			evictedGlyph.cellIdx = INVALID_CELL_IDX;
+			evictedGlyph.desc.uvX = 0.0f;
+			evictedGlyph.desc.uvY = 0.0f;
+			evictedGlyph.desc.uvWidth = 0.0f;
+			evictedGlyph.desc.uvHeight = 0.0f;
+		}
+
+		page.cellUsage.splice(page.cellUsage.begin(), page.cellUsage, cell.usageIter);
+		return cellIdx;
+	}
+
+	void DynamicFontAtlas::writeToCell(Glyph& glyph, const CHAR_DESC& desc, UINT32 cellIdx, UINT64 frameIdx)
+	{
+		Page& page = mPages[glyph.page];
+		Cell& cell = page.cells[cellIdx];
+
+		UINT32 rowPitch = mPageSize * 2;
+		UINT8* cellData = page.pixels->getData() + cell.y * rowPitch + cell.x * 2;
+
+		UINT8* dstRow = cellData;
+		for(UINT32 y = 0; y < mCellSize; y++)
+		{
+			memset(dstRow, 0, mCellSize * 2);
+			dstRow += rowPitch;
+		}
+
+		// Characters larger than the cell get clipped
+		UINT32 width = std::min(desc.width, mCellSize);
+		UINT32 height = std::min(desc.height, mCellSize);
+
+		dstRow = cellData;
+		for(UINT32 y = 0; y < height; y++)
+		{
+			const UINT8* srcRow = &mGlyphPixels[y * desc.width];
+			for(UINT32 x = 0; x < width; x++)
+			{
+				dstRow[x * 2 + 0] = srcRow[x];
+				dstRow[x * 2 + 1] = srcRow[x];
+			}
+
+			dstRow += rowPitch;
+		}
+
+		float invPageSize = 1.0f / mPageSize;
+
+		glyph.desc = desc;
+		glyph.desc.page = mFirstPageIdx + glyph.page;
+		glyph.desc.uvX = invPageSize * cell.x;
+		glyph.desc.uvY = invPageSize * cell.y;
+		glyph.desc.uvWidth = invPageSize * width;
+		glyph.desc.uvHeight = invPageSize * height;
+		glyph.desc.width = width;
+		glyph.desc.height = height;
+		glyph.cellIdx = cellIdx;
+
+		cell.charId = desc.charId;
+		cell.lastUsedFrame = frameIdx;
+
+		// Cell was placed in the usage list when allocated, but a pinned character must stay out of it
+		if(glyph.numPins > 0)
+			page.cellUsage.erase(cell.usageIter);
+
+		page.isDirty = true;
+	}
+
+	void DynamicFontAtlas::touchCell(Page& page, UINT32 cellIdx, UINT64 frameIdx)
+	{
+		Cell& cell = page.cells[cellIdx];
+		if(cell.lastUsedFrame == frameIdx)
+			return;
+
+		cell.lastUsedFrame = frameIdx;
+		page.cellUsage.splice(page.cellUsage.begin(), page.cellUsage, cell.usageIter);
+	}
+}
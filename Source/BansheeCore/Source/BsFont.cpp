@@ -4,20 +4,186 @@
 #include "BsFontRTTI.h"
 #include "BsFontManager.h"
 #include "BsResources.h"
+#include "BsDynamicFontAtlas.h"
+#include "BsDebug.h"
 
 namespace BansheeEngine
 {
+	const UINT32 FontBitmap::INVALID_CHAR_IDX = (UINT32)-1;
+	const UINT32 FontBitmap::NUM_BMP_CHARS = 65536;
+
+	FontBitmap::FontBitmap()
+		:size(0), mHasLookupTables(false)
+	{ }
+
 	const CHAR_DESC& FontBitmap::getCharDesc(UINT32 charId) const
 	{
-		auto iterFind = fontDesc.characters.find(charId);
-		if(iterFind != fontDesc.characters.end())
+		const CHAR_DESC* charDesc = findCharDesc(charId);
+		if(charDesc != nullptr)
+			return *charDesc;
+
+		if(mDynamicAtlas != nullptr)
 		{
-			return fontDesc.characters.at(charId);
+			charDesc = mDynamicAtlas->getCharDesc(charId);
+			if(charDesc != nullptr)
+				return *charDesc;
 		}
 
 		return fontDesc.missingGlyph;
 	}
 
+	INT32 FontBitmap::getKerning(UINT32 firstCharId, UINT32 secondCharId) const
+	{
+		// Kerning pairs are only stored for characters that were pre-rendered
+		if(mDynamicAtlas != nullptr)
+		{
+			if(findCharDesc(firstCharId) == nullptr || findCharDesc(secondCharId) == nullptr)
+				return mDynamicAtlas->getKerning(firstCharId, secondCharId);
+		}
+
+		if(!mHasLookupTables)
+		{
+			const CHAR_DESC& firstDesc = getCharDesc(firstCharId);
+			for(auto& kerningPair : firstDesc.kerningPairs)
+			{
+				if(kerningPair.otherCharId == secondCharId)
+					return kerningPair.amount;
+			}
+
+			return 0;
+		}
+
+		if(mKerningLookup.empty())
+			return 0;
+
+		UINT64 key = ((UINT64)firstCharId << 32) | secondCharId;
+		auto iterFind = mKerningLookup.find(key);
+		if(iterFind != mKerningLookup.end())
+			return iterFind->second;
+
+		return 0;
+	}
+
+	void FontBitmap::_pinChars(const WString& text, Vector<UINT32>& pinnedChars) const
+	{
+		if(mDynamicAtlas == nullptr)
+			return;
+
+		for(auto& entry : text)
+		{
+			UINT32 charId = entry;
+
+			// Pre-rendered characters never move
+			if(findCharDesc(charId) != nullptr)
+				continue;
+
+			if(mDynamicAtlas->pinChar(charId))
+				pinnedChars.push_back(charId);
+		}
+	}
+
+	void FontBitmap::_unpinChars(const Vector<UINT32>& pinnedChars) const
+	{
+		if(mDynamicAtlas == nullptr)
+			return;
+
+		for(auto& charId : pinnedChars)
+			mDynamicAtlas->unpinChar(charId);
+	}
+
+	const CHAR_DESC* FontBitmap::findCharDesc(UINT32 charId) const
+	{
+		if(!mHasLookupTables)
+		{
+			auto iterFind = fontDesc.characters.find(charId);
+			if(iterFind != fontDesc.characters.end())
+				return &iterFind->second;
+
+			return nullptr;
+		}
+
+		UINT32 charIdx = INVALID_CHAR_IDX;
+		if(charId < NUM_BMP_CHARS)
+		{
+			if(charId < (UINT32)mBMPCharLookup.size())
+				charIdx = mBMPCharLookup[charId];
+		}
+		else
+		{
+			auto iterFind = mOtherCharLookup.find(charId);
+			if(iterFind != mOtherCharLookup.end())
+				charIdx = iterFind->second;
+		}
+
+		if(charIdx != INVALID_CHAR_IDX)
+			return &mCharDescs[charIdx];
+
+		return nullptr;
+	}
+
+	const HTexture& FontBitmap::getTexture(UINT32 page) const
+	{
+		static HTexture EMPTY_TEXTURE;
+
+		UINT32 numStaticPages = (UINT32)texturePages.size();
+		if(page < numStaticPages)
+			return texturePages[page];
+
+		if(mDynamicAtlas != nullptr)
+			return mDynamicAtlas->getTexture(page - numStaticPages);
+
+		return EMPTY_TEXTURE;
+	}
+
+	UINT32 FontBitmap::getNumPages() const
+	{
+		UINT32 numPages = (UINT32)texturePages.size();
+		if(mDynamicAtlas != nullptr)
+			numPages += mDynamicAtlas->getNumPages();
+
+		return numPages;
+	}
+
+	void FontBitmap::_buildLookupTables()
+	{
+		mCharDescs.clear();
+		mBMPCharLookup.clear();
+		mOtherCharLookup.clear();
+		mKerningLookup.clear();
+
+		// The BMP table only needs to be large enough to cover the largest character in the font
+		UINT32 numBMPEntries = 0;
+		for(auto& entry : fontDesc.characters)
+		{
+			if(entry.first < NUM_BMP_CHARS)
+				numBMPEntries = std::max(numBMPEntries, entry.first + 1);
+		}
+
+		mCharDescs.reserve(fontDesc.characters.size());
+		mBMPCharLookup.resize(numBMPEntries, INVALID_CHAR_IDX);
+
+		for(auto& entry : fontDesc.characters)
+		{
+			UINT32 charIdx = (UINT32)mCharDescs.size();
+			mCharDescs.push_back(entry.second);
+
+			if(entry.first < NUM_BMP_CHARS)
+				mBMPCharLookup[entry.first] = charIdx;
+			else
+				mOtherCharLookup[entry.first] = charIdx;
+
+			for(auto& kerningPair : entry.second.kerningPairs)
+			{
+				UINT64 key = ((UINT64)entry.first << 32) | kerningPair.otherCharId;
+
+				// Keep the first pair in case of duplicates, same as a linear search through the pairs would
+				mKerningLookup.insert(std::make_pair(key, kerningPair.amount));
+			}
+		}
+
+		mHasLookupTables = true;
+	}
+
 	RTTITypeBase* FontBitmap::getRTTIStatic()
 	{
 		return FontBitmapRTTI::instance();
@@ -37,9 +203,41 @@ namespace BansheeEngine
 
 	void Font::initialize(const Vector<SPtr<FontBitmap>>& fontData)
 	{
+		initialize(fontData, DYNAMIC_FONT_DESC());
+	}
+
+	void Font::initialize(const Vector<SPtr<FontBitmap>>& fontData, const DYNAMIC_FONT_DESC& dynamicDesc)
+	{
+		mDynamicDesc = dynamicDesc;
+
+		bool warnedNoRasterizer = false;
 		for(auto iter = fontData.begin(); iter != fontData.end(); ++iter)
+		{
+			(*iter)->_buildLookupTables();
 			mFontDataPerSize[(*iter)->size] = *iter;
 
+			if(!isDynamic())
+				continue;
+
+			SPtr<GlyphRasterizer> rasterizer = FontManager::instance()._createGlyphRasterizer(mDynamicDesc, (*iter)->size);
+			if(rasterizer == nullptr)
+			{
+				if(!warnedNoRasterizer)
+				{
+					LOGWRN("Unable to render font characters at runtime, font importer plugin isn't loaded. Only "
+						"pre-rendered characters will be displayed.");
+					warnedNoRasterizer = true;
+				}
+
+				continue;
+			}
+
+			SPtr<DynamicFontAtlas> atlas = bs_shared_ptr_new<DynamicFontAtlas>(rasterizer, mDynamicDesc.pageSize, 
+				mDynamicDesc.numPages, (UINT32)(*iter)->texturePages.size());
+
+			(*iter)->_setDynamicAtlas(atlas);
+		}
+
 		Resource::initialize();
 	}
 
@@ -116,11 +314,23 @@ namespace BansheeEngine
 		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
 	}
 
+	HFont Font::create(const Vector<SPtr<FontBitmap>>& fontData, const DYNAMIC_FONT_DESC& dynamicDesc)
+	{
+		SPtr<Font> newFont = _createPtr(fontData, dynamicDesc);
+
+		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
+	}
+
 	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData)
 	{
 		return FontManager::instance().create(fontData);
 	}
 
+	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData, const DYNAMIC_FONT_DESC& dynamicDesc)
+	{
+		return FontManager::instance().create(fontData, dynamicDesc);
+	}
+
 	RTTITypeBase* Font::getRTTIStatic()
 	{
 		return FontRTTI::instance();
@@ -6,7 +6,8 @@
 namespace BansheeEngine
 {
 	FontImportOptions::FontImportOptions()
-		:mDPI(96), mRenderMode(FontRenderMode::HintedSmooth), mBold(false), mItalic(false)
+		:mDPI(96), mRenderMode(FontRenderMode::HintedSmooth), mBold(false), mItalic(false), mDynamic(false)
+		, mDynamicPageSize(512), mDynamicNumPages(1)
 	{
 		mFontSizes.push_back(10);
 		mCharIndexRanges.push_back(std::make_pair(33, 166)); // Most used ASCII characters
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsFontManager.h"
 #include "BsFont.h"
+#include "BsDynamicFontAtlas.h"
 
 namespace BansheeEngine
 {
@@ -14,6 +15,15 @@ namespace BansheeEngine
 		return newFont;
 	}
 
+	SPtr<Font> FontManager::create(const Vector<SPtr<FontBitmap>>& fontData, const DYNAMIC_FONT_DESC& dynamicDesc) const
+	{
+		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
+		newFont->_setThisPtr(newFont);
+		newFont->initialize(fontData, dynamicDesc);
+
+		return newFont;
+	}
+
 	SPtr<Font> FontManager::_createEmpty() const
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
@@ -21,4 +31,40 @@ namespace BansheeEngine
 
 		return newFont;
 	}
+
+	void FontManager::_registerGlyphRasterizerFactory(const GlyphRasterizerFactory& factory)
+	{
+		Lock lock(mMutex);
+		mRasterizerFactory = factory;
+	}
+
+	SPtr<GlyphRasterizer> FontManager::_createGlyphRasterizer(const DYNAMIC_FONT_DESC& desc, UINT32 size) const
+	{
+		Lock lock(mMutex);
+
+		if(mRasterizerFactory == nullptr)
+			return nullptr;
+
+		return mRasterizerFactory(desc, size);
+	}
+
+	void FontManager::_registerDynamicAtlas(DynamicFontAtlas* atlas)
+	{
+		Lock lock(mMutex);
+		mDynamicAtlases.insert(atlas);
+	}
+
+	void FontManager::_unregisterDynamicAtlas(DynamicFontAtlas* atlas)
+	{
+		Lock lock(mMutex);
+		mDynamicAtlases.erase(atlas);
+	}
+
+	void FontManager::_update()
+	{
+		Lock lock(mMutex);
+
+		for(auto& atlas : mDynamicAtlases)
+			atlas->_updatePages();
+	}
 }
\ No newline at end of file
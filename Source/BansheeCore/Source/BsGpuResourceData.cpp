@@ -16,6 +16,7 @@ namespace BansheeEngine
 	GpuResourceData::GpuResourceData(const GpuResourceData& copy)
 	{
 		mData = copy.mData;
+		mDataSource = copy.mDataSource;
 		mLocked = copy.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
 	}
@@ -28,6 +29,7 @@ namespace BansheeEngine
 	GpuResourceData& GpuResourceData::operator=(const GpuResourceData& rhs)
 	{
 		mData = rhs.mData;
+		mDataSource = rhs.mDataSource;
 		mLocked = rhs.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
 
@@ -65,6 +67,7 @@ namespace BansheeEngine
 		freeInternalBuffer();
 
 		mData = (UINT8*)bs_alloc(size);
+		mDataSource = nullptr;
 		mOwnsData = true;
 	}
 
@@ -98,9 +101,39 @@ namespace BansheeEngine
 		freeInternalBuffer();
 
 		mData = data;
+		mDataSource = nullptr;
 		mOwnsData = false;
 	}
 
+	void GpuResourceData::setExternalBuffer(UINT8* data, const SPtr<DataStream>& dataSource)
+	{
+		setExternalBuffer(data);
+
+		mDataSource = dataSource;
+	}
+
+	void GpuResourceData::detachDataSource()
+	{
+		if (mDataSource == nullptr)
+			return;
+
+#if !BS_FORCE_SINGLETHREADED_RENDERING
+		if(mLocked)
+		{
+			if(BS_THREAD_CURRENT_ID != CoreThread::instance().getCoreThreadId())
+				BS_EXCEPT(InternalErrorException, "You are not allowed to access buffer data from non-core thread when the buffer is locked.");
+		}
+#endif
+
+		UINT32 size = getInternalBufferSize();
+		UINT8* data = (UINT8*)bs_alloc(size);
+		memcpy(data, mData, size);
+
+		mData = data;
+		mDataSource = nullptr;
+		mOwnsData = true;
+	}
+
 	void GpuResourceData::_lock() const
 	{
 		mLocked = true;
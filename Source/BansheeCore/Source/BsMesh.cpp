@@ -423,8 +423,14 @@ namespace BansheeEngine
 	void Mesh::initialize()
 	{
 		if (mCPUData != nullptr)
+		{
 			updateBounds(*mCPUData);
 
+			// CPU cached data is kept for the lifetime of the mesh, don't let it pin the file it was loaded from
+			if ((mUsage & MU_CPUCACHED) != 0)
+				mCPUData->detachDataSource();
+		}
+
 		MeshBase::initialize();
 
 		if ((mUsage & MU_CPUCACHED) != 0 && mCPUData == nullptr)
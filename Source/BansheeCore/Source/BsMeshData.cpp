@@ -202,6 +202,8 @@ namespace BansheeEngine
 			BS_EXCEPT(InvalidParametersException, "Buffer sizes don't match. Expected: " + toString(totalSize) + ". Got: " + toString(size));
 		}
 
+		detachDataSource();
+
 		UINT32 indexBufferOffset = getIndexBufferSize();
 
 		UINT32 elementOffset = getElementOffset(semantic, semanticIdx, streamIdx);
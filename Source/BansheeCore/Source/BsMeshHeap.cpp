@@ -53,37 +53,7 @@ namespace BansheeEngine
 
 	void MeshHeapCore::alloc(SPtr<TransientMeshCore> mesh, const SPtr<MeshData>& meshData)
 	{
-		// Find free vertex chunk and grow if needed
-		UINT32 smallestVertFit = 0;
-		UINT32 smallestVertFitIdx = 0;
-
-		while (smallestVertFit == 0)
-		{
-			UINT32 curIdx = 0;
-			for (auto& chunkIdx : mFreeVertChunks)
-			{
-				ChunkData& chunk = mVertChunks[chunkIdx];
-
-				if (chunk.size >= meshData->getNumVertices() && (chunk.size < smallestVertFit || smallestVertFit == 0))
-				{
-					smallestVertFit = chunk.size;
-					smallestVertFitIdx = curIdx;
-				}
-
-				curIdx++;
-			}
-
-			if (smallestVertFit > 0)
-				break;
-
-			UINT32 newNumVertices = mNumVertices;
-			while (newNumVertices < (mNumVertices + meshData->getNumVertices()))
-			{
-				newNumVertices = Math::roundToInt(newNumVertices * GrowPercent);
-			}
-
-			growVertexBuffer(newNumVertices);
-		}
+		UINT32 freeVertChunkIdx = allocVertChunk(meshData->getNumVertices());
 
 		// Find free index chunk and grow if needed
 		UINT32 smallestIdxFit = 0;
@@ -117,19 +87,8 @@ namespace BansheeEngine
 			growIndexBuffer(newNumIndices);
 		}
 
-		UINT32 freeVertChunkIdx = 0;
 		UINT32 freeIdxChunkIdx = 0;
 
-		auto freeVertIter = mFreeVertChunks.begin();
-		freeVertChunkIdx = (*freeVertIter);
-		for (UINT32 i = 0; i < smallestVertFitIdx; i++)
-		{
-			freeVertIter++;
-			freeVertChunkIdx = (*freeVertIter);
-		}
-
-		mFreeVertChunks.erase(freeVertIter);
-
 		auto freeIdxIter = mFreeIdxChunks.begin();
 		freeIdxChunkIdx = (*freeIdxIter);
 		for (UINT32 i = 0; i < smallestIdxFitIdx; i++)
@@ -140,40 +99,15 @@ namespace BansheeEngine
 
 		mFreeIdxChunks.erase(freeIdxIter);
 
-		ChunkData& vertChunk = mVertChunks[freeVertChunkIdx];
 		ChunkData& idxChunk = mIdxChunks[freeIdxChunkIdx];
 
-		UINT32 vertChunkStart = vertChunk.start;
+		UINT32 vertChunkStart = mVertChunks[freeVertChunkIdx].start;
 		UINT32 idxChunkStart = idxChunk.start;
 
-		UINT32 remainingNumVerts = vertChunk.size - meshData->getNumVertices();
 		UINT32 remainingNumIdx = idxChunk.size - meshData->getNumIndices();
 
-		vertChunk.size = meshData->getNumVertices();
 		idxChunk.size = meshData->getNumIndices();
 
-		if (remainingNumVerts > 0)
-		{
-			if (!mEmptyVertChunks.empty())
-			{
-				UINT32 emptyChunkIdx = mEmptyVertChunks.top();
-				ChunkData& emptyChunk = mVertChunks[emptyChunkIdx];
-				mEmptyVertChunks.pop();
-
-				emptyChunk.start = vertChunkStart + meshData->getNumVertices();
-				emptyChunk.size = remainingNumVerts;
-			}
-			else
-			{
-				ChunkData newChunk;
-				newChunk.size = remainingNumVerts;
-				newChunk.start = vertChunkStart + meshData->getNumVertices();
-
-				mVertChunks.push_back(newChunk);
-				mFreeVertChunks.push_back((UINT32)(mVertChunks.size() - 1));
-			}
-		}
-
 		if (remainingNumIdx > 0)
 		{
 			if (!mEmptyIdxChunks.empty())
@@ -206,6 +140,105 @@ namespace BansheeEngine
 		mMeshAllocData[mesh->getMeshHeapId()] = newAllocData;
 
 		// Actually copy data
+		writeVertexData(meshData, vertChunkStart);
+		uploadVertexData(vertChunkStart, meshData->getNumVertices());
+
+		const IndexBufferProperties& ibProps = mIndexBuffer->getProperties();
+
+		UINT32 idxSize = ibProps.getIndexSize();
+
+		// Ensure index sizes match
+		if (meshData->getIndexElementSize() != idxSize)
+		{
+			BS_EXCEPT(InvalidParametersException, "Provided index size doesn't match meshes index size. Needed: " +
+				toString(idxSize) + ". Got: " + toString(meshData->getIndexElementSize()));
+		}
+
+		UINT8* idxDest = mCPUIndexData + idxChunkStart * idxSize;
+		memcpy(idxDest, meshData->getIndexData(), meshData->getNumIndices() * idxSize);
+		mIndexBuffer->writeData(idxChunkStart * idxSize, meshData->getNumIndices() * idxSize, idxDest, BufferWriteType::NoOverwrite);
+	}
+
+	UINT32 MeshHeapCore::allocVertChunk(UINT32 numVertices)
+	{
+		// Find free vertex chunk and grow if needed
+		UINT32 smallestVertFit = 0;
+		UINT32 smallestVertFitIdx = 0;
+
+		while (smallestVertFit == 0)
+		{
+			UINT32 curIdx = 0;
+			for (auto& chunkIdx : mFreeVertChunks)
+			{
+				ChunkData& chunk = mVertChunks[chunkIdx];
+
+				if (chunk.size >= numVertices && (chunk.size < smallestVertFit || smallestVertFit == 0))
+				{
+					smallestVertFit = chunk.size;
+					smallestVertFitIdx = curIdx;
+				}
+
+				curIdx++;
+			}
+
+			if (smallestVertFit > 0)
+				break;
+
+			UINT32 newNumVertices = mNumVertices;
+			while (newNumVertices < (mNumVertices + numVertices))
+			{
+				newNumVertices = Math::roundToInt(newNumVertices * GrowPercent);
+			}
+
+			growVertexBuffer(newNumVertices);
+		}
+
+		UINT32 freeVertChunkIdx = 0;
+
+		auto freeVertIter = mFreeVertChunks.begin();
+		freeVertChunkIdx = (*freeVertIter);
+		for (UINT32 i = 0; i < smallestVertFitIdx; i++)
+		{
+			freeVertIter++;
+			freeVertChunkIdx = (*freeVertIter);
+		}
+
+		mFreeVertChunks.erase(freeVertIter);
+
+		ChunkData& vertChunk = mVertChunks[freeVertChunkIdx];
+
+		UINT32 vertChunkStart = vertChunk.start;
+		UINT32 remainingNumVerts = vertChunk.size - numVertices;
+
+		vertChunk.size = numVertices;
+
+		if (remainingNumVerts > 0)
+		{
+			if (!mEmptyVertChunks.empty())
+			{
+				UINT32 emptyChunkIdx = mEmptyVertChunks.top();
+				ChunkData& emptyChunk = mVertChunks[emptyChunkIdx];
+				mEmptyVertChunks.pop();
+
+				emptyChunk.start = vertChunkStart + numVertices;
+				emptyChunk.size = remainingNumVerts;
+			}
+			else
+			{
+				ChunkData newChunk;
+				newChunk.size = remainingNumVerts;
+				newChunk.start = vertChunkStart + numVertices;
+
+				mVertChunks.push_back(newChunk);
+				mFreeVertChunks.push_back((UINT32)(mVertChunks.size() - 1));
+			}
+		}
+
+		return freeVertChunkIdx;
+	}
+
+	void MeshHeapCore::writeVertexData(const SPtr<MeshData>& meshData, UINT32 vertexOffset)
+	{
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
 			if (!mVertexDesc->hasStream(i))
@@ -223,9 +256,7 @@ namespace BansheeEngine
 					toString(vertSize) + ". Got: " + toString(otherVertSize));
 			}
 
-			SPtr<VertexBufferCore> vertexBuffer = mVertexData->getBuffer(i);
-
-			UINT8* vertDest = mCPUVertexData[i] + vertChunkStart * vertSize;
+			UINT8* vertDest = mCPUVertexData[i] + vertexOffset * vertSize;
 			memcpy(vertDest, meshData->getStreamData(i), meshData->getNumVertices() * vertSize);
 
 			if (RenderAPICore::instance().getAPIInfo().getVertexColorFlipRequired())
@@ -247,24 +278,77 @@ namespace BansheeEngine
 					}
 				}
 			}
+		}
+	}
+
+	void MeshHeapCore::uploadVertexData(UINT32 vertexOffset, UINT32 numVertices)
+	{
+		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+		{
+			if (!mVertexDesc->hasStream(i))
+				continue;
+
+			UINT32 vertSize = mVertexData->vertexDeclaration->getProperties().getVertexSize(i);
+			UINT8* vertSrc = mCPUVertexData[i] + vertexOffset * vertSize;
 
-			vertexBuffer->writeData(vertChunkStart * vertSize, meshData->getNumVertices() * vertSize, vertDest, BufferWriteType::NoOverwrite);
+			SPtr<VertexBufferCore> vertexBuffer = mVertexData->getBuffer(i);
+			vertexBuffer->writeData(vertexOffset * vertSize, numVertices * vertSize, vertSrc,
+				BufferWriteType::NoOverwrite);
 		}
+	}
 
-		const IndexBufferProperties& ibProps = mIndexBuffer->getProperties();
+	void MeshHeapCore::update(SPtr<TransientMeshCore> mesh, const SPtr<MeshData>& meshData, UINT32 firstVertex)
+	{
+		auto findIter = mMeshAllocData.find(mesh->getMeshHeapId());
+		assert(findIter != mMeshAllocData.end());
 
-		UINT32 idxSize = ibProps.getIndexSize();
+		AllocatedData& allocData = findIter->second;
+		UINT32 numVertices = mVertChunks[allocData.vertChunkIdx].size;
+		assert((firstVertex + meshData->getNumVertices()) <= numVertices);
 
-		// Ensure index sizes match
-		if (meshData->getIndexElementSize() != idxSize)
+		// Buffers are written without synchronization, so vertices the GPU might still be reading must not be touched
+		if (allocData.useFlags == UseFlags::Used)
 		{
-			BS_EXCEPT(InvalidParametersException, "Provided index size doesn't match meshes index size. Needed: " +
-				toString(idxSize) + ". Got: " + toString(meshData->getIndexElementSize()));
+			UINT32 newChunkIdx = allocVertChunk(numVertices);
+
+			// Note: Allocating the chunk might have grown the buffer, which moves the existing chunks
+			UINT32 oldChunkStart = mVertChunks[allocData.vertChunkIdx].start;
+			UINT32 newChunkStart = mVertChunks[newChunkIdx].start;
+
+			for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+			{
+				if (!mVertexDesc->hasStream(i))
+					continue;
+
+				UINT32 vertSize = mVertexData->vertexDeclaration->getProperties().getVertexSize(i);
+				memcpy(mCPUVertexData[i] + newChunkStart * vertSize, mCPUVertexData[i] + oldChunkStart * vertSize,
+					numVertices * vertSize);
+			}
+
+			allocData.retiredVertChunks.push_back(allocData.vertChunkIdx);
+			allocData.vertChunkIdx = newChunkIdx;
+
+			writeVertexData(meshData, newChunkStart + firstVertex);
+			uploadVertexData(newChunkStart, numVertices);
 		}
+		else
+		{
+			UINT32 vertexOffset = mVertChunks[allocData.vertChunkIdx].start + firstVertex;
 
-		UINT8* idxDest = mCPUIndexData + idxChunkStart * idxSize;
-		memcpy(idxDest, meshData->getIndexData(), meshData->getNumIndices() * idxSize);
-		mIndexBuffer->writeData(idxChunkStart * idxSize, meshData->getNumIndices() * idxSize, idxDest, BufferWriteType::NoOverwrite);
+			writeVertexData(meshData, vertexOffset);
+			uploadVertexData(vertexOffset, meshData->getNumVertices());
+		}
+	}
+
+	void MeshHeapCore::freeRetiredChunks(AllocatedData& allocData)
+	{
+		for (auto& chunkIdx : allocData.retiredVertChunks)
+		{
+			mFreeVertChunks.push_back(chunkIdx);
+			mergeWithNearbyVertChunks(chunkIdx);
+		}
+
+		allocData.retiredVertChunks.clear();
 	}
 
 	void MeshHeapCore::dealloc(SPtr<TransientMeshCore> mesh)
@@ -277,6 +361,7 @@ namespace BansheeEngine
 		{
 			allocData.useFlags = UseFlags::Free;
 			freeEventQuery(allocData.eventQueryIdx);
+			freeRetiredChunks(allocData);
 
 			mFreeVertChunks.push_back(allocData.vertChunkIdx);
 			mFreeIdxChunks.push_back(allocData.idxChunkIdx);
@@ -351,6 +436,9 @@ namespace BansheeEngine
 			allocData.second.vertChunkIdx = (UINT32)newVertChunks.size();
 			newVertChunks.push_back(newChunk);
 
+			// Retired chunks were in the old buffer, which the GPU keeps alive for as long as it needs it
+			allocData.second.retiredVertChunks.clear();
+
 			destOffset += oldChunk.size;
 		}
 
@@ -539,6 +627,9 @@ namespace BansheeEngine
 		{
 			assert(allocData.useFlags != UseFlags::Free && allocData.useFlags != UseFlags::GPUFree);
 
+			// GPU is done with all previous uses of the mesh, including the ones that used its retired chunks
+			thisPtr->freeRetiredChunks(allocData);
+
 			if (allocData.useFlags == UseFlags::CPUFree)
 			{
 				allocData.useFlags = UseFlags::Free;
@@ -560,28 +651,30 @@ namespace BansheeEngine
 
 	void MeshHeapCore::mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx)
 	{
-		// Merge vertex chunks
-		ChunkData& vertChunk = mVertChunks[chunkVertIdx];
-		for (auto& freeChunkIdx : mFreeVertChunks)
+		mergeWithNearbyVertChunks(chunkVertIdx);
+
+		// Merge index chunks
+		ChunkData& idxChunk = mIdxChunks[chunkIdxIdx];
+		for (auto& freeChunkIdx : mFreeIdxChunks)
 		{
-			if (chunkVertIdx == freeChunkIdx)
+			if (chunkIdxIdx == freeChunkIdx)
 				continue;
 
-			ChunkData& curChunk = mVertChunks[freeChunkIdx];
+			ChunkData& curChunk = mIdxChunks[freeChunkIdx];
 			if (curChunk.size == 0) // Already merged
 				continue;
 
 			bool merged = false;
-			if (curChunk.start == (vertChunk.start + vertChunk.size))
+			if (curChunk.start == (idxChunk.start + idxChunk.size))
 			{
-				vertChunk.size += curChunk.size;
+				idxChunk.size += curChunk.size;
 
 				merged = true;
 			}
-			else if ((curChunk.start + curChunk.size) == vertChunk.start)
+			else if ((curChunk.start + curChunk.size) == idxChunk.start)
 			{
-				vertChunk.start = curChunk.start;
-				vertChunk.size += curChunk.size;
+				idxChunk.start = curChunk.start;
+				idxChunk.size += curChunk.size;
 
 				merged = true;
 			}
@@ -592,32 +685,34 @@ namespace BansheeEngine
 				// mark it as empty and set size to 0. It will be reused when needed.
 				curChunk.start = 0;
 				curChunk.size = 0;
-				mEmptyVertChunks.push(freeChunkIdx);
+				mEmptyIdxChunks.push(freeChunkIdx);
 			}
 		}
+	}
 
-		// Merge index chunks
-		ChunkData& idxChunk = mIdxChunks[chunkIdxIdx];
-		for (auto& freeChunkIdx : mFreeIdxChunks)
+	void MeshHeapCore::mergeWithNearbyVertChunks(UINT32 chunkVertIdx)
+	{
+		ChunkData& vertChunk = mVertChunks[chunkVertIdx];
+		for (auto& freeChunkIdx : mFreeVertChunks)
 		{
-			if (chunkIdxIdx == freeChunkIdx)
+			if (chunkVertIdx == freeChunkIdx)
 				continue;
 
-			ChunkData& curChunk = mIdxChunks[freeChunkIdx];
+			ChunkData& curChunk = mVertChunks[freeChunkIdx];
 			if (curChunk.size == 0) // Already merged
 				continue;
 
 			bool merged = false;
-			if (curChunk.start == (idxChunk.start + idxChunk.size))
+			if (curChunk.start == (vertChunk.start + vertChunk.size))
 			{
-				idxChunk.size += curChunk.size;
+				vertChunk.size += curChunk.size;
 
 				merged = true;
 			}
-			else if ((curChunk.start + curChunk.size) == idxChunk.start)
+			else if ((curChunk.start + curChunk.size) == vertChunk.start)
 			{
-				idxChunk.start = curChunk.start;
-				idxChunk.size += curChunk.size;
+				vertChunk.start = curChunk.start;
+				vertChunk.size += curChunk.size;
 
 				merged = true;
 			}
@@ -628,7 +723,7 @@ namespace BansheeEngine
 				// mark it as empty and set size to 0. It will be reused when needed.
 				curChunk.start = 0;
 				curChunk.size = 0;
-				mEmptyIdxChunks.push(freeChunkIdx);
+				mEmptyVertChunks.push(freeChunkIdx);
 			}
 		}
 	}
@@ -681,6 +776,16 @@ namespace BansheeEngine
 		queueGpuCommand(getCore(), std::bind(&MeshHeapCore::dealloc, getCore().get(), mesh->getCore()));
 	}
 
+	void MeshHeap::update(const SPtr<TransientMesh>& mesh, const SPtr<MeshData>& meshData, UINT32 firstVertex)
+	{
+		auto iterFind = mMeshes.find(mesh->mId);
+		if(iterFind == mMeshes.end())
+			return;
+
+		queueGpuCommand(getCore(), std::bind(&MeshHeapCore::update, getCore().get(), mesh->getCore(), meshData,
+			firstVertex));
+	}
+
 	SPtr<MeshHeapCore> MeshHeap::getCore() const
 	{
 		return std::static_pointer_cast<MeshHeapCore>(mCoreSpecific);
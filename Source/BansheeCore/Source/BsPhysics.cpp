@@ -8,6 +8,7 @@
 namespace BansheeEngine
 {
 	Physics::Physics(const PHYSICS_INIT_DESC& init)
+		:mFlags(init.flags)
 	{
 		memset(mCollisionMap, 1, CollisionMapSize * CollisionMapSize * sizeof(bool));
 	}
@@ -85,6 +85,8 @@ namespace BansheeEngine
 
 	void PixelData::setColorAt(Color const &cv, UINT32 x, UINT32 y, UINT32 z)
 	{
+		detachDataSource();
+
 		UINT32 pixelSize = PixelUtil::getNumElemBytes(mFormat);
 		UINT32 pixelOffset = pixelSize * (z * mSlicePitch + y * mRowPitch + x);
 		PixelUtil::packColor(cv, mFormat, (unsigned char *)getData() + pixelOffset);
@@ -138,6 +140,8 @@ namespace BansheeEngine
 			return;
 		}
 
+		detachDataSource();
+
 		UINT32 pixelSize = PixelUtil::getNumElemBytes(mFormat);
 		UINT8* data = getData();
 
@@ -5,8 +5,16 @@
 #include "BsColor.h"
 #include "BsMath.h"
 #include "BsException.h"
+#include "BsTaskScheduler.h"
 #include <nvtt.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define BS_PIXEL_SSE 1
+#	include <emmintrin.h>
+#else
+#	define BS_PIXEL_SSE 0
+#endif
+
 namespace BansheeEngine 
 {
 	/**
@@ -851,40 +859,6 @@ namespace BansheeEngine
 		UINT8* bufferEnd;
 	};
 
-	/**	Handles output from NVTT library for a mip-map chain. */
-	struct NVTTMipmapOutputHandler : public nvtt::OutputHandler
-	{
-		NVTTMipmapOutputHandler(const Vector<SPtr<PixelData>>& buffers)
-			:buffers(buffers), bufferWritePos(nullptr), bufferEnd(nullptr)
-		{ }
-
-		virtual void beginImage(int size, int width, int height, int depth, int face, int miplevel)
-		{ 
-			assert(miplevel >= 0 && miplevel < (int)buffers.size());
-			assert(size == buffers[miplevel]->getConsecutiveSize());
-
-			activeBuffer = buffers[miplevel];
-
-			bufferWritePos = activeBuffer->getData();
-			bufferEnd = bufferWritePos + activeBuffer->getConsecutiveSize();
-		}
-
-		virtual bool writeData(const void* data, int size)
-		{
-			assert((bufferWritePos + size) <= bufferEnd);
-			memcpy(bufferWritePos, data, size);
-			bufferWritePos += size;
-
-			return true;
-		}
-
-		Vector<SPtr<PixelData>> buffers;
-		SPtr<PixelData> activeBuffer;
-
-		UINT8* bufferWritePos;
-		UINT8* bufferEnd;
-	};
-
 	nvtt::Format toNVTTFormat(PixelFormat format)
 	{
 		switch (format)
@@ -940,22 +914,6 @@ namespace BansheeEngine
 		return nvtt::AlphaMode_None;
 	}
 
-	nvtt::WrapMode toNVTTWrapMode(MipMapWrapMode wrapMode)
-	{
-		switch (wrapMode)
-		{
-		case MipMapWrapMode::Clamp:
-			return nvtt::WrapMode_Clamp;
-		case MipMapWrapMode::Mirror:
-			return nvtt::WrapMode_Mirror;
-		case MipMapWrapMode::Repeat:
-			return nvtt::WrapMode_Repeat;
-		}
-
-		// Unknown alpha mode
-		return nvtt::WrapMode_Mirror;
-	}
-
     UINT32 PixelUtil::getNumElemBytes(PixelFormat format)
     {
         return getDescriptionFor(format).elemBytes;
@@ -1359,6 +1317,395 @@ namespace BansheeEngine
         }
     }
 
+	/** Describes how to convert a row of pixels from one format to another. */
+	struct PixelRowConversion
+	{
+		PixelFormat srcFormat;
+		PixelFormat dstFormat;
+
+		/** Bit offsets of the red, green, blue and alpha channels, for formats with 8-bit integer channels. */
+		UINT8 srcShifts[4];
+		UINT8 dstShifts[4];
+
+		/** Mask applied to each channel before writing it, zero if the channel should not be copied. */
+		UINT32 channelMasks[4];
+
+		/** Bits to set in every destination pixel. Used for assigning full alpha when the source has no alpha. */
+		UINT32 alphaFill;
+	};
+
+	/** Converts @p count consecutive pixels from @p src and writes them to @p dst. */
+	typedef void(*PixelRowConvertFunc)(const PixelRowConversion& info, const UINT8* src, UINT8* dst, UINT32 count);
+
+	/** Lookup tables for converting 8-bit channel values to floating point channel values. */
+	struct ByteToFloatTables
+	{
+		ByteToFloatTables()
+		{
+			for (UINT32 i = 0; i < 256; i++)
+			{
+				toFloat[i] = Bitwise::fixedToFloat(i, 8);
+				toHalf[i] = Bitwise::floatToHalf(toFloat[i]);
+			}
+		}
+
+		float toFloat[256];
+		UINT16 toHalf[256];
+	};
+
+	/** Returns lookup tables for converting 8-bit channel values to floating point values. */
+	const ByteToFloatTables& getByteToFloatTables()
+	{
+		static const ByteToFloatTables tables;
+		return tables;
+	}
+
+	/** Lookup table for converting half precision floating point channel values to 8-bit channel values. */
+	struct HalfToByteTable
+	{
+		HalfToByteTable()
+		{
+			for (UINT32 i = 0; i < 65536; i++)
+				toByte[i] = (UINT8)Bitwise::floatToFixed(Bitwise::halfToFloat((UINT16)i), 8);
+		}
+
+		UINT8 toByte[65536];
+	};
+
+	/** Returns a lookup table for converting half precision floating point channel values to 8-bit values. */
+	const HalfToByteTable& getHalfToByteTable()
+	{
+		static const HalfToByteTable table;
+		return table;
+	}
+
+	/** Moves the 8-bit channels of a pixel to the bit offsets required by the destination format. */
+	UINT32 permuteChannels(const PixelRowConversion& info, UINT32 value)
+	{
+		UINT32 output = info.alphaFill;
+		for (UINT32 i = 0; i < 4; i++)
+			output |= ((value >> info.srcShifts[i]) & info.channelMasks[i]) << info.dstShifts[i];
+
+		return output;
+	}
+
+#if BS_PIXEL_SSE
+	/** Moves the 8-bit channels of four 32-bit pixels to the bit offsets required by the destination format. */
+	__m128i permuteChannels(const PixelRowConversion& info, __m128i value)
+	{
+		__m128i output = _mm_set1_epi32((int)info.alphaFill);
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			__m128i channel = _mm_srl_epi32(value, _mm_cvtsi32_si128(info.srcShifts[i]));
+			channel = _mm_and_si128(channel, _mm_set1_epi32((int)info.channelMasks[i]));
+
+			output = _mm_or_si128(output, _mm_sll_epi32(channel, _mm_cvtsi32_si128(info.dstShifts[i])));
+		}
+
+		return output;
+	}
+#endif
+
+	/** Converts pixels of any format by unpacking them to floating point values and packing them back. */
+	void convertRowGeneric(const PixelRowConversion& info, const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(info.srcFormat);
+		const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(info.dstFormat);
+
+		float r, g, b, a;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			PixelUtil::unpackColor(&r, &g, &b, &a, info.srcFormat, src);
+			PixelUtil::packColor(r, g, b, a, info.dstFormat, dst);
+
+			src += srcPixelSize;
+			dst += dstPixelSize;
+		}
+	}
+
+	/** 
+	 * Converts pixels between two formats with 8-bit integer channels. 
+	 *
+	 * @tparam srcSize	Size of a single source pixel in bytes, 3 or 4.
+	 * @tparam dstSize	Size of a single destination pixel in bytes, 3 or 4.
+	 */
+	template<UINT32 srcSize, UINT32 dstSize>
+	void convertRowByteToByte(const PixelRowConversion& info, const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		UINT32 i = 0;
+
+#if BS_PIXEL_SSE
+		if (srcSize == 4 && dstSize == 4)
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i value = _mm_loadu_si128((const __m128i*)(src + i * 4));
+				_mm_storeu_si128((__m128i*)(dst + i * 4), permuteChannels(info, value));
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			UINT32 value = Bitwise::intRead(src + i * srcSize, srcSize);
+			Bitwise::intWrite(dst + i * dstSize, dstSize, permuteChannels(info, value));
+		}
+	}
+
+	/** Converts pixels from a format with 8-bit integer channels to PF_FLOAT32_RGBA. */
+	template<UINT32 srcSize>
+	void convertRowByteToFloat32(const PixelRowConversion& info, const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		const float* table = getByteToFloatTables().toFloat;
+		const bool hasAlpha = info.channelMasks[3] != 0;
+
+		float* output = (float*)dst;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			UINT32 value = Bitwise::intRead(src + i * srcSize, srcSize);
+
+			output[0] = table[(value >> info.srcShifts[0]) & 0xFF];
+			output[1] = table[(value >> info.srcShifts[1]) & 0xFF];
+			output[2] = table[(value >> info.srcShifts[2]) & 0xFF];
+			output[3] = hasAlpha ? table[(value >> info.srcShifts[3]) & 0xFF] : 1.0f;
+
+			output += 4;
+		}
+	}
+
+	/** Converts pixels from a format with 8-bit integer channels to PF_FLOAT16_RGBA. */
+	template<UINT32 srcSize>
+	void convertRowByteToFloat16(const PixelRowConversion& info, const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		const UINT16* table = getByteToFloatTables().toHalf;
+		const bool hasAlpha = info.channelMasks[3] != 0;
+
+		UINT16* output = (UINT16*)dst;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			UINT32 value = Bitwise::intRead(src + i * srcSize, srcSize);
+
+			output[0] = table[(value >> info.srcShifts[0]) & 0xFF];
+			output[1] = table[(value >> info.srcShifts[1]) & 0xFF];
+			output[2] = table[(value >> info.srcShifts[2]) & 0xFF];
+			output[3] = hasAlpha ? table[(value >> info.srcShifts[3]) & 0xFF] : table[255];
+
+			output += 4;
+		}
+	}
+
+	/** 
+	 * Converts pixels from PF_FLOAT32_RGBA to a format with 8-bit integer channels. Rounds the same way as 
+	 * Bitwise::floatToFixed().
+	 */
+	template<UINT32 dstSize>
+	void convertRowFloat32ToByte(const PixelRowConversion& info, const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		const float* input = (const float*)src;
+		UINT32 i = 0;
+
+#if BS_PIXEL_SSE
+		{
+			const __m128 scale = _mm_set1_ps(256.0f);
+			const __m128 maxValue = _mm_set1_ps(255.0f);
+			const __m128 zero = _mm_setzero_ps();
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i pixels[4];
+				for (UINT32 j = 0; j < 4; j++)
+				{
+					__m128 value = _mm_mul_ps(_mm_loadu_ps(input + (i + j) * 4), scale);
+					value = _mm_max_ps(_mm_min_ps(value, maxValue), zero);
+
+					pixels[j] = _mm_cvttps_epi32(value);
+				}
+
+				// Narrow to bytes, resulting in four pixels with channels in RGBA order
+				__m128i packed = _mm_packus_epi16(_mm_packs_epi32(pixels[0], pixels[1]),
+					_mm_packs_epi32(pixels[2], pixels[3]));
+
+				packed = permuteChannels(info, packed);
+				if (dstSize == 4)
+					_mm_storeu_si128((__m128i*)(dst + i * 4), packed);
+				else
+				{
+					UINT32 values[4];
+					_mm_storeu_si128((__m128i*)values, packed);
+
+					for (UINT32 j = 0; j < 4; j++)
+						Bitwise::intWrite(dst + (i + j) * dstSize, dstSize, values[j]);
+				}
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			const float* pixel = input + i * 4;
+			UINT32 value = Bitwise::floatToFixed(pixel[0], 8) | (Bitwise::floatToFixed(pixel[1], 8) << 8) |
+				(Bitwise::floatToFixed(pixel[2], 8) << 16) | (Bitwise::floatToFixed(pixel[3], 8) << 24);
+
+			Bitwise::intWrite(dst + i * dstSize, dstSize, permuteChannels(info, value));
+		}
+	}
+
+	/** Converts pixels from PF_FLOAT16_RGBA to a format with 8-bit integer channels. */
+	template<UINT32 dstSize>
+	void convertRowFloat16ToByte(const PixelRowConversion& info, const UINT8* src, UINT8* dst, UINT32 count)
+	{
+		const UINT8* table = getHalfToByteTable().toByte;
+		const UINT16* input = (const UINT16*)src;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const UINT16* pixel = input + i * 4;
+			UINT32 value = table[pixel[0]] | (table[pixel[1]] << 8) | (table[pixel[2]] << 16) | (table[pixel[3]] << 24);
+
+			Bitwise::intWrite(dst + i * dstSize, dstSize, permuteChannels(info, value));
+		}
+	}
+
+	/** Checks if the format stores 8-bit red, green and blue channels, and an optional 8-bit alpha, in 3 or 4 bytes. */
+	bool hasByteChannels(PixelFormat format)
+	{
+		if (!PixelUtil::isNativeEndian(format) || PixelUtil::getElementType(format) != PCT_BYTE)
+			return false;
+
+		UINT32 size = PixelUtil::getNumElemBytes(format);
+		if (size != 3 && size != 4)
+			return false;
+
+		int bits[4];
+		PixelUtil::getBitDepths(format, bits);
+
+		return bits[0] == 8 && bits[1] == 8 && bits[2] == 8 && (bits[3] == 8 || bits[3] == 0);
+	}
+
+	/** 
+	 * Finds the fastest method of converting pixels between the provided formats, and fills out the information it
+	 * requires. Falls back to convertRowGeneric() if there is no specialized conversion for the format pair.
+	 */
+	PixelRowConvertFunc findRowConversion(PixelFormat srcFormat, PixelFormat dstFormat, PixelRowConversion& info)
+	{
+		static const UINT8 RGBA_SHIFTS[4] = { 0, 8, 16, 24 };
+
+		info.srcFormat = srcFormat;
+		info.dstFormat = dstFormat;
+		info.alphaFill = 0;
+		memcpy(info.srcShifts, RGBA_SHIFTS, sizeof(RGBA_SHIFTS));
+		memcpy(info.dstShifts, RGBA_SHIFTS, sizeof(RGBA_SHIFTS));
+
+		bool srcIsByte = hasByteChannels(srcFormat);
+		bool dstIsByte = hasByteChannels(dstFormat);
+		bool srcHasAlpha = PixelUtil::hasAlpha(srcFormat);
+		bool dstHasAlpha = PixelUtil::hasAlpha(dstFormat);
+
+		if (srcIsByte)
+			PixelUtil::getBitShifts(srcFormat, info.srcShifts);
+
+		if (dstIsByte)
+			PixelUtil::getBitShifts(dstFormat, info.dstShifts);
+
+		bool srcIsFloat = srcFormat == PF_FLOAT32_RGBA || srcFormat == PF_FLOAT16_RGBA;
+		bool dstIsFloat = dstFormat == PF_FLOAT32_RGBA || dstFormat == PF_FLOAT16_RGBA;
+
+		for (UINT32 i = 0; i < 3; i++)
+			info.channelMasks[i] = 0xFF;
+
+		info.channelMasks[3] = srcHasAlpha && dstHasAlpha ? 0xFF : 0;
+		if (!srcHasAlpha && dstHasAlpha && dstIsByte)
+			info.alphaFill = 0xFFU << info.dstShifts[3];
+
+		UINT32 srcSize = PixelUtil::getNumElemBytes(srcFormat);
+		UINT32 dstSize = PixelUtil::getNumElemBytes(dstFormat);
+
+		if (srcIsByte && dstIsByte)
+		{
+			if (srcSize == 4)
+				return dstSize == 4 ? &convertRowByteToByte<4, 4> : &convertRowByteToByte<4, 3>;
+			else
+				return dstSize == 4 ? &convertRowByteToByte<3, 4> : &convertRowByteToByte<3, 3>;
+		}
+
+		if (srcIsByte && dstIsFloat)
+		{
+			if (dstFormat == PF_FLOAT32_RGBA)
+				return srcSize == 4 ? &convertRowByteToFloat32<4> : &convertRowByteToFloat32<3>;
+			else
+				return srcSize == 4 ? &convertRowByteToFloat16<4> : &convertRowByteToFloat16<3>;
+		}
+
+		if (srcIsFloat && dstIsByte)
+		{
+			if (srcFormat == PF_FLOAT32_RGBA)
+				return dstSize == 4 ? &convertRowFloat32ToByte<4> : &convertRowFloat32ToByte<3>;
+			else
+				return dstSize == 4 ? &convertRowFloat16ToByte<4> : &convertRowFloat16ToByte<3>;
+		}
+
+		return &convertRowGeneric;
+	}
+
+	/**
+	 * Executes @p func on rows in range [0, @p numRows). Large images are split into bands of rows that are processed in
+	 * parallel, if the task scheduler is running.
+	 *
+	 * @param[in]	numRows			Number of rows to process.
+	 * @param[in]	pixelsPerRow	Number of pixels in a single row, used for determining how to split the rows.
+	 * @param[in]	func			Callable with the signature void(UINT32 rowBegin, UINT32 rowEnd).
+	 */
+	template<class T>
+	void processRowBands(UINT32 numRows, UINT32 pixelsPerRow, const T& func)
+	{
+		// Minimum number of pixels before the work is split over multiple threads, and the minimum number of pixels
+		// processed by a single thread
+		static const UINT32 PARALLEL_MIN_PIXELS = 256 * 256;
+		static const UINT32 PIXELS_PER_BAND = 128 * 128;
+
+		if (pixelsPerRow * numRows >= PARALLEL_MIN_PIXELS && TaskScheduler::isStarted())
+		{
+			UINT32 rowsPerBand = std::max(1U, PIXELS_PER_BAND / std::max(pixelsPerRow, 1U));
+			TaskScheduler::instance().parallelFor(0, numRows, rowsPerBand, func);
+		}
+		else
+			func(0, numRows);
+	}
+
+	/** 
+	 * Converts all pixels of @p src and writes them to @p dst, one row at a time. Large volumes are split into bands
+	 * of rows that are converted in parallel, if the task scheduler is running.
+	 */
+	void convertPixelRows(const PixelData& src, PixelData& dst, PixelRowConvertFunc func, const PixelRowConversion& info)
+	{
+		const UINT32 width = src.getWidth();
+		const UINT32 height = src.getHeight();
+		const UINT32 numRows = height * src.getDepth();
+
+		const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
+		const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
+
+		const UINT8* srcData = src.getData() + 
+			(src.getLeft() + src.getTop() * src.getRowPitch() + src.getFront() * src.getSlicePitch()) * srcPixelSize;
+		UINT8* dstData = dst.getData() + 
+			(dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * dstPixelSize;
+
+		auto convertRows = [&](UINT32 rowBegin, UINT32 rowEnd)
+		{
+			for (UINT32 i = rowBegin; i < rowEnd; i++)
+			{
+				UINT32 z = i / height;
+				UINT32 y = i % height;
+
+				const UINT8* srcRow = srcData + (z * src.getSlicePitch() + y * src.getRowPitch()) * srcPixelSize;
+				UINT8* dstRow = dstData + (z * dst.getSlicePitch() + y * dst.getRowPitch()) * dstPixelSize;
+
+				func(info, srcRow, dstRow, width);
+			}
+		};
+
+		processRowBands(numRows, width, convertRows);
+	}
+
     void PixelUtil::bulkPixelConversion(const PixelData &src, PixelData &dst)
     {
         assert(src.getWidth() == dst.getWidth() &&
@@ -1440,6 +1787,16 @@ namespace BansheeEngine
             return;
         }
 
+		// Use a specialized conversion for common format pairs, if available
+		PixelRowConversion conversion;
+		PixelRowConvertFunc convertFunc = findRowConversion(src.getFormat(), dst.getFormat(), conversion);
+
+		if(convertFunc != &convertRowGeneric)
+		{
+			convertPixelRows(src, dst, convertFunc, conversion);
+			return;
+		}
+
 		// Converting to PF_X8R8G8B8 is exactly the same as converting to
 		// PF_A8R8G8B8. (same with PF_X8B8G8R8 and PF_A8B8G8R8)
 		if(dst.getFormat() == PF_X8R8G8B8 || dst.getFormat() == PF_X8B8G8R8)
@@ -1448,6 +1805,7 @@ namespace BansheeEngine
 			// optimized conversions
 			PixelFormat tempFormat = dst.getFormat() == PF_X8R8G8B8?PF_A8R8G8B8:PF_A8B8G8R8;
 			PixelData tempdst(dst.getWidth(), dst.getHeight(), dst.getDepth(), tempFormat);
+			tempdst.setExternalBuffer(dst.getData());
 			bulkPixelConversion(src, tempdst);
 			return;
 		}
@@ -1465,42 +1823,398 @@ namespace BansheeEngine
 			return;
 		}
 
-		const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
-		const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
-        UINT8 *srcptr = static_cast<UINT8*>(src.getData())
-            + (src.getLeft() + src.getTop() * src.getRowPitch() + src.getFront() * src.getSlicePitch()) * srcPixelSize;
-        UINT8 *dstptr = static_cast<UINT8*>(dst.getData())
-            + (dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * dstPixelSize;
-		
-        // Calculate pitches+skips in bytes
-		const UINT32 srcRowSkipBytes = src.getRowSkip()*srcPixelSize;
-		const UINT32 srcSliceSkipBytes = src.getSliceSkip()*srcPixelSize;
-		const UINT32 dstRowSkipBytes = dst.getRowSkip()*dstPixelSize;
-		const UINT32 dstSliceSkipBytes = dst.getSliceSkip()*dstPixelSize;
-
         // The brute force fallback
-        float r,g,b,a;
-		for (UINT32 z = src.getFront(); z<src.getBack(); z++)
+		convertPixelRows(src, dst, convertFunc, conversion);
+    }
+
+	/** Returns the normalized sinc function, sin(pi * x) / (pi * x). */
+	float sinc(float x)
+	{
+		if (std::abs(x) < 1e-5f)
+			return 1.0f;
+
+		float piX = Math::PI * x;
+		return std::sin(piX) / piX;
+	}
+
+	/** Evaluates the zeroth order modified Bessel function of the first kind. */
+	float besselI0(float x)
+	{
+		float halfX = x * 0.5f;
+		float sum = 1.0f;
+		float term = 1.0f;
+
+		for (UINT32 i = 1; i < 32; i++)
 		{
-			for (UINT32 y = src.getTop(); y < src.getBottom(); y++)
-            {
-				for (UINT32 x = src.getLeft(); x<src.getRight(); x++)
-                {
-                    unpackColor(&r, &g, &b, &a, src.getFormat(), srcptr);
-                    packColor(r, g, b, a, dst.getFormat(), dstptr);
+			float factor = halfX / i;
+			term *= factor * factor;
+			sum += term;
 
-                    srcptr += srcPixelSize;
-                    dstptr += dstPixelSize;
-                }
+			if (term < sum * 1e-8f)
+				break;
+		}
 
-                srcptr += srcRowSkipBytes;
-                dstptr += dstRowSkipBytes;
-            }
+		return sum;
+	}
 
-            srcptr += srcSliceSkipBytes;
-            dstptr += dstSliceSkipBytes;
-        }
-    }
+	float evaluateBoxFilter(float x)
+	{
+		return (x > -0.5f && x <= 0.5f) ? 1.0f : 0.0f;
+	}
+
+	float evaluateTriangleFilter(float x)
+	{
+		x = std::abs(x);
+		return x < 1.0f ? 1.0f - x : 0.0f;
+	}
+
+	float evaluateKaiserFilter(float x)
+	{
+		static const float WIDTH = 3.0f;
+		static const float ALPHA = 4.0f;
+
+		float t = x / WIDTH;
+		if (t <= -1.0f || t >= 1.0f)
+			return 0.0f;
+
+		return sinc(x) * besselI0(ALPHA * std::sqrt(1.0f - t * t)) / besselI0(ALPHA);
+	}
+
+	float evaluateLanczosFilter(float x)
+	{
+		if (x <= -3.0f || x >= 3.0f)
+			return 0.0f;
+
+		return sinc(x) * sinc(x / 3.0f);
+	}
+
+	/** Separable filter used when resampling images. */
+	struct ResampleFilter
+	{
+		/** Distance from the filter center, in destination pixels, beyond which the filter evaluates to zero. */
+		float radius;
+
+		/** Returns the filter weight at the provided distance from the filter center, in destination pixels. */
+		float(*evaluate)(float x);
+	};
+
+	/** Returns a resampling filter corresponding to the provided mip-map filter type. */
+	ResampleFilter getResampleFilter(MipMapFilter filter)
+	{
+		switch (filter)
+		{
+		case MipMapFilter::Triangle:
+			return { 1.0f, &evaluateTriangleFilter };
+		case MipMapFilter::Kaiser:
+			return { 3.0f, &evaluateKaiserFilter };
+		case MipMapFilter::Lanczos:
+			return { 3.0f, &evaluateLanczosFilter };
+		default:
+		case MipMapFilter::Box:
+			return { 0.5f, &evaluateBoxFilter };
+		}
+	}
+
+	/** Maps a pixel index that might lie outside of the image into the image, according to the wrap mode. */
+	UINT32 wrapPixelIndex(INT32 index, UINT32 size, MipMapWrapMode wrapMode)
+	{
+		INT32 signedSize = (INT32)size;
+		switch (wrapMode)
+		{
+		case MipMapWrapMode::Repeat:
+			index %= signedSize;
+			return (UINT32)(index < 0 ? index + signedSize : index);
+		case MipMapWrapMode::Mirror:
+		{
+			INT32 period = signedSize * 2;
+			index %= period;
+			if (index < 0)
+				index += period;
+
+			return (UINT32)(index < signedSize ? index : period - 1 - index);
+		}
+		default:
+		case MipMapWrapMode::Clamp:
+			return (UINT32)Math::clamp(index, 0, signedSize - 1);
+		}
+	}
+
+	/** Source pixels, and their weights, that contribute to each destination pixel along a single axis. */
+	struct ResampleWeights
+	{
+		UINT32 numTaps;
+		Vector<UINT32> indices; /**< @p numTaps source pixel indices per destination pixel. */
+		Vector<float> weights; /**< @p numTaps normalized weights per destination pixel. */
+	};
+
+	/** Calculates weights for resampling a single image axis from @p srcSize to @p dstSize pixels. */
+	void calculateResampleWeights(UINT32 srcSize, UINT32 dstSize, const ResampleFilter& filter, MipMapWrapMode wrapMode,
+		ResampleWeights& output)
+	{
+		// When downsampling the filter is stretched so it covers all source pixels
+		float scale = srcSize / (float)dstSize;
+		float filterScale = std::max(scale, 1.0f);
+		float support = filter.radius * filterScale;
+
+		UINT32 numTaps = (UINT32)Math::ceilToInt(support * 2.0f) + 1;
+		output.numTaps = numTaps;
+		output.indices.resize(dstSize * numTaps);
+		output.weights.resize(dstSize * numTaps);
+
+		for (UINT32 i = 0; i < dstSize; i++)
+		{
+			float center = (i + 0.5f) * scale;
+			INT32 first = Math::floorToInt(center - support);
+
+			UINT32* indices = &output.indices[i * numTaps];
+			float* weights = &output.weights[i * numTaps];
+
+			float totalWeight = 0.0f;
+			for (UINT32 j = 0; j < numTaps; j++)
+			{
+				INT32 srcIdx = first + (INT32)j;
+
+				indices[j] = wrapPixelIndex(srcIdx, srcSize, wrapMode);
+				weights[j] = filter.evaluate((srcIdx + 0.5f - center) / filterScale);
+				totalWeight += weights[j];
+			}
+
+			if (totalWeight != 0.0f)
+			{
+				float invTotalWeight = 1.0f / totalWeight;
+				for (UINT32 j = 0; j < numTaps; j++)
+					weights[j] *= invTotalWeight;
+			}
+			else // Filter too narrow to hit any pixel centers, use the nearest pixel
+			{
+				UINT32 nearest = std::min((UINT32)(Math::floorToInt(center) - first), numTaps - 1);
+				for (UINT32 j = 0; j < numTaps; j++)
+					weights[j] = j == nearest ? 1.0f : 0.0f;
+			}
+		}
+	}
+
+	/** 
+	 * Calculates a row of the destination image by filtering a row of the source image along the horizontal axis. Pixels
+	 * are in PF_FLOAT32_RGBA format.
+	 */
+	void resampleRowHorizontal(const float* src, float* dst, UINT32 dstWidth, const ResampleWeights& weights)
+	{
+		const UINT32 numTaps = weights.numTaps;
+		const UINT32* indices = weights.indices.data();
+		const float* tapWeights = weights.weights.data();
+
+		for (UINT32 x = 0; x < dstWidth; x++)
+		{
+#if BS_PIXEL_SSE
+			__m128 sum = _mm_setzero_ps();
+			for (UINT32 i = 0; i < numTaps; i++)
+				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + indices[i] * 4), _mm_set1_ps(tapWeights[i])));
+
+			_mm_storeu_ps(dst + x * 4, sum);
+#else
+			float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			for (UINT32 i = 0; i < numTaps; i++)
+			{
+				const float* pixel = src + indices[i] * 4;
+				for (UINT32 j = 0; j < 4; j++)
+					sum[j] += pixel[j] * tapWeights[i];
+			}
+
+			memcpy(dst + x * 4, sum, sizeof(sum));
+#endif
+
+			indices += numTaps;
+			tapWeights += numTaps;
+		}
+	}
+
+	/** 
+	 * Calculates a row of the destination image by filtering rows of the source image along the vertical axis. Pixels
+	 * are in PF_FLOAT32_RGBA format.
+	 */
+	void resampleRowVertical(const float* src, float* dst, UINT32 width, UINT32 y, const ResampleWeights& weights)
+	{
+		const UINT32 numTaps = weights.numTaps;
+		const UINT32* indices = &weights.indices[y * numTaps];
+		const float* tapWeights = &weights.weights[y * numTaps];
+		const UINT32 numFloats = width * 4;
+
+		memset(dst, 0, numFloats * sizeof(float));
+		for (UINT32 i = 0; i < numTaps; i++)
+		{
+			float weight = tapWeights[i];
+			if (weight == 0.0f)
+				continue;
+
+			const float* srcRow = src + indices[i] * numFloats;
+			UINT32 x = 0;
+
+#if BS_PIXEL_SSE
+			__m128 weightVec = _mm_set1_ps(weight);
+			for (; x < numFloats; x += 4)
+				_mm_storeu_ps(dst + x, _mm_add_ps(_mm_loadu_ps(dst + x), _mm_mul_ps(_mm_loadu_ps(srcRow + x), weightVec)));
+#endif
+
+			for (; x < numFloats; x++)
+				dst[x] += srcRow[x] * weight;
+		}
+	}
+
+	/** 
+	 * Resamples a two dimensional image using a separable filter. Both source and destination must be consecutive and in
+	 * PF_FLOAT32_RGBA format.
+	 */
+	void resample(const PixelData& src, PixelData& dst, const ResampleFilter& filter, MipMapWrapMode wrapMode)
+	{
+		const UINT32 srcWidth = src.getWidth();
+		const UINT32 srcHeight = src.getHeight();
+		const UINT32 dstWidth = dst.getWidth();
+		const UINT32 dstHeight = dst.getHeight();
+
+		ResampleWeights horzWeights;
+		calculateResampleWeights(srcWidth, dstWidth, filter, wrapMode, horzWeights);
+
+		ResampleWeights vertWeights;
+		calculateResampleWeights(srcHeight, dstHeight, filter, wrapMode, vertWeights);
+
+		const float* srcData = (const float*)src.getData();
+		float* dstData = (float*)dst.getData();
+
+		// Filter horizontally into an image of destination width and source height, then vertically into the destination
+		Vector<float> temp(dstWidth * srcHeight * 4);
+		float* tempData = temp.data();
+
+		auto resampleHorizontal = [&](UINT32 rowBegin, UINT32 rowEnd)
+		{
+			for (UINT32 y = rowBegin; y < rowEnd; y++)
+				resampleRowHorizontal(srcData + y * srcWidth * 4, tempData + y * dstWidth * 4, dstWidth, horzWeights);
+		};
+
+		auto resampleVertical = [&](UINT32 rowBegin, UINT32 rowEnd)
+		{
+			for (UINT32 y = rowBegin; y < rowEnd; y++)
+				resampleRowVertical(tempData, dstData + y * dstWidth * 4, dstWidth, y, vertWeights);
+		};
+
+		processRowBands(srcHeight, dstWidth * horzWeights.numTaps, resampleHorizontal);
+		processRowBands(dstHeight, dstWidth * vertWeights.numTaps, resampleVertical);
+	}
+
+	float srgbToLinear(float value)
+	{
+		if (value <= 0.04045f)
+			return value / 12.92f;
+
+		return std::pow((value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	float linearToSRGB(float value)
+	{
+		if (value <= 0.0031308f)
+			return value * 12.92f;
+
+		return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	/** 
+	 * Converts the color channels of a consecutive PF_FLOAT32_RGBA image between gamma (sRGB) and linear space. Alpha is
+	 * not modified.
+	 */
+	void convertSRGB(PixelData& data, bool toLinear)
+	{
+		const UINT32 width = data.getWidth();
+		float* pixels = (float*)data.getData();
+
+		auto convertRows = [&](UINT32 rowBegin, UINT32 rowEnd)
+		{
+			for (UINT32 i = rowBegin * width; i < rowEnd * width; i++)
+			{
+				float* pixel = pixels + i * 4;
+				for (UINT32 j = 0; j < 3; j++)
+					pixel[j] = toLinear ? srgbToLinear(pixel[j]) : linearToSRGB(pixel[j]);
+			}
+		};
+
+		processRowBands(data.getHeight(), width, convertRows);
+	}
+
+	/** 
+	 * Re-normalizes vectors stored in the color channels of a consecutive PF_FLOAT32_RGBA image. Vector components are
+	 * expected to be encoded in [0, 1] range.
+	 */
+	void normalizeVectors(PixelData& data)
+	{
+		const UINT32 width = data.getWidth();
+		float* pixels = (float*)data.getData();
+
+		auto normalizeRows = [&](UINT32 rowBegin, UINT32 rowEnd)
+		{
+			for (UINT32 i = rowBegin * width; i < rowEnd * width; i++)
+			{
+				float* pixel = pixels + i * 4;
+
+				Vector3 normal(pixel[0] * 2.0f - 1.0f, pixel[1] * 2.0f - 1.0f, pixel[2] * 2.0f - 1.0f);
+				normal.normalize();
+
+				for (UINT32 j = 0; j < 3; j++)
+					pixel[j] = normal[j] * 0.5f + 0.5f;
+			}
+		};
+
+		processRowBands(data.getHeight(), width, normalizeRows);
+	}
+
+	/** 
+	 * Returns the fraction of pixels in a consecutive PF_FLOAT32_RGBA image whose alpha, multiplied by @p alphaScale, is
+	 * above @p cutoff.
+	 */
+	float calculateAlphaCoverage(const PixelData& data, float cutoff, float alphaScale)
+	{
+		const UINT32 numPixels = data.getWidth() * data.getHeight();
+		const float* pixels = (const float*)data.getData();
+
+		UINT32 numCovered = 0;
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			if (pixels[i * 4 + 3] * alphaScale > cutoff)
+				numCovered++;
+		}
+
+		return numCovered / (float)numPixels;
+	}
+
+	/** 
+	 * Scales alpha of all pixels in a consecutive PF_FLOAT32_RGBA image so that the fraction of pixels with alpha above
+	 * @p cutoff matches @p coverage as closely as possible.
+	 */
+	void scaleAlphaToCoverage(PixelData& data, float coverage, float cutoff)
+	{
+		static const UINT32 NUM_ITERATIONS = 10;
+
+		// Binary search for the scale
+		float minScale = 0.0f;
+		float maxScale = 4.0f;
+		float alphaScale = 1.0f;
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			float curCoverage = calculateAlphaCoverage(data, cutoff, alphaScale);
+			if (curCoverage < coverage)
+				minScale = alphaScale;
+			else if (curCoverage > coverage)
+				maxScale = alphaScale;
+			else
+				break;
+
+			alphaScale = (minScale + maxScale) * 0.5f;
+		}
+
+		const UINT32 numPixels = data.getWidth() * data.getHeight();
+		float* pixels = (float*)data.getData();
+
+		for (UINT32 i = 0; i < numPixels; i++)
+			pixels[i * 4 + 3] = std::min(pixels[i * 4 + 3] * alphaScale, 1.0f);
+	}
 
 	void PixelUtil::scale(const PixelData& src, PixelData& scaled, Filter filter)
 	{
@@ -1550,6 +2264,25 @@ namespace BansheeEngine
 
 			break;
 
+		case FILTER_KAISER:
+		case FILTER_LANCZOS:
+			if (src.getDepth() == 1 && scaled.getDepth() == 1)
+			{
+				PixelData srcFloat(src.getWidth(), src.getHeight(), 1, PF_FLOAT32_RGBA);
+				srcFloat.allocateInternalBuffer();
+				bulkPixelConversion(src, srcFloat);
+
+				PixelData scaledFloat(scaled.getWidth(), scaled.getHeight(), 1, PF_FLOAT32_RGBA);
+				scaledFloat.allocateInternalBuffer();
+
+				MipMapFilter resampleFilter = filter == FILTER_KAISER ? MipMapFilter::Kaiser : MipMapFilter::Lanczos;
+				resample(srcFloat, scaledFloat, getResampleFilter(resampleFilter), MipMapWrapMode::Clamp);
+
+				bulkPixelConversion(scaledFloat, scaled);
+				break;
+			}
+
+			// 3D volumes are not supported by the separable filters, fall back to linear filtering
 		case FILTER_LINEAR:
 			switch (src.getFormat()) 
 			{
@@ -1697,76 +2430,70 @@ namespace BansheeEngine
 		if (src.getDepth() != 1)
 			BS_EXCEPT(InvalidParametersException, "3D textures are not supported.");
 
-		// Note: Add support for floating point mips, no reason they shouldn't be supported other than
-		// nvtt doesn't support them natively
-		if (isCompressed(src.getFormat()) || isFloatingPoint(src.getFormat()))
-			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed or in floating point format.");
+		if (isCompressed(src.getFormat()))
+			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed.");
+
+		const ResampleFilter filter = getResampleFilter(options.filter);
+		const UINT32 numMips = getMaxMipmaps(src.getWidth(), src.getHeight(), 1, src.getFormat());
 
-		if (!Math::isPow2(src.getWidth()) || !Math::isPow2(src.getHeight()))
-			BS_EXCEPT(InvalidParametersException, "Texture width & height must be powers of 2.");
+		Vector<SPtr<PixelData>> outputMipBuffers;
 
-		PixelData argbData(src.getWidth(), src.getHeight(), 1, PF_A8R8G8B8);
-		argbData.allocateInternalBuffer();
-		bulkPixelConversion(src, argbData);
+		SPtr<PixelData> baseBuffer = bs_shared_ptr_new<PixelData>(src.getWidth(), src.getHeight(), 1, src.getFormat());
+		baseBuffer->allocateInternalBuffer();
+		bulkPixelConversion(src, *baseBuffer);
 
-		nvtt::InputOptions io;
-		io.setTextureLayout(nvtt::TextureType_2D, src.getWidth(), src.getHeight());
-		io.setMipmapData(argbData.getData(), src.getWidth(), src.getHeight());
-		io.setMipmapGeneration(true);
-		io.setNormalMap(options.isNormalMap);
-		io.setNormalizeMipmaps(options.normalizeMipmaps);
-		io.setWrapMode(toNVTTWrapMode(options.wrapMode));
+		outputMipBuffers.push_back(baseBuffer);
 
-		nvtt::CompressionOptions co;
-		co.setFormat(nvtt::Format_RGBA);
-		
-		UINT32 numMips = getMaxMipmaps(src.getWidth(), src.getHeight(), 1, src.getFormat());
+		if (numMips == 0)
+			return outputMipBuffers;
+
+		// Each mip level is filtered from the previous one. Levels are kept in full precision and in linear space, and
+		// are only converted to the output format when written out.
+		SPtr<PixelData> curLevel = bs_shared_ptr_new<PixelData>(src.getWidth(), src.getHeight(), 1, PF_FLOAT32_RGBA);
+		curLevel->allocateInternalBuffer();
+		bulkPixelConversion(src, *curLevel);
+
+		if (options.isSRGB)
+			convertSRGB(*curLevel, true);
 
-		Vector<SPtr<PixelData>> argbMipBuffers;
+		float targetCoverage = 0.0f;
+		if (options.preserveAlphaCoverage)
+			targetCoverage = calculateAlphaCoverage(*curLevel, options.alphaCoverageCutoff, 1.0f);
 
-		// Note: This can be done more effectively without creating so many temp buffers
-		// and working with the original formats directly, but it would complicate the code
-		// too much at the moment.
-		UINT32 curWidth = src.getWidth();
-		UINT32 curHeight = src.getHeight();
 		for (UINT32 i = 0; i < numMips; i++)
 		{
-			argbMipBuffers.push_back(bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, PF_A8R8G8B8));
-			argbMipBuffers.back()->allocateInternalBuffer();
+			UINT32 width = std::max(1U, curLevel->getWidth() / 2);
+			UINT32 height = std::max(1U, curLevel->getHeight() / 2);
 
-			if (curWidth > 1) 
-				curWidth = curWidth / 2;
+			SPtr<PixelData> nextLevel = bs_shared_ptr_new<PixelData>(width, height, 1, PF_FLOAT32_RGBA);
+			nextLevel->allocateInternalBuffer();
 
-			if (curHeight > 1)
-				curHeight = curHeight / 2;
-		}
+			resample(*curLevel, *nextLevel, filter, options.wrapMode);
 
-		argbMipBuffers.push_back(bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, PF_A8R8G8B8));
-		argbMipBuffers.back()->allocateInternalBuffer();
+			if (options.isNormalMap && options.normalizeMipmaps)
+				normalizeVectors(*nextLevel);
 
-		NVTTMipmapOutputHandler outputHandler(argbMipBuffers);
+			if (options.preserveAlphaCoverage)
+				scaleAlphaToCoverage(*nextLevel, targetCoverage, options.alphaCoverageCutoff);
 
-		nvtt::OutputOptions oo;
-		oo.setOutputHeader(false);
-		oo.setOutputHandler(&outputHandler);
-
-		nvtt::Compressor compressor;
-		if (!compressor.process(io, co, oo))
-			BS_EXCEPT(InternalErrorException, "Mipmap generation failed.");
+			SPtr<PixelData> outputBuffer = bs_shared_ptr_new<PixelData>(width, height, 1, src.getFormat());
+			outputBuffer->allocateInternalBuffer();
 
-		argbData.freeInternalBuffer();
+			if (options.isSRGB)
+			{
+				PixelData gammaLevel(width, height, 1, PF_FLOAT32_RGBA);
+				gammaLevel.allocateInternalBuffer();
 
-		Vector<SPtr<PixelData>> outputMipBuffers;
-		for (UINT32 i = 0; i < (UINT32)argbMipBuffers.size(); i++)
-		{
-			SPtr<PixelData> argbBuffer = argbMipBuffers[i];
-			SPtr<PixelData> outputBuffer = bs_shared_ptr_new<PixelData>(argbBuffer->getWidth(), argbBuffer->getHeight(), 1, src.getFormat());
-			outputBuffer->allocateInternalBuffer();
+				memcpy(gammaLevel.getData(), nextLevel->getData(), nextLevel->getConsecutiveSize());
+				convertSRGB(gammaLevel, false);
 
-			bulkPixelConversion(*argbBuffer, *outputBuffer);
-			argbBuffer->freeInternalBuffer();
+				bulkPixelConversion(gammaLevel, *outputBuffer);
+			}
+			else
+				bulkPixelConversion(*nextLevel, *outputBuffer);
 
 			outputMipBuffers.push_back(outputBuffer);
+			curLevel = nextLevel;
 		}
 
 		return outputMipBuffers;
@@ -6,11 +6,13 @@
 #include "BsSceneObject.h"
 #include "BsPrefabUtility.h"
 #include "BsCoreApplication.h"
+#include "BsMemorySerializer.h"
+#include "BsGameObjectManager.h"
 
 namespace BansheeEngine
 {
 	Prefab::Prefab()
-		:Resource(false), mHash(0), mNextLinkId(0)
+		:Resource(false), mHash(0), mNextLinkId(0), mInstantiationData(nullptr), mInstantiationDataSize(0)
 	{
 		
 	}
@@ -19,6 +21,8 @@ namespace BansheeEngine
 	{
 		if (mRoot != nullptr)
 			mRoot->destroy(true);
+
+		clearInstantiationData();
 	}
 
 	HPrefab Prefab::create(const HSceneObject& sceneObject)
@@ -29,7 +33,7 @@ namespace BansheeEngine
 		HPrefab handle = static_resource_cast<Prefab>(gResources()._createResourceHandle(newPrefab));
 		newPrefab->mUUID = handle.getUUID();
 		sceneObject->mPrefabLinkUUID = newPrefab->mUUID;
-		newPrefab->_getRoot()->mPrefabLinkUUID = newPrefab->mUUID;
+		newPrefab->mRoot->mPrefabLinkUUID = newPrefab->mUUID;
 
 		return handle;
 	}
@@ -44,6 +48,8 @@ namespace BansheeEngine
 
 	void Prefab::initialize(const HSceneObject& sceneObject)
 	{
+		clearInstantiationData();
+
 		sceneObject->mPrefabDiff = nullptr;
 		UINT32 newNextLinkId = PrefabUtility::generatePrefabIds(sceneObject, mNextLinkId);
 
@@ -106,6 +112,7 @@ namespace BansheeEngine
 		mRoot->mPrefabLinkUUID = mUUID;
 
 		mHash++;
+		clearInstantiationData();
 	}
 
 	void Prefab::_updateChildInstances()
@@ -129,6 +136,9 @@ namespace BansheeEngine
 					todo.push(child);
 			}
 		}
+
+		// Child instances might have been replaced
+		clearInstantiationData();
 	}
 
 	HSceneObject Prefab::instantiate()
@@ -150,13 +160,49 @@ namespace BansheeEngine
 		return clone;
 	}
 
+	HSceneObject Prefab::_editRoot()
+	{
+		clearInstantiationData();
+
+		return mRoot;
+	}
+
 	HSceneObject Prefab::_clone()
 	{
 		if (mRoot == nullptr)
 			return HSceneObject();
 
+		if (mInstantiationData == nullptr)
+			createInstantiationData();
+
+		// Same as SceneObject::clone(), except the hierarchy is already encoded
+		MemorySerializer serializer;
+		GameObjectManager::instance().setDeserializationMode(GODM_UseNewIds | GODM_RestoreExternal);
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
+			serializer.decode(mInstantiationData, mInstantiationDataSize));
+
+		return cloneObj->getHandle();
+	}
+
+	void Prefab::clearInstantiationData()
+	{
+		if (mInstantiationData != nullptr)
+		{
+			bs_free(mInstantiationData);
+
+			mInstantiationData = nullptr;
+			mInstantiationDataSize = 0;
+		}
+	}
+
+	void Prefab::createInstantiationData()
+	{
+		clearInstantiationData();
+
 		mRoot->mPrefabHash = mHash;
-		return mRoot->clone();
+
+		MemorySerializer serializer;
+		mInstantiationData = serializer.encode(mRoot.get(), mInstantiationDataSize, (void*(*)(UINT32))&bs_alloc);
 	}
 
 	RTTITypeBase* Prefab::getRTTIStatic()
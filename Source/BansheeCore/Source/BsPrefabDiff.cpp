@@ -52,6 +52,24 @@ namespace BansheeEngine
 		return output;
 	}
 
+	SPtr<PrefabDiff> PrefabDiff::createRevert(const HSceneObject& prefab, const HSceneObject& instance)
+	{
+		if (prefab->mPrefabLinkUUID != instance->mPrefabLinkUUID)
+			return nullptr;
+
+		// Same as create(), except the diff is generated in the opposite direction. Prefab objects are still the ones 
+		// being renamed, since the diff will be applied to the instance and must reference the instance's IDs.
+		Vector<RenamedGameObject> renamedObjects;
+		renameInstanceIds(prefab, instance, renamedObjects);
+
+		SPtr<PrefabDiff> output = bs_shared_ptr_new<PrefabDiff>();
+		output->mRoot = generateDiff(instance, prefab);
+
+		restoreInstanceIds(renamedObjects);
+
+		return output;
+	}
+
 	void PrefabDiff::apply(const HSceneObject& object)
 	{
 		if (mRoot == nullptr)
@@ -114,7 +132,7 @@ namespace BansheeEngine
 			BinarySerializer bs;
 			SPtr<Component> component = std::static_pointer_cast<Component>(bs._decodeFromIntermediate(addedComponentData));
 
-			object->addComponentInternal(component);
+			object->addAndInitializeComponent(component);
 		}
 
 		for (auto& addedChildData : diff->addedChildren)
@@ -0,0 +1,110 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsPrefabPool.h"
+#include "BsPrefabDiff.h"
+#include "BsSceneObject.h"
+#include "BsCoreSceneManager.h"
+
+namespace BansheeEngine
+{
+	PrefabPool::PrefabPool(const HPrefab& prefab, UINT32 initialSize)
+		:mPrefab(prefab), mPrefabHash(0)
+	{
+		if (!mPrefab.isLoaded(false))
+			return;
+
+		mPrefabHash = mPrefab->getHash();
+
+		mPooled.reserve(initialSize);
+		for (UINT32 i = 0; i < initialSize; i++)
+		{
+			HSceneObject instance = mPrefab->instantiate();
+			instance->setActive(false);
+
+			mPooled.push_back(instance);
+		}
+	}
+
+	PrefabPool::~PrefabPool()
+	{
+		clear();
+	}
+
+	HSceneObject PrefabPool::instantiate()
+	{
+		if (!checkPrefabHash())
+			return HSceneObject();
+
+		while (!mPooled.empty())
+		{
+			HSceneObject instance = mPooled.back();
+			mPooled.pop_back();
+
+			// Pooled instance could have been destroyed along with the scene
+			if (instance.isDestroyed(true))
+				continue;
+
+			instance->setActive(mPrefab->_getRoot()->getActive(true));
+			return instance;
+		}
+
+		return mPrefab->instantiate();
+	}
+
+	void PrefabPool::release(const HSceneObject& instance)
+	{
+		if (instance.isDestroyed(true))
+			return;
+
+		if (!checkPrefabHash())
+		{
+			instance->destroy();
+			return;
+		}
+
+		instance->setParent(gCoreSceneManager().getRootNode(), false);
+
+		// Revert only the modified state, rather than re-creating the entire hierarchy
+		SPtr<PrefabDiff> revertDiff = PrefabDiff::createRevert(mPrefab->_getRoot(), instance);
+		if (revertDiff == nullptr)
+		{
+			// Not an instance of this prefab
+			instance->destroy();
+			return;
+		}
+
+		revertDiff->apply(instance);
+		instance->setActive(false);
+
+		mPooled.push_back(instance);
+	}
+
+	void PrefabPool::clear()
+	{
+		for (auto& instance : mPooled)
+		{
+			if (!instance.isDestroyed(true))
+				instance->destroy();
+		}
+
+		mPooled.clear();
+	}
+
+	bool PrefabPool::checkPrefabHash()
+	{
+		if (!mPrefab.isLoaded(false))
+		{
+			clear();
+			return false;
+		}
+
+		// Pooled instances would be reverted to an outdated version of the prefab
+		if (mPrefab->getHash() != mPrefabHash)
+		{
+			clear();
+			mPrefabHash = mPrefab->getHash();
+		}
+
+		return true;
+	}
+}
@@ -104,6 +104,7 @@ namespace BansheeEngine
 
 				HSceneObject parent = current->getParent();
 				SPtr<PrefabDiff> prefabDiff = current->mPrefabDiff;
+				bool isInstantiated = current->isInstantiated();
 
 				current->destroy(true);
 				HSceneObject newInstance = prefabLink->_clone();
@@ -117,6 +118,11 @@ namespace BansheeEngine
 				restoreLinkedInstanceData(newInstance, soProxy, linkedInstanceData);
 				restoreUnlinkedInstanceData(newInstance, soProxy);
 
+				// Instantiate before the diff is applied, so components it adds are initialized and registered for
+				// updates same as ones added to any other live object
+				if (isInstantiated)
+					newInstance->_instantiate();
+
 				newPrefabInstanceData.push_back({ newInstance, parent, prefabDiff, newInstance->getLinkId() });
 			}
 		}
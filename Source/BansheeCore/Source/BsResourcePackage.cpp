@@ -0,0 +1,280 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsResourcePackage.h"
+#include "BsDataStream.h"
+#include "BsFileSystem.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * Stream providing access to a single entry in a ResourcePackage. References the mapped package memory directly and
+	 * keeps the mapping alive for as long as the stream (or any of its clones) exist.
+	 */
+	class ResourcePackageEntryStream : public MemoryDataStream
+	{
+	public:
+		ResourcePackageEntryStream(const SPtr<MemoryMappedDataStream>& packageData, UINT8* data, size_t size)
+			:MemoryDataStream(data, size, false), mPackageData(packageData)
+		{
+			mAccess = READ;
+		}
+
+		/** @copydoc DataStream::isMemoryMapped */
+		bool isMemoryMapped() const override { return mData != nullptr; }
+
+		/** @copydoc DataStream::clone */
+		SPtr<DataStream> clone(bool copyData = true) const override
+		{
+			if (!copyData)
+				return bs_shared_ptr_new<ResourcePackageEntryStream>(mPackageData, mData, mSize);
+
+			return MemoryDataStream::clone(true);
+		}
+
+		/** @copydoc DataStream::close */
+		void close() override
+		{
+			mData = mPos = mEnd = nullptr;
+			mSize = 0;
+
+			mPackageData = nullptr;
+		}
+
+	private:
+		SPtr<MemoryMappedDataStream> mPackageData;
+	};
+
+	/** Rounds @p value up to the nearest multiple of @p alignment. @p alignment must be a power of two. */
+	static UINT64 alignOffset(UINT64 value, UINT64 alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	ResourcePackage::ResourcePackage(const ConstructPrivately& dummy, const Path& filePath)
+		:mPath(filePath), mEntries(nullptr), mNumEntries(0)
+	{
+		mData = bs_shared_ptr_new<MemoryMappedDataStream>(filePath);
+		if (!mData->isMemoryMapped())
+			return;
+
+		UINT8* packageData = mData->getPtr();
+		UINT64 packageSize = (UINT64)mData->size();
+
+		if (packageSize < sizeof(Header))
+		{
+			LOGWRN("Resource package \"" + filePath.toString() + "\" is corrupt.");
+			return;
+		}
+
+		const Header* header = (const Header*)packageData;
+		if (header->magic != MAGIC || header->version != VERSION)
+		{
+			LOGWRN("File \"" + filePath.toString() + "\" is not a valid resource package.");
+			return;
+		}
+
+		UINT64 tocSize = header->numEntries * (UINT64)sizeof(TOCEntry);
+		if (header->tocOffset > packageSize || tocSize > (packageSize - header->tocOffset))
+		{
+			LOGWRN("Resource package \"" + filePath.toString() + "\" is corrupt.");
+			return;
+		}
+
+		mEntries = (const TOCEntry*)(packageData + header->tocOffset);
+		mNumEntries = header->numEntries;
+	}
+
+	bool ResourcePackage::contains(const String& uuid) const
+	{
+		return findEntry(uuid) != nullptr;
+	}
+
+	SPtr<DataStream> ResourcePackage::openEntry(const String& uuid) const
+	{
+		const TOCEntry* entry = findEntry(uuid);
+		if (entry == nullptr)
+			return nullptr;
+
+		ResourcePackageEntryFlags flags = (ResourcePackageEntryFlag)entry->flags;
+		if (flags.isSet(ResourcePackageEntryFlag::Compressed))
+		{
+			LOGERR("Cannot load resource \"" + uuid + "\" from package \"" + mPath.toString() + "\". Compressed "
+				"entries are not supported.");
+			return nullptr;
+		}
+
+		UINT64 packageSize = (UINT64)mData->size();
+		if (entry->offset > packageSize || entry->size > (packageSize - entry->offset) || entry->size > MAX_ENTRY_SIZE)
+		{
+			LOGERR("Cannot load resource \"" + uuid + "\" from package \"" + mPath.toString() + "\". Entry is corrupt.");
+			return nullptr;
+		}
+
+		UINT8* entryData = mData->getPtr() + entry->offset;
+		return bs_shared_ptr_new<ResourcePackageEntryStream>(mData, entryData, (size_t)entry->size);
+	}
+
+	const ResourcePackage::TOCEntry* ResourcePackage::findEntry(const String& uuid) const
+	{
+		if (uuid.size() != UUID_LENGTH)
+			return nullptr;
+
+		const TOCEntry* entriesEnd = mEntries + mNumEntries;
+		auto iterFind = std::lower_bound(mEntries, entriesEnd, uuid,
+			[](const TOCEntry& entry, const String& key)
+		{
+			return memcmp(entry.uuid, key.data(), UUID_LENGTH) < 0;
+		});
+
+		if (iterFind == entriesEnd || memcmp(iterFind->uuid, uuid.data(), UUID_LENGTH) != 0)
+			return nullptr;
+
+		return iterFind;
+	}
+
+	SPtr<ResourcePackage> ResourcePackage::load(const Path& filePath)
+	{
+		if (!FileSystem::isFile(filePath))
+			return nullptr;
+
+		SPtr<ResourcePackage> package = bs_shared_ptr_new<ResourcePackage>(ConstructPrivately(), filePath);
+		if (package->mEntries == nullptr)
+			return nullptr;
+
+		return package;
+	}
+
+	bool ResourcePackage::create(const Vector<RESOURCE_PACKAGE_ENTRY_DESC>& resources, const Path& filePath,
+		UINT32 alignment)
+	{
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+		// Sort by UUID so entries can be looked up using binary search
+		Vector<const RESOURCE_PACKAGE_ENTRY_DESC*> sortedResources;
+		for (auto& entry : resources)
+		{
+			if (entry.uuid.size() != UUID_LENGTH)
+			{
+				LOGWRN("Skipping resource \"" + entry.filePath.toString() + "\" when creating a resource package. "
+					"Invalid UUID: \"" + entry.uuid + "\".");
+				continue;
+			}
+
+			if (!FileSystem::isFile(entry.filePath))
+			{
+				LOGWRN("Skipping resource \"" + entry.filePath.toString() + "\" when creating a resource package. "
+					"File doesn't exist.");
+				continue;
+			}
+
+			// Entries are read through 32-bit sized streams when loaded
+			if (FileSystem::getFileSize(entry.filePath) > MAX_ENTRY_SIZE)
+			{
+				LOGWRN("Skipping resource \"" + entry.filePath.toString() + "\" when creating a resource package. "
+					"Resources larger than 4 GB are not supported.");
+				continue;
+			}
+
+			sortedResources.push_back(&entry);
+		}
+
+		std::sort(sortedResources.begin(), sortedResources.end(),
+			[](const RESOURCE_PACKAGE_ENTRY_DESC* lhs, const RESOURCE_PACKAGE_ENTRY_DESC* rhs)
+		{
+			return lhs->uuid < rhs->uuid;
+		});
+
+		auto iterUnique = std::unique(sortedResources.begin(), sortedResources.end(),
+			[](const RESOURCE_PACKAGE_ENTRY_DESC* lhs, const RESOURCE_PACKAGE_ENTRY_DESC* rhs)
+		{
+			return lhs->uuid == rhs->uuid;
+		});
+		sortedResources.erase(iterUnique, sortedResources.end());
+
+		// Lay out the entries, so the table of contents is known before any data is written
+		UINT32 numEntries = (UINT32)sortedResources.size();
+		Vector<TOCEntry> toc(numEntries);
+
+		UINT64 offset = sizeof(Header);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const RESOURCE_PACKAGE_ENTRY_DESC* resource = sortedResources[i];
+
+			offset = alignOffset(offset, alignment);
+
+			TOCEntry& tocEntry = toc[i];
+			memcpy(tocEntry.uuid, resource->uuid.data(), UUID_LENGTH);
+			tocEntry.flags = (UINT32)ResourcePackageEntryFlag::None;
+			tocEntry.offset = offset;
+			tocEntry.size = FileSystem::getFileSize(resource->filePath);
+
+			offset += tocEntry.size;
+		}
+
+		Header header;
+		header.magic = MAGIC;
+		header.version = VERSION;
+		header.numEntries = numEntries;
+		header.alignment = alignment;
+		header.tocOffset = alignOffset(offset, sizeof(UINT64));
+
+		SPtr<DataStream> output = FileSystem::createAndOpenFile(filePath);
+		if (output == nullptr)
+		{
+			LOGWRN("Failed to create resource package: \"" + filePath.toString() + "\".");
+			return false;
+		}
+
+		output->write(&header, sizeof(header));
+		UINT64 writeOffset = sizeof(header);
+
+		UINT8 padding[256];
+		memset(padding, 0, sizeof(padding));
+
+		auto writePadding = [&](UINT64 targetOffset)
+		{
+			while (writeOffset < targetOffset)
+			{
+				UINT64 numBytes = std::min(targetOffset - writeOffset, (UINT64)sizeof(padding));
+				output->write(padding, (size_t)numBytes);
+
+				writeOffset += numBytes;
+			}
+		};
+
+		bool success = true;
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			TOCEntry& tocEntry = toc[i];
+			writePadding(tocEntry.offset);
+
+			if (tocEntry.size == 0)
+				continue;
+
+			// Copy straight from the mapped file, so the entry never needs to be fully loaded into a separate buffer
+			MemoryMappedDataStream input(sortedResources[i]->filePath);
+			if (input.isMemoryMapped() && input.size() == tocEntry.size)
+			{
+				output->write(input.getPtr(), (size_t)tocEntry.size);
+				writeOffset += tocEntry.size;
+			}
+			else
+			{
+				LOGWRN("Failed to read resource \"" + sortedResources[i]->filePath.toString() + "\" when creating a "
+					"resource package.");
+
+				writePadding(tocEntry.offset + tocEntry.size);
+				success = false;
+			}
+		}
+
+		writePadding(header.tocOffset);
+
+		if (numEntries > 0)
+			output->write(toc.data(), numEntries * sizeof(TOCEntry));
+
+		output->close();
+		return success;
+	}
+}
@@ -3,6 +3,7 @@
 #include "BsResources.h"
 #include "BsResource.h"
 #include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
 #include "BsException.h"
 #include "BsFileSerializer.h"
 #include "BsFileSystem.h"
@@ -37,20 +38,25 @@ namespace BansheeEngine
 
 	HResource Resources::load(const Path& filePath, ResourceLoadFlags loadFlags)
 	{
-		if (!FileSystem::isFile(filePath))
+		String uuid;
+		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
+
+		// Packaged resources don't exist as individual files, and are found through their UUID instead
+		SPtr<ResourcePackage> package;
+		if (foundUUID)
+			package = findPackage(uuid);
+
+		if (package == nullptr && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
 			return HResource();
 		}
 
-		String uuid;
-		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
-
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
-		return loadInternal(uuid, filePath, true, loadFlags);
+		return loadInternal(uuid, filePath, package, true, loadFlags);
 	}
 
 	HResource Resources::load(const WeakResourceHandle<Resource>& handle, ResourceLoadFlags loadFlags)
@@ -64,24 +70,34 @@ namespace BansheeEngine
 
 	HResource Resources::loadAsync(const Path& filePath, ResourceLoadFlags loadFlags)
 	{
-		if (!FileSystem::isFile(filePath))
+		String uuid;
+		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
+
+		// Packaged resources don't exist as individual files, and are found through their UUID instead
+		SPtr<ResourcePackage> package;
+		if (foundUUID)
+			package = findPackage(uuid);
+
+		if (package == nullptr && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
 			return HResource();
 		}
 
-		String uuid;
-		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
-
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
-		return loadInternal(uuid, filePath, false, loadFlags);
+		return loadInternal(uuid, filePath, package, false, loadFlags);
 	}
 
 	HResource Resources::loadFromUUID(const String& uuid, bool async, ResourceLoadFlags loadFlags)
 	{
+		// Packaged resources take priority, as they avoid opening a separate file per resource
+		SPtr<ResourcePackage> package = findPackage(uuid);
+		if (package != nullptr)
+			return loadInternal(uuid, Path::BLANK, package, !async, loadFlags);
+
 		Path filePath;
 
 		// Default manifest is at 0th index but all other take priority since Default manifest could
@@ -92,10 +108,11 @@ namespace BansheeEngine
 				break;
 		}
 
-		return loadInternal(uuid, filePath, !async, loadFlags);
+		return loadInternal(uuid, filePath, nullptr, !async, loadFlags);
 	}
 
-	HResource Resources::loadInternal(const String& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags)
+	HResource Resources::loadInternal(const String& UUID, const Path& filePath, const SPtr<ResourcePackage>& package, 
+		bool synchronous, ResourceLoadFlags loadFlags)
 	{
 		HResource outputResource;
 
@@ -162,7 +179,8 @@ namespace BansheeEngine
 
 		// We have nowhere to load from, warn and complete load if a file path was provided,
 		// otherwise pass through as we might just want to load from memory. 
-		if (filePath.isEmpty())
+		bool hasSource = package != nullptr || !filePath.isEmpty();
+		if (!hasSource)
 		{
 			if (!alreadyLoading)
 			{
@@ -174,7 +192,7 @@ namespace BansheeEngine
 				return outputResource;
 			}
 		}
-		else if (!FileSystem::isFile(filePath))
+		else if (package == nullptr && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
@@ -186,9 +204,18 @@ namespace BansheeEngine
 			return outputResource;
 		}
 
-		// Load dependency data if a file path is provided
+		// Load dependency data if a file path or a package is provided
 		SPtr<SavedResourceData> savedResourceData;
-		if (!filePath.isEmpty())
+		if (package != nullptr)
+		{
+			SPtr<DataStream> entryStream = package->openEntry(UUID);
+			if (entryStream != nullptr)
+			{
+				FileDecoder fs(entryStream);
+				savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+			}
+		}
+		else if (!filePath.isEmpty())
 		{
 			FileDecoder fs(filePath);
 			savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
@@ -314,21 +341,21 @@ namespace BansheeEngine
 		}
 
 		// Actually start the file read operation if not already loaded or in progress
-		if (!alreadyLoading && !filePath.isEmpty())
+		if (!alreadyLoading && hasSource)
 		{
 			// Synchronous or the resource doesn't support async, read the file immediately
-			if (synchronous || !savedResourceData->allowAsyncLoading())
+			if (synchronous || savedResourceData == nullptr || !savedResourceData->allowAsyncLoading())
 			{
-				loadCallback(filePath, outputResource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
+				loadCallback(filePath, package, outputResource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
 			}
 			else // Asynchronous, read the file on a worker thread
 			{
-				String fileName = filePath.getFilename();
+				String fileName = package != nullptr ? UUID : filePath.getFilename();
 				String taskName = "Resource load: " + fileName;
 
 				bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
 				SPtr<Task> task = Task::create(taskName, 
-					std::bind(&Resources::loadCallback, this, filePath, outputResource, keepSourceData));
+					std::bind(&Resources::loadCallback, this, filePath, package, outputResource, keepSourceData));
 				TaskScheduler::instance().addTask(task);
 			}
 		}
@@ -353,20 +380,44 @@ namespace BansheeEngine
 		return outputResource;
 	}
 
-	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData)
+	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const String& UUID, const Path& filePath, 
+		const SPtr<ResourcePackage>& package, bool loadWithSaveData)
 	{
-		FileDecoder fs(filePath);
-		fs.skip(); // Skipped over saved resource data
-
 		UnorderedMap<String, UINT64> loadParams;
 		if(loadWithSaveData)
 			loadParams["keepSourceData"] = 1;
 
-		SPtr<IReflectable> loadedData = fs.decode(loadParams);
+		SPtr<IReflectable> loadedData;
+		if (package != nullptr)
+		{
+			// Package is memory mapped, so data blocks can be referenced directly same as with individual files below
+			SPtr<DataStream> entryStream = package->openEntry(UUID);
+			if (entryStream != nullptr)
+			{
+				FileDecoder fs(entryStream);
+				fs.skip(); // Skipped over saved resource data
+
+				loadedData = fs.decode(loadParams);
+			}
+		}
+		else
+		{
+			// Map the file so large data blocks (e.g. mesh and texture data) can be referenced directly until uploaded
+			FileDecoder fs(filePath, true);
+			fs.skip(); // Skipped over saved resource data
+
+			loadedData = fs.decode(loadParams);
+		}
 
 		if (loadedData == nullptr)
 		{
-			LOGERR("Unable to load resource at path \"" + filePath.toString() + "\"");
+			if (package != nullptr)
+			{
+				LOGERR("Unable to load resource \"" + UUID + "\" from package \"" + 
+					package->getPath().toString() + "\"");
+			}
+			else
+				LOGERR("Unable to load resource at path \"" + filePath.toString() + "\"");
 		}
 		else
 		{
@@ -601,6 +652,38 @@ namespace BansheeEngine
 			mResourceManifests.erase(findIter);
 	}
 
+	void Resources::registerResourcePackage(const SPtr<ResourcePackage>& package)
+	{
+		Lock lock(mResourcePackagesMutex);
+
+		auto findIter = std::find(mResourcePackages.begin(), mResourcePackages.end(), package);
+		if (findIter == mResourcePackages.end())
+			mResourcePackages.push_back(package);
+	}
+
+	void Resources::unregisterResourcePackage(const SPtr<ResourcePackage>& package)
+	{
+		Lock lock(mResourcePackagesMutex);
+
+		auto findIter = std::find(mResourcePackages.begin(), mResourcePackages.end(), package);
+		if (findIter != mResourcePackages.end())
+			mResourcePackages.erase(findIter);
+	}
+
+	SPtr<ResourcePackage> Resources::findPackage(const String& uuid) const
+	{
+		// Called from async load threads when resolving dependencies
+		Lock lock(mResourcePackagesMutex);
+
+		for (auto iter = mResourcePackages.rbegin(); iter != mResourcePackages.rend(); ++iter)
+		{
+			if ((*iter)->contains(uuid))
+				return *iter;
+		}
+
+		return nullptr;
+	}
+
 	SPtr<ResourceManifest> Resources::getResourceManifest(const String& name) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
@@ -756,9 +839,10 @@ namespace BansheeEngine
 		}
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
+	void Resources::loadCallback(const Path& filePath, const SPtr<ResourcePackage>& package, HResource& resource, 
+		bool loadWithSaveData)
 	{
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData);
+		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(resource.getUUID(), filePath, package, loadWithSaveData);
 
 		{
 			Lock lock(mInProgressResourcesMutex);
@@ -10,15 +10,27 @@
 #include "BsGameObjectManager.h"
 #include "BsPrefabUtility.h"
 #include "BsMatrix3.h"
+#include "BsTaskScheduler.h"
 #include "BsCoreApplication.h"
+#include "BsTransformHierarchy.h"
 
 namespace BansheeEngine
 {
+	/** Minimum number of objects in a bulk transform update before its work is split between multiple threads. */
+	static const UINT32 PARALLEL_TFRM_UPDATE_MIN = 1024;
+
+	/** Number of objects processed by a single job during a parallel bulk transform update. */
+	static const UINT32 PARALLEL_TFRM_UPDATE_GRANULARITY = 256;
+
+	/** Stamp assigned to the objects of the most recent bulk transform update. */
+	static UINT32 gLastTfrmUpdateStamp = 0;
+
 	SceneObject::SceneObject(const String& name, UINT32 flags)
 		: GameObject(), mPrefabHash(0), mFlags(flags), mPosition(Vector3::ZERO), mRotation(Quaternion::IDENTITY)
 		, mScale(Vector3::ONE), mWorldPosition(Vector3::ZERO), mWorldRotation(Quaternion::IDENTITY)
 		, mWorldScale(Vector3::ONE), mCachedLocalTfrm(Matrix4::IDENTITY), mCachedWorldTfrm(Matrix4::IDENTITY)
-		, mDirtyFlags(0xFFFFFFFF), mDirtyHash(0), mActiveSelf(true), mActiveHierarchy(true)
+		, mDirtyFlags(0xFFFFFFFF), mDirtyHash(0), mTfrmHierarchy(nullptr), mTfrmIdx(0), mTfrmGeneration(0)
+		, mTfrmUpdateStamp(0), mActiveSelf(true), mActiveHierarchy(true)
 	{
 		setName(name);
 	}
@@ -63,6 +75,22 @@ namespace BansheeEngine
 
 	void SceneObject::destroy(bool immediate)
 	{
+		// Object is removed from the scene right away, so stop updating its components even if the actual destruction
+		// is delayed
+		if (!immediate && isInstantiated() && CoreSceneManager::isStarted())
+		{
+			std::function<void(SceneObject*)> stopUpdatesRecursive = [&](SceneObject* obj)
+			{
+				for (auto& component : obj->mComponents)
+					gCoreSceneManager()._notifyComponentDeactivated(component.get());
+
+				for (auto& child : obj->mChildren)
+					stopUpdatesRecursive(child.get());
+			};
+
+			stopUpdatesRecursive(this);
+		}
+
 		// Parent is our owner, so when his reference to us is removed, delete might be called.
 		// So make sure this is the last thing we do.
 		if(mParent != nullptr)
@@ -73,6 +101,7 @@ namespace BansheeEngine
 			mParent = nullptr;
 		}
 
+		notifyTfrmHierarchyChanged();
 		destroyInternal(mThisHandle, immediate);
 	}
 
@@ -93,7 +122,7 @@ namespace BansheeEngine
 				if (isInstantiated())
 				{
 					if (getActive())
-						component->onDisabled();
+						disableComponent(component);
 
 					component->onDestroyed();
 				}
@@ -220,7 +249,7 @@ namespace BansheeEngine
 				component->onInitialized();
 
 				if (obj->getActive())
-					component->onEnabled();
+					obj->enableComponent(component);
 			}
 
 			for (auto& child : obj->mChildren)
@@ -292,7 +321,7 @@ namespace BansheeEngine
 		{
 			Matrix3 rotScale;
 			mParent->getWorldTfrm().extract3x3Matrix(rotScale);
-			rotScale.inverse();
+			rotScale = rotScale.inverse();
 
 			Matrix3 scaleMat = Matrix3(Quaternion::IDENTITY, scale);
 			scaleMat = rotScale * scaleMat;
@@ -311,22 +340,31 @@ namespace BansheeEngine
 
 	const Vector3& SceneObject::getWorldPosition() const
 	{ 
+		if (isTfrmManaged())
+			return mTfrmHierarchy->_getWorldPosition(mTfrmIdx);
+
 		if (!isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 
 		return mWorldPosition; 
 	}
 
-	const Quaternion& SceneObject::getWorldRotation() const 
+	const Quaternion& SceneObject::getWorldRotation() const
 	{ 
+		if (isTfrmManaged())
+			return mTfrmHierarchy->_getWorldRotation(mTfrmIdx);
+
 		if (!isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 
 		return mWorldRotation; 
 	}
 
-	const Vector3& SceneObject::getWorldScale() const 
+	const Vector3& SceneObject::getWorldScale() const
 	{ 
+		if (isTfrmManaged())
+			return mTfrmHierarchy->_getWorldScale(mTfrmIdx);
+
 		if (!isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 
@@ -344,6 +382,9 @@ namespace BansheeEngine
 
 	const Matrix4& SceneObject::getWorldTfrm() const
 	{
+		if (isTfrmManaged())
+			return mTfrmHierarchy->_getWorldTfrm(mTfrmIdx);
+
 		if (!isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 
@@ -352,10 +393,7 @@ namespace BansheeEngine
 
 	Matrix4 SceneObject::getInvWorldTfrm() const
 	{
-		if (!isCachedWorldTfrmUpToDate())
-			updateWorldTfrm();
-
-		Matrix4 worldToLocal = Matrix4::inverseTRS(mWorldPosition, mWorldRotation, mWorldScale);
+		Matrix4 worldToLocal = Matrix4::inverseTRS(getWorldPosition(), getWorldRotation(), getWorldScale());
 		return worldToLocal;
 	}
 
@@ -429,23 +467,192 @@ namespace BansheeEngine
 		if (!isCachedLocalTfrmUpToDate())
 			updateLocalTfrm();
 
-		if (!isCachedWorldTfrmUpToDate())
+		if (isTfrmManaged())
+			mTfrmHierarchy->_updateIfDirty(mTfrmIdx);
+		else if (!isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 	}
 
+	void SceneObject::_setWorldTransforms(SceneObjectTransformUpdate* updates, UINT32 count, bool parallel)
+	{
+		if (count == 0)
+			return;
+
+		// Process entries in storage order, so parents come before their children and storage writes are sequential
+		if (updates[0].sceneObject->isTfrmManaged())
+		{
+			auto getStorageIdx = [](const SceneObjectTransformUpdate& entry)
+			{
+				SceneObject* so = entry.sceneObject;
+				return so->isTfrmManaged() ? so->mTfrmIdx : std::numeric_limits<UINT32>::max();
+			};
+
+			std::sort(updates, updates + count, 
+				[&](const SceneObjectTransformUpdate& a, const SceneObjectTransformUpdate& b)
+			{
+				return getStorageIdx(a) < getStorageIdx(b);
+			});
+		}
+
+		gLastTfrmUpdateStamp++;
+		if (gLastTfrmUpdateStamp == 0) // Objects that were never updated have a zero stamp
+			gLastTfrmUpdateStamp++;
+
+		UINT32 stamp = gLastTfrmUpdateStamp;
+		for (UINT32 i = 0; i < count; i++)
+			updates[i].sceneObject->mTfrmUpdateStamp = stamp;
+
+		// Objects whose ancestors are part of the update depend on results of other entries, so they are moved to the
+		// end and handled separately. Parents of all other objects are brought up to date, so their transforms can be
+		// safely read from multiple threads.
+		auto getParent = [](const SceneObject* so) -> SceneObject*
+		{
+			return so->mParent != nullptr ? so->mParent.get() : nullptr;
+		};
+
+		auto isDependent = [&](const SceneObjectTransformUpdate& entry)
+		{
+			for (SceneObject* ancestor = getParent(entry.sceneObject); ancestor != nullptr; ancestor = getParent(ancestor))
+			{
+				if (ancestor->mTfrmUpdateStamp == stamp)
+					return true;
+			}
+
+			return false;
+		};
+
+		UINT32 numIndependent = count;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			if (isDependent(updates[i]))
+			{
+				numIndependent = i;
+				break;
+			}
+
+			SceneObject* parent = getParent(updates[i].sceneObject);
+			if (parent != nullptr)
+				parent->updateTransformsIfDirty();
+		}
+
+		if (numIndependent < count)
+		{
+			auto partitionEnd = std::stable_partition(updates + numIndependent, updates + count, 
+				[&](const SceneObjectTransformUpdate& entry) { return !isDependent(entry); });
+
+			UINT32 newNumIndependent = (UINT32)(partitionEnd - updates);
+			for (UINT32 i = numIndependent; i < newNumIndependent; i++)
+			{
+				SceneObject* parent = getParent(updates[i].sceneObject);
+				if (parent != nullptr)
+					parent->updateTransformsIfDirty();
+			}
+
+			numIndependent = newNumIndependent;
+		}
+
+		auto assignTransforms = [updates](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+				updates[i].sceneObject->setWorldTfrmNoNotify(updates[i].position, updates[i].rotation);
+		};
+
+		if (parallel && numIndependent >= PARALLEL_TFRM_UPDATE_MIN && TaskScheduler::isStarted())
+		{
+			TaskScheduler::instance().parallelFor(0, numIndependent, PARALLEL_TFRM_UPDATE_GRANULARITY, 
+				assignTransforms);
+		}
+		else
+			assignTransforms(0, numIndependent);
+
+		for (UINT32 i = 0; i < numIndependent; i++)
+			updates[i].sceneObject->notifyTfrmListeners(TCF_Transform);
+
+		if (numIndependent == count)
+			return;
+
+		// Remaining objects are updated one by one, parents first, in case their ancestors moved
+		auto getDepth = [&](const SceneObjectTransformUpdate& entry)
+		{
+			UINT32 depth = 0;
+			for (SceneObject* ancestor = getParent(entry.sceneObject); ancestor != nullptr; ancestor = getParent(ancestor))
+				depth++;
+
+			return depth;
+		};
+
+		std::stable_sort(updates + numIndependent, updates + count, 
+			[&](const SceneObjectTransformUpdate& a, const SceneObjectTransformUpdate& b)
+		{
+			return getDepth(a) < getDepth(b);
+		});
+
+		for (UINT32 i = numIndependent; i < count; i++)
+		{
+			SceneObject* so = updates[i].sceneObject;
+
+			so->setWorldTfrmNoNotify(updates[i].position, updates[i].rotation);
+			so->notifyTfrmListeners(TCF_Transform);
+		}
+	}
+
+	void SceneObject::setWorldTfrmNoNotify(const Vector3& position, const Quaternion& rotation)
+	{
+		if (mParent != nullptr)
+		{
+			Vector3 invScale = mParent->getWorldScale();
+			if (invScale.x != 0) invScale.x = 1.0f / invScale.x;
+			if (invScale.y != 0) invScale.y = 1.0f / invScale.y;
+			if (invScale.z != 0) invScale.z = 1.0f / invScale.z;
+
+			Quaternion invRotation = mParent->getWorldRotation().inverse();
+
+			mPosition = invRotation.rotate(position - mParent->getWorldPosition()) * invScale;
+			mRotation = invRotation * rotation;
+		}
+		else
+		{
+			mPosition = position;
+			mRotation = rotation;
+		}
+
+		markTfrmDirty();
+	}
+
 	void SceneObject::notifyTransformChanged(TransformChangedFlags flags) const
+	{
+		markTfrmDirty();
+		notifyTfrmListeners(flags);
+	}
+
+	void SceneObject::markTfrmDirty() const
+	{
+		markCachedTfrmDirty();
+
+		if (isTfrmManaged())
+			mTfrmHierarchy->_setLocal(mTfrmIdx, mPosition, mRotation, mScale);
+	}
+
+	void SceneObject::markCachedTfrmDirty() const
 	{
 		mDirtyFlags |= DirtyFlags::LocalTfrmDirty | DirtyFlags::WorldTfrmDirty;
 		mDirtyHash++;
+	}
 
+	void SceneObject::notifyTfrmListeners(TransformChangedFlags flags) const
+	{
 		for(auto& entry : mComponents)
 		{
 			if (entry->supportsNotify(flags))
 				entry->onTransformChanged(flags);
 		}
 
+		// Transform hierarchy detects changes in parent transforms on its own, only the children's caches need updating
 		for (auto& entry : mChildren)
-			entry->notifyTransformChanged(flags);
+		{
+			entry->markCachedTfrmDirty();
+			entry->notifyTfrmListeners(flags);
+		}
 	}
 
 	void SceneObject::updateWorldTfrm() const
@@ -489,6 +696,24 @@ namespace BansheeEngine
 		mDirtyFlags &= ~DirtyFlags::LocalTfrmDirty;
 	}
 
+	bool SceneObject::isTfrmManaged() const
+	{
+		return mTfrmHierarchy != nullptr && mTfrmHierarchy->_isValid(mTfrmGeneration);
+	}
+
+	void SceneObject::notifyTfrmHierarchyChanged()
+	{
+		// Object is either leaving the storage, or joining it through its new parent
+		TransformHierarchy* tfrmHierarchy = nullptr;
+		if (isTfrmManaged())
+			tfrmHierarchy = mTfrmHierarchy;
+		else if (mParent != nullptr && !mParent.isDestroyed() && mParent->isTfrmManaged())
+			tfrmHierarchy = mParent->mTfrmHierarchy;
+
+		if (tfrmHierarchy != nullptr)
+			tfrmHierarchy->_notifyParentChanged(this);
+	}
+
 	/************************************************************************/
 	/* 								Hierarchy	                     		*/
 	/************************************************************************/
@@ -541,6 +766,9 @@ namespace BansheeEngine
 
 			mParent = parent;
 
+			// Must happen before the world transform is restored below, as the stored parent index is now stale
+			notifyTfrmHierarchyChanged();
+
 			if (keepWorldTransform)
 			{
 				setWorldPosition(worldPos);
@@ -657,12 +885,12 @@ namespace BansheeEngine
 				if (activeHierarchy)
 				{
 					for (auto& component : mComponents)
-						component->onEnabled();
+						enableComponent(component);
 				}
 				else
 				{
 					for (auto& component : mComponents)
-						component->onDisabled();
+						disableComponent(component);
 				}
 			}
 		}
@@ -673,6 +901,22 @@ namespace BansheeEngine
 		}
 	}
 
+	void SceneObject::enableComponent(const HComponent& component)
+	{
+		component->onEnabled();
+
+		if (isInstantiated())
+			gCoreSceneManager()._notifyComponentActivated(component.get());
+	}
+
+	void SceneObject::disableComponent(const HComponent& component)
+	{
+		component->onDisabled();
+
+		if (CoreSceneManager::isStarted())
+			gCoreSceneManager()._notifyComponentDeactivated(component.get());
+	}
+
 	bool SceneObject::getActive(bool self)
 	{
 		if (self)
@@ -729,7 +973,7 @@ namespace BansheeEngine
 			if (isInstantiated())
 			{
 				if (getActive())
-					component->onDisabled();
+					disableComponent(component);
 
 				(*iter)->onDestroyed();
 			}
@@ -767,6 +1011,21 @@ namespace BansheeEngine
 		mComponents.push_back(newComponent);
 	}
 
+	void SceneObject::addAndInitializeComponent(const SPtr<Component> component)
+	{
+		addComponentInternal(component);
+
+		if (isInstantiated())
+		{
+			HComponent newComponent = mComponents.back();
+			newComponent->instantiate();
+			newComponent->onInitialized();
+
+			if (getActive())
+				enableComponent(newComponent);
+		}
+	}
+
 	RTTITypeBase* SceneObject::getRTTIStatic()
 	{
 		return SceneObjectRTTI::instance();
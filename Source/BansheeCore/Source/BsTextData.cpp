@@ -10,6 +10,8 @@ namespace BansheeEngine
 	const int SPACE_CHAR = 32;
 	const int TAB_CHAR = 9;
 
+	const UINT32 TextDataBase::MAX_CACHED_LAYOUTS = 4096;
+
 	void TextDataBase::TextWord::init(bool spacer)
 	{
 		mWidth = mHeight = 0;
@@ -21,9 +23,9 @@ namespace BansheeEngine
 	}
 
 	// Assumes charIdx is an index right after last char in the list (if any). All chars need to be sequential.
-	UINT32 TextDataBase::TextWord::addChar(UINT32 charIdx, const CHAR_DESC& desc)
+	UINT32 TextDataBase::TextWord::addChar(UINT32 charIdx, const CHAR_DESC& desc, const FontBitmap& fontData)
 	{
-		UINT32 charWidth = calcCharWidth(mLastChar, desc);
+		UINT32 charWidth = calcCharWidth(mLastChar, desc, fontData);
 
 		mWidth += charWidth;
 		mHeight = std::max(mHeight, desc.height);
@@ -38,26 +40,17 @@ namespace BansheeEngine
 		return charWidth;
 	}
 
-	UINT32 TextDataBase::TextWord::calcWidthWithChar(const CHAR_DESC& desc)
+	UINT32 TextDataBase::TextWord::calcWidthWithChar(const CHAR_DESC& desc, const FontBitmap& fontData)
 	{
-		return mWidth + calcCharWidth(mLastChar, desc);
+		return mWidth + calcCharWidth(mLastChar, desc, fontData);
 	}
 
-	UINT32 TextDataBase::TextWord::calcCharWidth(const CHAR_DESC* prevDesc, const CHAR_DESC& desc)
+	UINT32 TextDataBase::TextWord::calcCharWidth(const CHAR_DESC* prevDesc, const CHAR_DESC& desc, const FontBitmap& fontData)
 	{
 		UINT32 charWidth = desc.xAdvance;
 		if (prevDesc != nullptr)
 		{
-			UINT32 kerning = 0;
-			for (size_t j = 0; j < prevDesc->kerningPairs.size(); j++)
-			{
-				if (prevDesc->kerningPairs[j].otherCharId == desc.charId)
-				{
-					kerning = prevDesc->kerningPairs[j].amount;
-					break;
-				}
-			}
-
+			UINT32 kerning = fontData.getKerning(prevDesc->charId, desc.charId);
 			charWidth += kerning;
 		}
 
@@ -100,7 +93,7 @@ namespace BansheeEngine
 		}
 
 		TextWord& lastWord = MemBuffer->WordBuffer[mWordsEnd];
-		charWidth = lastWord.addChar(charIdx, charDesc);
+		charWidth = lastWord.addChar(charIdx, charDesc, *mTextData->mFontData);
 
 		mWidth += charWidth;
 		mHeight = std::max(mHeight, lastWord.getHeight());
@@ -165,13 +158,13 @@ namespace BansheeEngine
 		{
 			TextWord& lastWord = MemBuffer->WordBuffer[mWordsEnd];
 			if (lastWord.isSpacer())
-				charWidth = TextWord::calcCharWidth(nullptr, desc);
+				charWidth = TextWord::calcCharWidth(nullptr, desc, *mTextData->mFontData);
 			else
-				charWidth = lastWord.calcWidthWithChar(desc) - lastWord.getWidth();
+				charWidth = lastWord.calcWidthWithChar(desc, *mTextData->mFontData) - lastWord.getWidth();
 		}
 		else
 		{
-			charWidth = TextWord::calcCharWidth(nullptr, desc);
+			charWidth = TextWord::calcCharWidth(nullptr, desc, *mTextData->mFontData);
 		}
 
 		return mWidth + charWidth;
@@ -360,7 +353,7 @@ namespace BansheeEngine
 			mFontData = font->getBitmap(nearestSize);
 		}
 
-		if(mFontData == nullptr || mFontData->texturePages.size() == 0)
+		if(mFontData == nullptr || mFontData->getNumPages() == 0)
 			return;
 
 		if(mFontData->size != fontSize)
@@ -371,6 +364,25 @@ namespace BansheeEngine
 		bool widthIsLimited = width > 0;
 		mFont = font;
 
+		// If the same text was already laid out with the same parameters, reuse its words and lines. Width and word
+		// break only affect the layout if word wrap is active.
+		bool layoutWordWrap = widthIsLimited && wordWrap;
+		UINT32 layoutWidth = layoutWordWrap ? width : 0;
+		bool layoutWordBreak = layoutWordWrap && wordBreak;
+
+		if (MemBuffer->restoreLayout(text, mFontData, layoutWidth, layoutWordWrap, layoutWordBreak))
+		{
+			for (UINT32 i = 0; i < MemBuffer->NextFreeLine; i++)
+				MemBuffer->LineBuffer[i].mTextData = this;
+
+			mNumChars = (UINT32)text.size();
+			mNumWords = MemBuffer->NextFreeWord;
+			mNumLines = MemBuffer->NextFreeLine;
+			mNumPageInfos = MemBuffer->NextFreePageInfo;
+
+			return;
+		}
+
 		UINT32 curLineIdx = MemBuffer->allocLine(this);
 		UINT32 curHeight = mFontData->fontDesc.lineHeight;
 		UINT32 charIdx = 0;
@@ -425,7 +437,7 @@ namespace BansheeEngine
 						UINT32 lastWordIdx = curLine->removeLastWord();
 						TextWord& lastWord = MemBuffer->WordBuffer[lastWordIdx];
 
-						bool wordFits = lastWord.calcWidthWithChar(charDesc) <= width;
+						bool wordFits = lastWord.calcWidthWithChar(charDesc, *mFontData) <= width;
 						if (wordFits && !curLine->isEmpty())
 						{
 							curLine->finalize(false);
@@ -497,6 +509,7 @@ namespace BansheeEngine
 		}
 
 		MemBuffer->LineBuffer[curLineIdx].finalize(true);
+		MemBuffer->storeLayout(text, mFontData, layoutWidth, layoutWordWrap, layoutWordBreak);
 
 		// Now that we have all the data we need, allocate the permanent buffers and copy the data
 		mNumChars = (UINT32)text.size();
@@ -547,7 +560,7 @@ namespace BansheeEngine
 
 	const HTexture& TextDataBase::getTextureForPage(UINT32 page) const 
 	{ 
-		return mFontData->texturePages[page]; 
+		return mFontData->getTexture(page); 
 	}
 
 	INT32 TextDataBase::getBaselineOffset() const 
@@ -565,6 +578,22 @@ namespace BansheeEngine
 		return mFontData->fontDesc.spaceWidth; 
 	}
 
+	void TextDataBase::_getLayoutCacheStats(UINT32& numHits, UINT32& numMisses, UINT32& numCollisions)
+	{
+		initAlloc();
+
+		numHits = MemBuffer->NumLayoutHits;
+		numMisses = MemBuffer->NumLayoutMisses;
+		numCollisions = MemBuffer->NumLayoutCollisions;
+	}
+
+	void TextDataBase::_setLayoutHashMask(size_t mask)
+	{
+		initAlloc();
+
+		MemBuffer->LayoutHashMask = mask;
+	}
+
 	void TextDataBase::initAlloc()
 	{
 		if (MemBuffer == nullptr)
@@ -586,6 +615,11 @@ namespace BansheeEngine
 		WordBuffer = bs_newN<TextWord>(WordBufferSize);
 		LineBuffer = bs_newN<TextLine>(LineBufferSize);
 		PageBuffer = bs_newN<PageInfo>(PageBufferSize);
+
+		LayoutHashMask = (size_t)-1;
+		NumLayoutHits = 0;
+		NumLayoutMisses = 0;
+		NumLayoutCollisions = 0;
 	}
 
 	TextDataBase::BufferData::~BufferData()
@@ -661,6 +695,122 @@ namespace BansheeEngine
 		PageBuffer[page].numQuads++;
 	}
 
+	bool TextDataBase::BufferData::restoreLayout(const WString& text, const SPtr<const FontBitmap>& fontData, UINT32 width, 
+		bool wordWrap, bool wordBreak)
+	{
+		size_t hash = getLayoutHash(text, fontData.get(), width, wordWrap, wordBreak) & LayoutHashMask;
+
+		auto iterFind = LayoutCache.find(hash);
+		if (iterFind == LayoutCache.end())
+		{
+			NumLayoutMisses++;
+			return false;
+		}
+
+		const CachedLayout& layout = iterFind->second;
+
+		// Font comparison also ensures the characters referenced by the cached words are still alive
+		if (layout.fontData.lock() != fontData || layout.width != width || layout.wordWrap != wordWrap || 
+			layout.wordBreak != wordBreak || layout.text != text)
+		{
+			NumLayoutMisses++;
+			NumLayoutCollisions++;
+			return false;
+		}
+
+		UINT32 numWords = (UINT32)layout.words.size();
+		UINT32 numLines = (UINT32)layout.lines.size();
+		UINT32 numPageInfos = (UINT32)layout.pageInfos.size();
+
+		// Buffers are empty, so there is no need to preserve their contents when growing them
+		if (numWords > WordBufferSize)
+		{
+			bs_deleteN(WordBuffer, WordBufferSize);
+			WordBufferSize = std::max(WordBufferSize * 2, numWords);
+			WordBuffer = bs_newN<TextWord>(WordBufferSize);
+		}
+
+		if (numLines > LineBufferSize)
+		{
+			bs_deleteN(LineBuffer, LineBufferSize);
+			LineBufferSize = std::max(LineBufferSize * 2, numLines);
+			LineBuffer = bs_newN<TextLine>(LineBufferSize);
+		}
+
+		if (numPageInfos > PageBufferSize)
+		{
+			bs_deleteN(PageBuffer, PageBufferSize);
+			PageBufferSize = std::max(PageBufferSize * 2, numPageInfos);
+			PageBuffer = bs_newN<PageInfo>(PageBufferSize);
+		}
+
+		for (UINT32 i = 0; i < numWords; i++)
+			WordBuffer[i] = layout.words[i];
+
+		for (UINT32 i = 0; i < numLines; i++)
+			LineBuffer[i] = layout.lines[i];
+
+		for (UINT32 i = 0; i < numPageInfos; i++)
+			PageBuffer[i] = layout.pageInfos[i];
+
+		NextFreeWord = numWords;
+		NextFreeLine = numLines;
+		NextFreePageInfo = numPageInfos;
+
+		// Mark as most recently used
+		LayoutUsage.splice(LayoutUsage.begin(), LayoutUsage, layout.usageIter);
+
+		NumLayoutHits++;
+		return true;
+	}
+
+	void TextDataBase::BufferData::storeLayout(const WString& text, const SPtr<const FontBitmap>& fontData, UINT32 width, 
+		bool wordWrap, bool wordBreak)
+	{
+		size_t hash = getLayoutHash(text, fontData.get(), width, wordWrap, wordBreak) & LayoutHashMask;
+
+		// Replace any existing entry with the same hash (either outdated, or a hash collision)
+		auto iterFind = LayoutCache.find(hash);
+		if (iterFind != LayoutCache.end())
+		{
+			LayoutUsage.erase(iterFind->second.usageIter);
+			LayoutCache.erase(iterFind);
+		}
+
+		if (LayoutCache.size() >= MAX_CACHED_LAYOUTS)
+		{
+			LayoutCache.erase(LayoutUsage.back());
+			LayoutUsage.pop_back();
+		}
+
+		CachedLayout& layout = LayoutCache[hash];
+		layout.text = text;
+		layout.fontData = fontData;
+		layout.width = width;
+		layout.wordWrap = wordWrap;
+		layout.wordBreak = wordBreak;
+
+		layout.words.assign(WordBuffer, WordBuffer + NextFreeWord);
+		layout.lines.assign(LineBuffer, LineBuffer + NextFreeLine);
+		layout.pageInfos.assign(PageBuffer, PageBuffer + NextFreePageInfo);
+
+		LayoutUsage.push_front(hash);
+		layout.usageIter = LayoutUsage.begin();
+	}
+
+	size_t TextDataBase::BufferData::getLayoutHash(const WString& text, const FontBitmap* fontData, UINT32 width, 
+		bool wordWrap, bool wordBreak)
+	{
+		size_t hash = 0;
+		hash_combine(hash, text);
+		hash_combine(hash, fontData);
+		hash_combine(hash, width);
+		hash_combine(hash, wordWrap);
+		hash_combine(hash, wordBreak);
+
+		return hash;
+	}
+
 	UINT32 TextDataBase::getWidth() const
 	{
 		UINT32 width = 0;
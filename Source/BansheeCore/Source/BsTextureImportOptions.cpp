@@ -7,7 +7,8 @@ namespace BansheeEngine
 {
 	TextureImportOptions::TextureImportOptions()
 		:mFormat(PF_R8G8B8A8), mGenerateMips(true), mMaxMip(0), 
-		mCPUReadable(false), mSRGB(false)
+		mCPUReadable(false), mSRGB(false), mMipFilter(MipMapFilter::Box), mPreserveAlphaCoverage(false),
+		mAlphaCoverageCutoff(0.5f)
 	{ }
 
 	/************************************************************************/
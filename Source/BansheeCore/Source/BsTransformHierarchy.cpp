@@ -0,0 +1,339 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTransformHierarchy.h"
+#include "BsSceneObject.h"
+#include "BsTaskScheduler.h"
+
+namespace BansheeEngine
+{
+	TransformHierarchy::TransformHierarchy()
+		: mEnabled(false), mParallel(false), mRebuildRequired(true), mGrowRequired(false), mGeneration(1), mNumRebuilds(0)
+		, mContiguousEnd(0), mNumRemoved(0), mUpToDate(false)
+	{ }
+
+	void TransformHierarchy::setEnabled(bool enabled)
+	{
+		if (mEnabled == enabled)
+			return;
+
+		mEnabled = enabled;
+		clear();
+	}
+
+	void TransformHierarchy::_notifyStructureChanged()
+	{
+		if (mRebuildRequired)
+			return;
+
+		// Invalidates indices held by all scene objects
+		mGeneration++;
+		mRebuildRequired = true;
+	}
+
+	void TransformHierarchy::_notifyParentChanged(SceneObject* so)
+	{
+		if (!mEnabled || mRebuildRequired)
+			return;
+
+		// Entries are always moved to the end of the storage, so parents keep coming before their children
+		if (contains(so))
+			removeSubtree(so);
+
+		SceneObject* parent = so->mParent != nullptr ? so->mParent.get() : nullptr;
+		if (parent == nullptr || !contains(parent))
+			return;
+
+		// If there's no space left objects stay outside of the storage until it is rebuilt, with more space
+		if (!appendSubtree(so, (INT32)parent->mTfrmIdx))
+			mGrowRequired = true;
+	}
+
+	void TransformHierarchy::_update(const HSceneObject& root)
+	{
+		if (!mEnabled)
+			return;
+
+		// Compact the storage once structural changes fragmented too much of it
+		UINT32 numEntries = (UINT32)mParents.size();
+		UINT32 numFragmented = mNumRemoved + (numEntries - mContiguousEnd);
+
+		if (mRebuildRequired || mGrowRequired || numFragmented > numEntries / 2)
+			rebuild(root);
+
+		numEntries = (UINT32)mParents.size();
+		if (numEntries == 0 || mUpToDate)
+			return;
+
+		UINT32 numTasks = 1;
+		if (mParallel)
+		{
+			UINT32 maxTasks = std::max(TaskScheduler::instance().getNumWorkers(), 1U);
+			numTasks = std::min(mContiguousEnd / MIN_ENTRIES_PER_TASK, maxTasks);
+		}
+
+		if (numTasks <= 1)
+			updateRange(0, numEntries);
+		else
+		{
+			// Root first, then groups of its sub-trees in parallel. Sub-trees are independent of each other.
+			updateRange(0, 1);
+
+			UINT32 entriesPerTask = (mContiguousEnd - 1 + numTasks - 1) / numTasks;
+			Vector<SPtr<Task>> tasks;
+
+			UINT32 numSubtrees = (UINT32)mRootSubtrees.size();
+			UINT32 subtreeIdx = 0;
+			while (subtreeIdx < numSubtrees)
+			{
+				UINT32 start = mRootSubtrees[subtreeIdx];
+				UINT32 end = start;
+
+				// Group sub-trees until the group is large enough
+				while (subtreeIdx < numSubtrees && (end - start) < entriesPerTask)
+				{
+					subtreeIdx++;
+					end = subtreeIdx < numSubtrees ? mRootSubtrees[subtreeIdx] : mContiguousEnd;
+				}
+
+				auto worker = [this, start, end]()
+				{
+					updateRange(start, end);
+				};
+
+				SPtr<Task> task = Task::create("TransformUpdate", worker, TaskPriority::High);
+				TaskScheduler::instance().addTask(task);
+
+				tasks.push_back(task);
+			}
+
+			for (auto& task : tasks)
+				task->wait();
+
+			// Entries appended since the last rebuild can belong to any sub-tree, but their parents always come first
+			updateRange(mContiguousEnd, numEntries);
+		}
+
+		mUpToDate = true;
+	}
+
+	void TransformHierarchy::rebuild(const HSceneObject& root)
+	{
+		UINT32 numEntries = (UINT32)mParents.size() - mNumRemoved;
+
+		clear();
+
+		if (root == nullptr)
+			return;
+
+		mRebuildRequired = false;
+		mGrowRequired = false;
+		mNumRebuilds++;
+
+		// Reserve enough space so objects can be added without reallocating, which would invalidate references
+		// returned by the world transform accessors
+		UINT32 capacity = std::max(numEntries * 2, MIN_CAPACITY);
+		reserve(capacity);
+
+		while (!appendSubtree(root.get(), -1))
+		{
+			capacity *= 2;
+			reserve(capacity);
+		}
+	}
+
+	void TransformHierarchy::reserve(UINT32 capacity)
+	{
+		mParents.reserve(capacity);
+		mLocalPositions.reserve(capacity);
+		mLocalRotations.reserve(capacity);
+		mLocalScales.reserve(capacity);
+		mWorldPositions.reserve(capacity);
+		mWorldRotations.reserve(capacity);
+		mWorldScales.reserve(capacity);
+		mWorldTfrms.reserve(capacity);
+		mDirty.reserve(capacity);
+		mVersions.reserve(capacity);
+		mParentVersions.reserve(capacity);
+	}
+
+	void TransformHierarchy::clear()
+	{
+		mGeneration++;
+		mRebuildRequired = true;
+		mUpToDate = false;
+
+		mContiguousEnd = 0;
+		mNumRemoved = 0;
+
+		mParents.clear();
+		mRootSubtrees.clear();
+
+		mLocalPositions.clear();
+		mLocalRotations.clear();
+		mLocalScales.clear();
+
+		mWorldPositions.clear();
+		mWorldRotations.clear();
+		mWorldScales.clear();
+		mWorldTfrms.clear();
+
+		mDirty.clear();
+		mVersions.clear();
+		mParentVersions.clear();
+	}
+
+	bool TransformHierarchy::appendSubtree(SceneObject* so, INT32 parentIdx)
+	{
+		// Count first, as the sub-tree must be appended as a whole
+		UINT32 numNewEntries = 0;
+		Stack<SceneObject*> toCount;
+		toCount.push(so);
+
+		while (!toCount.empty())
+		{
+			SceneObject* current = toCount.top();
+			toCount.pop();
+
+			numNewEntries++;
+			for (auto& child : current->mChildren)
+				toCount.push(child.get());
+		}
+
+		UINT32 start = (UINT32)mParents.size();
+		if (start + numNewEntries > (UINT32)mParents.capacity())
+			return false;
+
+		// Sub-trees of the root's children appended right after the depth-first ordered part keep it depth-first
+		bool depthFirst = mContiguousEnd == start && parentIdx <= 0;
+
+		// Depth-first, so each parent ends up before its children and each sub-tree is contiguous
+		Stack<std::pair<SceneObject*, INT32>> todo;
+		todo.push(std::make_pair(so, parentIdx));
+
+		while (!todo.empty())
+		{
+			SceneObject* current = todo.top().first;
+			INT32 currentParentIdx = todo.top().second;
+			todo.pop();
+
+			UINT32 idx = (UINT32)mParents.size();
+			if (depthFirst && currentParentIdx == 0)
+				mRootSubtrees.push_back(idx);
+
+			mParents.push_back(currentParentIdx);
+			mLocalPositions.push_back(current->mPosition);
+			mLocalRotations.push_back(current->mRotation);
+			mLocalScales.push_back(current->mScale);
+			mWorldPositions.push_back(Vector3::ZERO);
+			mWorldRotations.push_back(Quaternion::IDENTITY);
+			mWorldScales.push_back(Vector3::ONE);
+			mWorldTfrms.push_back(Matrix4::IDENTITY);
+			mDirty.push_back(1);
+			mVersions.push_back(0);
+			mParentVersions.push_back(0);
+
+			current->mTfrmHierarchy = this;
+			current->mTfrmIdx = idx;
+			current->mTfrmGeneration = mGeneration;
+
+			// Ensures the object's own cache gets refreshed once it leaves the storage
+			current->mDirtyFlags |= SceneObject::WorldTfrmDirty;
+
+			for (auto iter = current->mChildren.rbegin(); iter != current->mChildren.rend(); ++iter)
+				todo.push(std::make_pair(iter->get(), (INT32)idx));
+		}
+
+		if (depthFirst)
+			mContiguousEnd = (UINT32)mParents.size();
+
+		markOutOfDate();
+		return true;
+	}
+
+	void TransformHierarchy::removeSubtree(SceneObject* so)
+	{
+		Stack<SceneObject*> todo;
+		todo.push(so);
+
+		while (!todo.empty())
+		{
+			SceneObject* current = todo.top();
+			todo.pop();
+
+			if (!contains(current))
+				continue;
+
+			mParents[current->mTfrmIdx] = REMOVED_ENTRY;
+			mNumRemoved++;
+
+			current->mTfrmHierarchy = nullptr;
+			current->mDirtyFlags |= SceneObject::WorldTfrmDirty;
+
+			for (auto& child : current->mChildren)
+				todo.push(child.get());
+		}
+	}
+
+	bool TransformHierarchy::contains(const SceneObject* so) const
+	{
+		return so->mTfrmHierarchy == this && _isValid(so->mTfrmGeneration);
+	}
+
+	void TransformHierarchy::_setLocal(UINT32 idx, const Vector3& position, const Quaternion& rotation,
+		const Vector3& scale)
+	{
+		mLocalPositions[idx] = position;
+		mLocalRotations[idx] = rotation;
+		mLocalScales[idx] = scale;
+		mDirty[idx] = 1;
+
+		markOutOfDate();
+	}
+
+	void TransformHierarchy::updateRange(UINT32 start, UINT32 end)
+	{
+		for (UINT32 i = start; i < end; i++)
+		{
+			if (mParents[i] != REMOVED_ENTRY && isOutOfDate(i))
+				updateWorld(i);
+		}
+	}
+
+	void TransformHierarchy::updateLazy(UINT32 idx)
+	{
+		// Parent versions are only meaningful if the parents themselves are up to date
+		INT32 parentIdx = mParents[idx];
+		if (parentIdx >= 0)
+			updateLazy((UINT32)parentIdx);
+
+		if (isOutOfDate(idx))
+			updateWorld(idx);
+	}
+
+	void TransformHierarchy::updateWorld(UINT32 idx)
+	{
+		INT32 parentIdx = mParents[idx];
+		if (parentIdx >= 0)
+		{
+			const Quaternion& parentRotation = mWorldRotations[parentIdx];
+			const Vector3& parentScale = mWorldScales[parentIdx];
+
+			mWorldRotations[idx] = parentRotation * mLocalRotations[idx];
+			mWorldScales[idx] = parentScale * mLocalScales[idx];
+			mWorldPositions[idx] = parentRotation.rotate(parentScale * mLocalPositions[idx]) +
+				mWorldPositions[parentIdx];
+
+			mParentVersions[idx] = mVersions[parentIdx];
+		}
+		else
+		{
+			mWorldRotations[idx] = mLocalRotations[idx];
+			mWorldScales[idx] = mLocalScales[idx];
+			mWorldPositions[idx] = mLocalPositions[idx];
+		}
+
+		mWorldTfrms[idx].setTRS(mWorldPositions[idx], mWorldRotations[idx], mWorldScales[idx]);
+		mVersions[idx]++;
+		mDirty[idx] = 0;
+	}
+}
@@ -6,6 +6,7 @@
 #include "BsIReflectable.h"
 #include "BsModule.h"
 #include "BsPlatformInfo.h"
+#include "BsResourcePackage.h"
 
 namespace BansheeEngine
 {
@@ -81,6 +82,15 @@ namespace BansheeEngine
 		/**	Returns a list of script defines for a specific platform. */
 		WString getDefines(PlatformType type) const;
 
+		/**
+		 * Packs the provided resources into a single resource package, so the game can load them without having to open
+		 * a separate file for each resource.
+		 *
+		 * @param[in]	resources		Resources to include in the package.
+		 * @param[in]	outputFolder	Folder in which to create the package. Package is named GAME_RESOURCE_PACKAGE_NAME.
+		 */
+		void packageResources(const Vector<RESOURCE_PACKAGE_ENTRY_DESC>& resources, const Path& outputFolder);
+
 		/**	Stores build settings for all platforms in the specified file. */
 		void save(const Path& outFile);
 
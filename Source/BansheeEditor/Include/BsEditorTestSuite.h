@@ -18,16 +18,34 @@ namespace BansheeEngine
 	public:
 		HSceneObject ref1;
 		HComponent ref2;
+		UINT32 numUpdates = 0;
+		UINT32 lastUpdate = 0;
+		bool initialized = false;
+		bool enabled = false;
+
+		static UINT32 updateCounter;
 
 		/************************************************************************/
 		/* 							COMPONENT OVERRIDES                    		*/
 		/************************************************************************/
 
+		/** @copydoc Component::update */
+		void update() override { numUpdates++; lastUpdate = ++updateCounter; }
+
 	protected:
 		friend class SceneObject;
 
 		TestComponentA(const HSceneObject& parent);
 
+		/** @copydoc Component::onInitialized */
+		void onInitialized() override { initialized = true; }
+
+		/** @copydoc Component::onEnabled */
+		void onEnabled() override { enabled = true; }
+
+		/** @copydoc Component::onDisabled */
+		void onDisabled() override { enabled = false; }
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -90,6 +108,131 @@ namespace BansheeEngine
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests batched frustum culling against per-object culling, and reports the timings of both. */
+		void TestBatchCulling();
+
+		/** Tests radix sort against a comparison sort, and reports the timings of both. */
+		void TestRadixSort();
+
+		/** 
+		 * Tests recording and playback of commands in the command ring buffer, including overflow, wrap-around and a 
+		 * producer running on a separate thread. 
+		 */
+		void TestCommandRingBuffer();
+
+		/** Tests transforms served from the flat transform hierarchy against the ones calculated by scene objects. */
+		void TestTransformHierarchy();
+
+		/** 
+		 * Tests component updates through the scene manager's component registry, and reports its timing compared to a 
+		 * traversal of the scene graph. 
+		 */
+		void TestComponentUpdate();
+
+		/**
+		 * Tests task scheduler dependencies, cancellation, child tasks, nested parallel-for loops and waiting on tasks from
+		 * within worker threads.
+		 */
+		void TestTaskScheduler();
+
+		/**
+		 * Tests decoding pixel and mesh data from memory mapped files, with the decoded data referencing the mapping
+		 * directly.
+		 */
+		void TestMemoryMappedLoad();
+
+		/**
+		 * Tests that objects decoded directly from binary data match the encoded objects and the objects decoded 
+		 * through the intermediate representation, and reports the decoding timings.
+		 */
+		void TestBinaryDecode();
+
+		/** 
+		 * Tests prefab instantiation from cached instantiation data, and reports its timing compared to cloning the 
+		 * prefab hierarchy. 
+		 */
+		void TestPrefabInstantiate();
+
+		/** Tests that prefab instances released to a prefab pool get reused and reverted to the prefab's state. */
+		void TestPrefabPool();
+
+		/**
+		 * Tests that caret blinks and tint changes update GUI meshes in place instead of rebuilding them, and reports
+		 * the timings of both.
+		 */
+		void TestGUIMeshUpdate();
+
+		/**
+		 * Tests that elements found through the widget's element grid match a search through all of the widget's
+		 * elements, as elements get added, removed, moved and clipped. Reports the timings of both.
+		 */
+		void TestGUIElementGrid();
+
+		/**
+		 * Tests that font character and kerning lookup tables match a search through the font description, and that
+		 * text layouts are restored from the layout cache only when generated with the same parameters, even when
+		 * their hashes collide. Reports the timings of both lookups.
+		 */
+		void TestTextLayoutCache();
+
+		/**
+		 * Tests that characters rendered at runtime are inserted into and evicted from the dynamic font atlas in least
+		 * recently used order, that pinned characters and characters used during the current frame are never evicted,
+		 * and that characters render blank while the atlas is full. Reports the timing of atlas lookups.
+		 */
+		void TestDynamicFontAtlas();
+
+		/**
+		 * Tests specialized pixel format conversions against per-pixel conversion, and reports the timings of both for
+		 * each format pair.
+		 */
+		void TestPixelConversion();
+
+		/**
+		 * Reports the time taken to simulate a large number of rigidbodies when the simulation runs on the task scheduler,
+		 * and when it runs on dedicated physics threads.
+		 */
+		void TestPhysicsDispatcher();
+
+		/** Tests batched physics queries against individual queries, and reports the timings of both. */
+		void TestPhysicsBatchQueries();
+
+		/** 
+		 * Tests rigidbody poses displayed during asynchronous simulation, and the final simulation state, against a
+		 * synchronous simulation of the same scene.
+		 */
+		void TestPhysicsAsyncSimulation();
+
+		/** 
+		 * Tests bulk world transform updates of scene objects against individual updates, and reports the timings of 
+		 * both.
+		 */
+		void TestBulkTransformUpdate();
+
+		/** 
+		 * Tests the software audio mixer output and voice virtualization, and reports the mixing timings with and without
+		 * a voice limit.
+		 */
+		void TestAudioMixer();
+
+		/** 
+		 * Tests that the Skyline and MaxRects texture atlas packers produce valid layouts at least as dense as the binary
+		 * tree packer, and reports the packing timings of all three.
+		 */
+		void TestTexAtlasPacking();
+
+		/**
+		 * Tests mip-map generation against a known box filtered pattern, constant images for every filter and wrap mode,
+		 * non-power-of-two level sizes and alpha coverage preservation.
+		 */
+		void TestMipmapGeneration();
+
+		/**
+		 * Tests that resources packed into a resource package can be loaded back both by UUID and by path, after their
+		 * individual files are removed.
+		 */
+		void TestResourcePackage();
 	};
 
 	/** @} */
@@ -5,6 +5,8 @@
 #include "BsFileSerializer.h"
 #include "BsFileSystem.h"
 #include "BsEditorApplication.h"
+#include "BsResourcePackage.h"
+#include "BsDebug.h"
 
 namespace BansheeEngine
 {
@@ -162,6 +164,15 @@ namespace BansheeEngine
 		return getPlatformInfo(type)->defines;
 	}
 
+	void BuildManager::packageResources(const Vector<RESOURCE_PACKAGE_ENTRY_DESC>& resources, const Path& outputFolder)
+	{
+		Path packagePath = outputFolder;
+		packagePath.append(GAME_RESOURCE_PACKAGE_NAME);
+
+		if (!ResourcePackage::create(resources, packagePath))
+			LOGWRN("Not all resources were successfully packed in: " + packagePath.toString());
+	}
+
 	void BuildManager::clear()
 	{
 		mBuildData = nullptr;
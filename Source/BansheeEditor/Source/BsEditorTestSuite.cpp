@@ -13,8 +13,52 @@
 #include "BsPrefab.h"
 #include "BsResources.h"
 #include "BsPrefabDiff.h"
+#include "BsPrefabUtility.h"
 #include "BsFrameAlloc.h"
 #include "BsFileSystem.h"
+#include "BsConvexVolume.h"
+#include "BsBoundsArray.h"
+#include "BsTimer.h"
+#include "BsRadixSort.h"
+#include "BsCommandRingBuffer.h"
+#include "BsCoreSceneManager.h"
+#include "BsTaskScheduler.h"
+#include "BsPrefabPool.h"
+#include "BsPixelUtil.h"
+#include "BsBitwise.h"
+#include "BsPhysics.h"
+#include "BsCRigidbody.h"
+#include "BsCBoxCollider.h"
+#include "BsCPlaneCollider.h"
+#include "BsCSphereCollider.h"
+#include "BsCharacterController.h"
+#include "BsAudioMixer.h"
+#include "BsTexAtlasGenerator.h"
+#include "BsColor.h"
+#include "BsResourcePackage.h"
+#include "BsPlainText.h"
+#include "BsUUID.h"
+#include "BsFileSerializer.h"
+#include "BsDataStream.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsGUIManager.h"
+#include "BsGUIWidget.h"
+#include "BsGUIPanel.h"
+#include "BsGUIInputBox.h"
+#include "BsGUILabel.h"
+#include "BsGUIOptions.h"
+#include "BsBuiltinResources.h"
+#include "BsCamera.h"
+#include "BsViewport.h"
+#include "BsRenderTexture.h"
+#include "BsInput.h"
+#include "BsFont.h"
+#include "BsTextData.h"
+#include "BsDynamicFontAtlas.h"
+#include "BsTime.h"
+
+#include <random>
 
 namespace BansheeEngine
 {
@@ -84,6 +128,8 @@ namespace BansheeEngine
 		}
 	};
 
+	UINT32 TestComponentA::updateCounter = 0;
+
 	TestComponentA::TestComponentA(const HSceneObject& parent)
 		:Component(parent)
 	{}
@@ -271,6 +317,78 @@ namespace BansheeEngine
 		return TestObjectA::getRTTIStatic();
 	}
 
+	struct TestObjectC : IReflectable
+	{
+		Vector<UINT32> arrIntA;
+		Vector<String> arrStrA;
+
+		TestObjectA objA;
+		Vector<TestObjectA> arrObjA;
+
+		SPtr<TestObjectC> objPtrA;
+		Vector<SPtr<TestObjectC>> arrObjPtrA;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class TestObjectCRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class TestObjectCRTTI : public RTTIType < TestObjectC, IReflectable, TestObjectCRTTI >
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN_ARRAY(arrIntA, 0)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(arrStrA, 1)
+
+			BS_RTTI_MEMBER_REFL(objA, 2)
+			BS_RTTI_MEMBER_REFL_ARRAY(arrObjA, 3)
+
+			BS_RTTI_MEMBER_REFLPTR_ARRAY(arrObjPtrA, 4)
+		BS_END_RTTI_MEMBERS
+
+		SPtr<TestObjectC> getObjPtrA(TestObjectC* obj) { return obj->objPtrA; }
+		void setObjPtrA(TestObjectC* obj, SPtr<TestObjectC> val) { obj->objPtrA = val; }
+
+	public:
+		TestObjectCRTTI()
+			:mInitMembers(this)
+		{
+			// Weak, so it can be used for creating reference cycles
+			addReflectablePtrField("objPtrA", 5, &TestObjectCRTTI::getObjPtrA, &TestObjectCRTTI::setObjPtrA, 
+				RTTI_Flag_WeakRef);
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "TestObjectC";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestObjectC;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<TestObjectC>();
+		}
+	};
+
+	RTTITypeBase* TestObjectC::getRTTIStatic()
+	{
+		return TestObjectCRTTI::instance();
+	}
+
+	RTTITypeBase* TestObjectC::getRTTI() const
+	{
+		return TestObjectC::getRTTIStatic();
+	}
+
 	class TestComponentC : public Component
 	{
 	public:
@@ -405,6 +523,47 @@ namespace BansheeEngine
 		return TestComponentD::getRTTIStatic();
 	}
 
+	class TestGlyphRasterizer : public GlyphRasterizer
+	{
+	public:
+		static const UINT32 GLYPH_SIZE = 6;
+		static const UINT32 NUM_CHARS = 1000; /**< Characters with larger IDs are missing from the font. */
+
+		bool renderGlyph(UINT32 charId, CHAR_DESC& desc, Vector<UINT8>& pixels) override
+		{
+			if (charId >= NUM_CHARS)
+				return false;
+
+			numRenderedGlyphs++;
+
+			desc.charId = charId;
+			desc.page = 0;
+			desc.uvX = desc.uvY = 0.0f;
+			desc.uvWidth = desc.uvHeight = 0.0f;
+			desc.width = GLYPH_SIZE;
+			desc.height = GLYPH_SIZE;
+			desc.xOffset = 0;
+			desc.yOffset = GLYPH_SIZE;
+			desc.xAdvance = GLYPH_SIZE + 1;
+			desc.yAdvance = 0;
+			desc.kerningPairs.clear();
+
+			pixels.assign(GLYPH_SIZE * GLYPH_SIZE, (UINT8)charId);
+			return true;
+		}
+
+		INT32 getKerning(UINT32 firstCharId, UINT32 secondCharId) override
+		{
+			numKerningQueries++;
+			return (INT32)((firstCharId + secondCharId) % 3) - 1;
+		}
+
+		UINT32 getMaxGlyphSize() const override { return GLYPH_SIZE; }
+
+		UINT32 numRenderedGlyphs = 0;
+		UINT32 numKerningQueries = 0;
+	};
+
 	EditorTestSuite::EditorTestSuite()
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
@@ -412,6 +571,29 @@ namespace BansheeEngine
 		BS_ADD_TEST(EditorTestSuite::BinaryDiff);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc)
+		BS_ADD_TEST(EditorTestSuite::TestBatchCulling)
+		BS_ADD_TEST(EditorTestSuite::TestRadixSort)
+		BS_ADD_TEST(EditorTestSuite::TestCommandRingBuffer)
+		BS_ADD_TEST(EditorTestSuite::TestTransformHierarchy)
+		BS_ADD_TEST(EditorTestSuite::TestComponentUpdate)
+		BS_ADD_TEST(EditorTestSuite::TestTaskScheduler)
+		BS_ADD_TEST(EditorTestSuite::TestMemoryMappedLoad)
+		BS_ADD_TEST(EditorTestSuite::TestBinaryDecode)
+		BS_ADD_TEST(EditorTestSuite::TestPrefabInstantiate)
+		BS_ADD_TEST(EditorTestSuite::TestPrefabPool)
+		BS_ADD_TEST(EditorTestSuite::TestGUIMeshUpdate)
+		BS_ADD_TEST(EditorTestSuite::TestGUIElementGrid)
+		BS_ADD_TEST(EditorTestSuite::TestTextLayoutCache)
+		BS_ADD_TEST(EditorTestSuite::TestDynamicFontAtlas)
+		BS_ADD_TEST(EditorTestSuite::TestPixelConversion)
+		BS_ADD_TEST(EditorTestSuite::TestPhysicsDispatcher)
+		BS_ADD_TEST(EditorTestSuite::TestPhysicsBatchQueries)
+		BS_ADD_TEST(EditorTestSuite::TestPhysicsAsyncSimulation)
+		BS_ADD_TEST(EditorTestSuite::TestBulkTransformUpdate)
+		BS_ADD_TEST(EditorTestSuite::TestAudioMixer)
+		BS_ADD_TEST(EditorTestSuite::TestTexAtlasPacking)
+		BS_ADD_TEST(EditorTestSuite::TestMipmapGeneration)
+		BS_ADD_TEST(EditorTestSuite::TestResourcePackage)
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -732,4 +914,2698 @@ namespace BansheeEngine
 		alloc.dealloc(a13);
 		alloc.clear();
 	}
+
+	void EditorTestSuite::TestBatchCulling()
+	{
+		static const UINT32 NUM_BOUNDS = 50000;
+
+		// Frustum-like volume, slightly rotated so no plane is axis aligned
+		Vector<Plane> planes =
+		{
+			Plane(Vector3::normalize(Vector3(0.9f, 0.1f, 0.0f)), 50.0f),
+			Plane(Vector3::normalize(Vector3(-0.9f, 0.0f, 0.1f)), 50.0f),
+			Plane(Vector3::normalize(Vector3(0.1f, 0.9f, 0.0f)), 50.0f),
+			Plane(Vector3::normalize(Vector3(0.0f, -0.9f, 0.1f)), 50.0f),
+			Plane(Vector3::normalize(Vector3(0.0f, 0.1f, 0.9f)), 10.0f),
+			Plane(Vector3::normalize(Vector3(0.1f, 0.0f, -0.9f)), 200.0f)
+		};
+
+		ConvexVolume volume(planes);
+
+		Vector<Bounds> bounds(NUM_BOUNDS);
+		BoundsArray boundsArray;
+
+		UINT32 seed = 12345;
+		auto random = [&](float min, float max)
+		{
+			seed = seed * 1664525 + 1013904223;
+			return min + (seed >> 8) / (float)(1 << 24) * (max - min);
+		};
+
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			Vector3 center(random(-100.0f, 100.0f), random(-100.0f, 100.0f), random(-50.0f, 250.0f));
+			Vector3 extents(random(0.1f, 5.0f), random(0.1f, 5.0f), random(0.1f, 5.0f));
+
+			AABox box(center - extents, center + extents);
+			Sphere sphere(center, extents.length());
+
+			bounds[i] = Bounds(box, sphere);
+			boundsArray.add(bounds[i]);
+		}
+
+		Vector<UINT32> scalarVisibility((NUM_BOUNDS + 31) / 32, 0);
+		Vector<UINT32> batchVisibility((NUM_BOUNDS + 31) / 32, 0);
+
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			if (volume.intersects(bounds[i].getSphere()) && volume.intersects(bounds[i].getBox()))
+				scalarVisibility[i / 32] |= 1U << (i % 32);
+		}
+		UINT64 scalarTime = timer.getMicroseconds();
+
+		timer.reset();
+		volume.intersects(boundsArray, 0, NUM_BOUNDS, batchVisibility.data());
+		UINT64 batchTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(scalarVisibility == batchVisibility);
+
+		// Test a sub-range that doesn't end on a four entry boundary
+		UINT32 rangeStart = 32;
+		UINT32 rangeCount = 101;
+
+		Vector<UINT32> rangeVisibility((rangeCount + 31) / 32, 0);
+		volume.intersects(boundsArray, rangeStart, rangeCount, rangeVisibility.data());
+
+		for (UINT32 i = 0; i < rangeCount; i++)
+		{
+			bool expected = (scalarVisibility[(rangeStart + i) / 32] & (1U << ((rangeStart + i) % 32))) != 0;
+			bool actual = (rangeVisibility[i / 32] & (1U << (i % 32))) != 0;
+
+			BS_TEST_ASSERT(expected == actual);
+		}
+
+		BS_TEST_ASSERT((rangeVisibility.back() >> (rangeCount % 32)) == 0);
+
+		LOGDBG("Culling " + toString(NUM_BOUNDS) + " bounds. Scalar: " + toString(scalarTime) + "us, batched: " +
+			toString(batchTime) + "us.");
+	}
+
+	void EditorTestSuite::TestRadixSort()
+	{
+		static const UINT32 NUM_KEYS = 100000;
+
+		// Keys similar to render queue keys: few priorities, a few hundred shaders and a float distance
+		Vector<UINT64> keys(NUM_KEYS);
+		for (UINT32 i = 0; i < NUM_KEYS; i++)
+		{
+			UINT64 priority = std::rand() % 4;
+			UINT64 shaderId = std::rand() % 300;
+			float distance = (std::rand() % 10000) * 0.1f - 100.0f;
+
+			keys[i] = (priority << 41) | (shaderId << 32) | RadixSort::toSortableKey(distance);
+		}
+
+		Vector<std::pair<UINT64, UINT32>> expected(NUM_KEYS);
+		for (UINT32 i = 0; i < NUM_KEYS; i++)
+			expected[i] = std::make_pair(keys[i], i);
+
+		Timer timer;
+		std::stable_sort(expected.begin(), expected.end(), 
+			[](const std::pair<UINT64, UINT32>& a, const std::pair<UINT64, UINT32>& b) { return a.first < b.first; });
+		UINT64 comparisonTime = timer.getMicroseconds();
+
+		Vector<UINT32> values(NUM_KEYS);
+		for (UINT32 i = 0; i < NUM_KEYS; i++)
+			values[i] = i;
+
+		Vector<UINT64> tempKeys(NUM_KEYS);
+		Vector<UINT32> tempValues(NUM_KEYS);
+
+		timer.reset();
+		RadixSort::sort(keys.data(), values.data(), tempKeys.data(), tempValues.data(), NUM_KEYS, 43);
+		UINT64 radixTime = timer.getMicroseconds();
+
+		bool matches = true;
+		for (UINT32 i = 0; i < NUM_KEYS; i++)
+			matches &= expected[i].first == keys[i] && expected[i].second == values[i];
+
+		BS_TEST_ASSERT(matches);
+
+		BS_TEST_ASSERT(RadixSort::toSortableKey(-1.0f) < RadixSort::toSortableKey(-0.5f));
+		BS_TEST_ASSERT(RadixSort::toSortableKey(-0.5f) < RadixSort::toSortableKey(0.0f));
+		BS_TEST_ASSERT(RadixSort::toSortableKey(-0.0f) == RadixSort::toSortableKey(0.0f));
+		BS_TEST_ASSERT(RadixSort::toSortableKey(0.0f) < RadixSort::toSortableKey(0.5f));
+		BS_TEST_ASSERT(RadixSort::toSortableKey(0.5f) < RadixSort::toSortableKey(100.0f));
+
+		LOGDBG("Sorting " + toString(NUM_KEYS) + " keys. Comparison: " + toString(comparisonTime) + "us, radix: " +
+			toString(radixTime) + "us.");
+	}
+
+	/** Command recorded by TestCommandRingBuffer. Padded so commands of different sizes can be recorded. */
+	template<UINT32 SIZE>
+	struct TestRingCommand
+	{
+		TestRingCommand(Vector<UINT32>* output, UINT32 id, const SPtr<UINT32>& token)
+			:output(output), id(id), token(token)
+		{ }
+
+		void operator()() { output->push_back(id); }
+
+		Vector<UINT32>* output;
+		UINT32 id;
+		SPtr<UINT32> token; /**< Shared by all commands, so we can check every command was destroyed exactly once. */
+		UINT8 padding[SIZE];
+	};
+
+	void EditorTestSuite::TestCommandRingBuffer()
+	{
+		static const UINT32 CAPACITY = 512;
+		static const UINT32 NUM_ROUNDS = 1000;
+		static const UINT32 NUM_THREADED_COMMANDS = 100000;
+
+		SPtr<UINT32> token = bs_shared_ptr_new<UINT32>(0);
+		Vector<UINT32> executed;
+
+		auto isSequence = [](const Vector<UINT32>& values, UINT32 count)
+		{
+			if (values.size() != count)
+				return false;
+
+			for (UINT32 i = 0; i < count; i++)
+			{
+				if (values[i] != i)
+					return false;
+			}
+
+			return true;
+		};
+
+		{
+			CommandRingBuffer buffer(CAPACITY);
+
+			// Fill the buffer until it overflows
+			UINT32 numQueued = 0;
+			while (buffer.tryQueue(TestRingCommand<32>(&executed, numQueued, token)))
+				numQueued++;
+
+			BS_TEST_ASSERT(numQueued > 0);
+			BS_TEST_ASSERT(buffer.hasPending());
+
+			// A command that doesn't fit must be left intact
+			TestRingCommand<32> overflowCommand(&executed, numQueued, token);
+			BS_TEST_ASSERT(!buffer.tryQueue(std::move(overflowCommand)));
+			BS_TEST_ASSERT(overflowCommand.token == token);
+
+			buffer.playback(buffer.submit());
+			BS_TEST_ASSERT(isSequence(executed, numQueued));
+			BS_TEST_ASSERT(buffer.getPlaybackPosition() == buffer.getSubmitPosition());
+
+			// Once played back, space is available again
+			BS_TEST_ASSERT(buffer.tryQueue(std::move(overflowCommand)));
+			BS_TEST_ASSERT(overflowCommand.token == nullptr);
+
+			buffer.playback(buffer.submit());
+			BS_TEST_ASSERT(isSequence(executed, numQueued + 1));
+
+			// Canceled commands are destroyed but never executed
+			executed.clear();
+			buffer.tryQueue(TestRingCommand<8>(&executed, 0, token));
+			buffer.tryQueue(TestRingCommand<256>(&executed, 1, token));
+			BS_TEST_ASSERT(token.use_count() == 3);
+
+			buffer.cancelAll();
+			BS_TEST_ASSERT(!buffer.hasPending());
+			BS_TEST_ASSERT(token.use_count() == 1);
+
+			buffer.playback(buffer.submit());
+			BS_TEST_ASSERT(executed.empty());
+
+			// Commands of mixed sizes, wrapping around the buffer many times. Largest ones don't fit inline and are stored
+			// on the heap.
+			UINT32 numCommands = 0;
+			for (UINT32 i = 0; i < NUM_ROUNDS; i++)
+			{
+				UINT32 numRoundCommands = 1 + i % 3;
+				for (UINT32 j = 0; j < numRoundCommands; j++)
+				{
+					bool queued;
+					switch ((i + j) % 3)
+					{
+					case 0:
+						queued = buffer.tryQueue(TestRingCommand<8>(&executed, numCommands, token));
+						break;
+					case 1:
+						queued = buffer.tryQueue(TestRingCommand<72>(&executed, numCommands, token));
+						break;
+					default:
+						queued = buffer.tryQueue(TestRingCommand<256>(&executed, numCommands, token));
+						break;
+					}
+
+					BS_TEST_ASSERT(queued);
+					numCommands++;
+				}
+
+				buffer.playback(buffer.submit());
+			}
+
+			BS_TEST_ASSERT(isSequence(executed, numCommands));
+			BS_TEST_ASSERT(buffer.getSubmitPosition() > CAPACITY * 10);
+			BS_TEST_ASSERT(token.use_count() == 1);
+
+			// Commands that were never played back are destroyed with the buffer
+			buffer.tryQueue(TestRingCommand<8>(&executed, 0, token));
+			buffer.submit();
+			buffer.tryQueue(TestRingCommand<8>(&executed, 1, token));
+		}
+
+		BS_TEST_ASSERT(token.use_count() == 1);
+
+		// Producer on a separate thread, waiting for space whenever the buffer is full
+		executed.clear();
+		executed.reserve(NUM_THREADED_COMMANDS);
+
+		CommandRingBuffer buffer(CAPACITY * 8);
+		std::atomic<bool> producerDone(false);
+
+		Timer timer;
+		Thread producer([&]()
+		{
+			for (UINT32 i = 0; i < NUM_THREADED_COMMANDS; i++)
+			{
+				while (!buffer.tryQueue(TestRingCommand<8>(&executed, i, token)))
+				{
+					buffer.submit();
+					buffer.waitForSpace();
+				}
+
+				if ((i % 16) == 0)
+					buffer.submit();
+			}
+
+			buffer.submit();
+			producerDone = true;
+		});
+
+		while (true)
+		{
+			bool done = producerDone;
+
+			UINT64 submitPos = buffer.getSubmitPosition();
+			if (submitPos == buffer.getPlaybackPosition())
+			{
+				if (done)
+					break;
+
+				std::this_thread::yield();
+				continue;
+			}
+
+			buffer.playback(submitPos);
+		}
+
+		producer.join();
+		UINT64 threadedTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(isSequence(executed, NUM_THREADED_COMMANDS));
+		BS_TEST_ASSERT(token.use_count() == 1);
+
+		LOGDBG("Recorded and played back " + toString(NUM_THREADED_COMMANDS) + " commands across threads in " +
+			toString(threadedTime) + "us.");
+	}
+
+	void EditorTestSuite::TestTransformHierarchy()
+	{
+		HSceneObject root = SceneObject::create("root");
+		root->setPosition(Vector3(1.0f, 2.0f, 3.0f));
+		root->setRotation(Quaternion(Degree(0.0f), Degree(45.0f), Degree(0.0f)));
+		root->setScale(Vector3(2.0f, 2.0f, 2.0f));
+
+		HSceneObject child0 = SceneObject::create("child0");
+		child0->setParent(root, false);
+		child0->setPosition(Vector3(0.0f, 1.0f, 0.0f));
+		child0->setRotation(Quaternion(Degree(30.0f), Degree(0.0f), Degree(0.0f)));
+
+		HSceneObject child1 = SceneObject::create("child1");
+		child1->setParent(root, false);
+		child1->setPosition(Vector3(-1.0f, 0.0f, 5.0f));
+
+		HSceneObject grandchild = SceneObject::create("grandchild");
+		grandchild->setParent(child0, false);
+		grandchild->setPosition(Vector3(0.0f, 0.0f, -2.0f));
+		grandchild->setScale(Vector3(0.5f, 1.0f, 1.0f));
+
+		Vector<HSceneObject> objects = { root, child0, child1, grandchild };
+
+		auto getTransforms = [&]()
+		{
+			Vector<Matrix4> output;
+			for (auto& entry : objects)
+				output.push_back(entry->getWorldTfrm());
+
+			return output;
+		};
+
+		auto compare = [](const Vector<Matrix4>& a, const Vector<Matrix4>& b)
+		{
+			for (UINT32 i = 0; i < (UINT32)a.size(); i++)
+			{
+				for (UINT32 row = 0; row < 4; row++)
+				{
+					for (UINT32 col = 0; col < 4; col++)
+					{
+						if (Math::abs(a[i][row][col] - b[i][row][col]) > 0.0001f)
+							return false;
+					}
+				}
+			}
+
+			return true;
+		};
+
+		Vector<Matrix4> expected = getTransforms();
+
+		TransformHierarchy& tfrmHierarchy = gCoreSceneManager().getTransformHierarchy();
+		bool wasEnabled = tfrmHierarchy.isEnabled();
+		tfrmHierarchy.setEnabled(true);
+		tfrmHierarchy._update(gCoreSceneManager().getRootNode());
+
+		BS_TEST_ASSERT(compare(expected, getTransforms()));
+
+		// Modify a transform, and read it lazily before the update
+		child0->setPosition(Vector3(3.0f, 0.0f, 0.0f));
+		Vector<Matrix4> modified = getTransforms();
+
+		tfrmHierarchy._update(gCoreSceneManager().getRootNode());
+		BS_TEST_ASSERT(compare(modified, getTransforms()));
+
+		// Re-parent, which moves the sub-tree to the end of the storage
+		grandchild->setParent(child1);
+		Vector<Matrix4> reparented = getTransforms();
+		BS_TEST_ASSERT(compare(modified, reparented)); // World transform should be kept
+
+		tfrmHierarchy._update(gCoreSceneManager().getRootNode());
+		BS_TEST_ASSERT(compare(reparented, getTransforms()));
+
+		child1->setRotation(Quaternion(Degree(0.0f), Degree(0.0f), Degree(90.0f)));
+		tfrmHierarchy._update(gCoreSceneManager().getRootNode());
+		Vector<Matrix4> managed = getTransforms();
+
+		tfrmHierarchy.setEnabled(false);
+		BS_TEST_ASSERT(compare(managed, getTransforms()));
+
+		// Spawn, re-parent and destroy objects every frame. Only the affected sub-trees should be patched, instead of
+		// the storage being rebuilt every frame.
+		static const UINT32 NUM_FRAMES = 100;
+
+		tfrmHierarchy.setEnabled(true);
+		tfrmHierarchy._update(gCoreSceneManager().getRootNode());
+
+		UINT32 numRebuilds = tfrmHierarchy.getNumRebuilds();
+
+		auto calcWorldTfrm = [](const HSceneObject& so)
+		{
+			Vector3 position = so->getPosition();
+			Quaternion rotation = so->getRotation();
+			Vector3 scale = so->getScale();
+
+			for (HSceneObject parent = so->getParent(); parent != nullptr; parent = parent->getParent())
+			{
+				position = parent->getRotation().rotate(parent->getScale() * position) + parent->getPosition();
+				rotation = parent->getRotation() * rotation;
+				scale = parent->getScale() * scale;
+			}
+
+			Matrix4 output;
+			output.setTRS(position, rotation, scale);
+
+			return output;
+		};
+
+		Vector<HSceneObject> spawned;
+		Vector<HSceneObject> leaves;
+		bool spawnedMatches = true;
+		for (UINT32 frame = 0; frame < NUM_FRAMES; frame++)
+		{
+			// Created objects are added to the scene root
+			HSceneObject so = SceneObject::create("spawned");
+			so->setPosition(Vector3((float)frame, 1.0f, 0.0f));
+			so->setRotation(Quaternion(Degree(0.0f), Degree((float)frame * 10.0f), Degree(0.0f)));
+
+			HSceneObject leafParent = (frame % 3) == 0 && frame > 0 ? spawned[frame / 2] : so;
+
+			HSceneObject leaf = SceneObject::create("leaf");
+			leaf->setParent(leafParent);
+			leaf->setPosition(Vector3(0.0f, 0.0f, 2.0f));
+			leaf->setScale(Vector3(1.0f, 2.0f, 1.0f));
+
+			spawned.push_back(so);
+			leaves.push_back(leaf);
+
+			// Objects are only ever parented to older objects, so no cycles can form
+			if ((frame % 5) == 4)
+				spawned[frame]->setParent(spawned[frame / 3]);
+
+			if ((frame % 7) == 6)
+			{
+				UINT32 leafIdx = frame / 2;
+				leaves[leafIdx]->destroy(true);
+				leaves.erase(leaves.begin() + leafIdx);
+			}
+
+			spawned[frame / 4]->setRotation(Quaternion(Degree((float)frame), Degree(0.0f), Degree(0.0f)));
+			spawned[0]->setScale(Vector3(1.0f, 1.0f + frame * 0.01f, 1.0f));
+
+			// Read some transforms lazily before the update
+			spawnedMatches &= compare({ calcWorldTfrm(leaf) }, { leaf->getWorldTfrm() });
+
+			tfrmHierarchy._update(gCoreSceneManager().getRootNode());
+
+			for (auto& entry : spawned)
+				spawnedMatches &= compare({ calcWorldTfrm(entry) }, { entry->getWorldTfrm() });
+
+			for (auto& entry : leaves)
+				spawnedMatches &= compare({ calcWorldTfrm(entry) }, { entry->getWorldTfrm() });
+		}
+
+		BS_TEST_ASSERT(spawnedMatches);
+		BS_TEST_ASSERT((tfrmHierarchy.getNumRebuilds() - numRebuilds) <= NUM_FRAMES / 10);
+
+		for (auto& entry : spawned)
+		{
+			if (!entry.isDestroyed())
+				entry->destroy(true);
+		}
+
+		tfrmHierarchy.setEnabled(wasEnabled);
+		root->destroy();
+	}
+
+	void EditorTestSuite::TestComponentUpdate()
+	{
+		static const UINT32 NUM_PARENTS = 1000;
+		static const UINT32 NUM_CHILDREN = 99;
+
+		HSceneObject root = SceneObject::create("root");
+
+		Vector<HSceneObject> parents;
+		Vector<GameObjectHandle<TestComponentA>> components;
+		for (UINT32 i = 0; i < NUM_PARENTS; i++)
+		{
+			HSceneObject parent = SceneObject::create("parent");
+			parent->setParent(root);
+			components.push_back(parent->addComponent<TestComponentA>());
+
+			for (UINT32 j = 0; j < NUM_CHILDREN; j++)
+			{
+				HSceneObject child = SceneObject::create("child");
+				child->setParent(parent);
+				components.push_back(child->addComponent<TestComponentA>());
+			}
+
+			parents.push_back(parent);
+		}
+
+		auto countUpdates = [&]()
+		{
+			UINT32 numUpdates = 0;
+			for (auto& component : components)
+			{
+				if (!component.isDestroyed())
+					numUpdates += component->numUpdates;
+			}
+
+			return numUpdates;
+		};
+
+		UINT32 numComponents = NUM_PARENTS * (NUM_CHILDREN + 1);
+
+		// Traverse the hierarchy the same way the scene manager used to
+		Timer timer;
+		{
+			Stack<HSceneObject> todo;
+			todo.push(root);
+
+			while (!todo.empty())
+			{
+				HSceneObject currentSO = todo.top();
+				todo.pop();
+
+				if (!currentSO->getActive(true))
+					continue;
+
+				const Vector<HComponent>& components = currentSO->getComponents();
+				for (auto& component : components)
+					component->update();
+
+				for (UINT32 i = 0; i < currentSO->getNumChildren(); i++)
+					todo.push(currentSO->getChild(i));
+			}
+		}
+		UINT64 traversalTime = timer.getMicroseconds();
+
+		timer.reset();
+		gCoreSceneManager()._updateComponents();
+		UINT64 registryTime = timer.getMicroseconds();
+
+		LOGDBG("Updating " + toString(numComponents) + " components. Scene graph traversal: " + 
+			toString(traversalTime) + "us, component registry: " + toString(registryTime) + "us.");
+
+		BS_TEST_ASSERT(countUpdates() == numComponents * 2);
+
+		// Disabling, re-enabling and destroying objects must keep the registry consistent
+		for (UINT32 i = 0; i < NUM_PARENTS; i += 2)
+			parents[i]->setActive(false);
+
+		UINT32 numUpdates = countUpdates();
+		gCoreSceneManager()._updateComponents();
+		BS_TEST_ASSERT(countUpdates() == numUpdates + numComponents / 2);
+
+		for (UINT32 i = 0; i < NUM_PARENTS; i += 2)
+			parents[i]->setActive(true);
+
+		// Destruction is delayed, but components of destroyed objects must stop updating right away
+		for (auto& parent : parents)
+			parent->getChild(0)->destroy();
+
+		numUpdates = countUpdates();
+		gCoreSceneManager()._updateComponents();
+		BS_TEST_ASSERT(countUpdates() == numUpdates + numComponents - NUM_PARENTS);
+
+		// Removing components must not change the update order of the rest, which for objects that were never disabled
+		// is the order they were created in
+		UINT32 lastUpdate = 0;
+		bool inOrder = true;
+		for (UINT32 i = 1; i < NUM_PARENTS; i += 2)
+		{
+			for (UINT32 j = 0; j < (NUM_CHILDREN + 1); j++)
+			{
+				if (j == 1) // First child was destroyed
+					continue;
+
+				UINT32 update = components[i * (NUM_CHILDREN + 1) + j]->lastUpdate;
+				inOrder &= update > lastUpdate;
+				lastUpdate = update;
+			}
+		}
+
+		BS_TEST_ASSERT(inOrder);
+
+		root->destroy(true);
+
+		// Components added to a prefab instance are re-added by its diff when the instance is updated from the prefab,
+		// and must keep updating
+		HSceneObject prefabRoot = SceneObject::create("prefabRoot");
+		prefabRoot->addComponent<TestComponentA>();
+
+		HPrefab prefab = Prefab::create(prefabRoot);
+
+		HSceneObject instance = prefab->instantiate();
+		instance->addComponent<TestComponentA>();
+		PrefabUtility::recordPrefabDiff(instance);
+
+		prefabRoot->setPosition(Vector3(1.0f, 0.0f, 0.0f));
+		prefab->update(prefabRoot);
+
+		PrefabUtility::updateFromPrefab(instance);
+		BS_TEST_ASSERT(instance->getPosition() == prefabRoot->getPosition());
+
+		Vector<GameObjectHandle<TestComponentA>> instanceComponents;
+		for (auto& component : instance->getComponents())
+		{
+			if (rtti_is_of_type<TestComponentA>(component.get()))
+				instanceComponents.push_back(static_object_cast<TestComponentA>(component));
+		}
+
+		BS_TEST_ASSERT(instanceComponents.size() == 2);
+
+		gCoreSceneManager()._updateComponents();
+		for (auto& component : instanceComponents)
+			BS_TEST_ASSERT(component->numUpdates == 1);
+
+		instance->destroy(true);
+		prefabRoot->destroy(true);
+	}
+
+	void EditorTestSuite::TestTaskScheduler()
+	{
+		TaskScheduler& scheduler = TaskScheduler::instance();
+
+		// Chain of dependent tasks, queued in reverse so each one is queued before its dependency
+		static const UINT32 NUM_CHAINED = 16;
+
+		std::atomic<UINT32> counter(0);
+		UINT32 executionOrder[NUM_CHAINED];
+
+		Vector<SPtr<Task>> chain(NUM_CHAINED);
+		for (UINT32 i = 0; i < NUM_CHAINED; i++)
+		{
+			auto worker = [&executionOrder, &counter, i]() { executionOrder[i] = counter++; };
+			chain[i] = Task::create("Chained", worker, TaskPriority::Normal, i > 0 ? chain[i - 1] : nullptr);
+		}
+
+		for (UINT32 i = NUM_CHAINED; i > 0; i--)
+			scheduler.addTask(chain[i - 1]);
+
+		chain.back()->wait();
+
+		bool inOrder = true;
+		for (UINT32 i = 0; i < NUM_CHAINED; i++)
+			inOrder &= chain[i]->isComplete() && executionOrder[i] == i;
+
+		BS_TEST_ASSERT(inOrder);
+
+		// Canceling a task cancels everything depending on it, whether the task was queued or not
+		std::atomic<UINT32> numCanceledExecuted(0);
+		auto canceledWorker = [&numCanceledExecuted]() { numCanceledExecuted++; };
+
+		SPtr<Task> canceled = Task::create("Canceled", canceledWorker);
+		SPtr<Task> canceledDependent = Task::create("CanceledDependent", canceledWorker, TaskPriority::Normal, canceled);
+		SPtr<Task> canceledDependent2 = Task::create("CanceledDependent2", canceledWorker, TaskPriority::Normal,
+			canceledDependent);
+
+		scheduler.addTask(canceledDependent);
+		scheduler.addTask(canceledDependent2);
+		canceled->cancel();
+
+		canceledDependent2->wait();
+		BS_TEST_ASSERT(canceledDependent->isCanceled() && canceledDependent2->isCanceled());
+
+		SPtr<Task> queuedCanceled = Task::create("QueuedCanceled", canceledWorker);
+		queuedCanceled->cancel();
+		scheduler.addTask(queuedCanceled);
+
+		SPtr<Task> lateDependent = Task::create("LateDependent", canceledWorker, TaskPriority::Normal, queuedCanceled);
+		scheduler.addTask(lateDependent);
+
+		queuedCanceled->wait();
+		lateDependent->wait();
+		BS_TEST_ASSERT(queuedCanceled->isCanceled() && lateDependent->isCanceled());
+		BS_TEST_ASSERT(numCanceledExecuted == 0);
+
+		// Canceling a task that already completed has no effect
+		chain[0]->cancel();
+		BS_TEST_ASSERT(chain[0]->isComplete() && !chain[0]->isCanceled());
+
+		// Parent tasks complete only once all of their children complete, and tasks depending on the parent wait for
+		// the children as well
+		static const UINT32 NUM_CHILDREN = 32;
+
+		std::atomic<UINT32> numChildrenDone(0);
+		UINT32 numChildrenDoneInDependent = 0;
+		SPtr<Task> parent;
+
+		auto childWorker = [&numChildrenDone]()
+		{
+			std::this_thread::yield();
+			numChildrenDone++;
+		};
+
+		auto parentWorker = [&scheduler, &parent, &childWorker]()
+		{
+			for (UINT32 i = 0; i < NUM_CHILDREN; i++)
+				scheduler.addTask(Task::create("Child", childWorker), parent);
+		};
+
+		auto parentDependentWorker = [&numChildrenDone, &numChildrenDoneInDependent]()
+		{
+			numChildrenDoneInDependent = numChildrenDone;
+		};
+
+		parent = Task::create("Parent", parentWorker);
+		SPtr<Task> parentDependent = Task::create("ParentDependent", parentDependentWorker, TaskPriority::Normal, parent);
+
+		scheduler.addTask(parent);
+		scheduler.addTask(parentDependent);
+
+		parent->wait();
+		BS_TEST_ASSERT(parent->isComplete() && numChildrenDone == NUM_CHILDREN);
+
+		parentDependent->wait();
+		BS_TEST_ASSERT(numChildrenDoneInDependent == NUM_CHILDREN);
+
+		// Nested parallel-for loops, including ones started from tasks
+		static const UINT32 NUM_OUTER = 64;
+		static const UINT32 NUM_INNER = 256;
+
+		std::atomic<UINT32> numVisited(0);
+		auto innerLoop = [&numVisited](UINT32 begin, UINT32 end) { numVisited += end - begin; };
+		auto outerLoop = [&scheduler, &innerLoop](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+				scheduler.parallelFor(0, NUM_INNER, 16, innerLoop);
+		};
+
+		scheduler.parallelFor(0, NUM_OUTER, 1, outerLoop);
+		BS_TEST_ASSERT(numVisited == NUM_OUTER * NUM_INNER);
+
+		numVisited = 0;
+		auto parallelForWorker = [&scheduler, &outerLoop]() { scheduler.parallelFor(0, NUM_OUTER, 4, outerLoop); };
+
+		SPtr<Task> parallelForTask = Task::create("ParallelFor", parallelForWorker);
+		scheduler.addTask(parallelForTask);
+		parallelForTask->wait();
+
+		BS_TEST_ASSERT(numVisited == NUM_OUTER * NUM_INNER);
+
+		// Tasks waiting on other tasks from worker threads must not deadlock, even if there are fewer workers than 
+		// waiting tasks
+		static const UINT32 NUM_WAITING = 16;
+
+		std::atomic<UINT32> numWaitsDone(0);
+		auto innerWorker = [&counter]() { counter++; };
+		auto waitingWorker = [&numWaitsDone, &innerWorker, &scheduler]()
+		{
+			SPtr<Task> inner = Task::create("Inner", innerWorker);
+			scheduler.addTask(inner);
+			inner->wait();
+
+			if (inner->isComplete())
+				numWaitsDone++;
+		};
+
+		Vector<SPtr<Task>> waitingTasks;
+		for (UINT32 i = 0; i < NUM_WAITING; i++)
+		{
+			waitingTasks.push_back(Task::create("Waiting", waitingWorker));
+			scheduler.addTask(waitingTasks.back());
+		}
+
+		for (auto& task : waitingTasks)
+			task->wait();
+
+		BS_TEST_ASSERT(numWaitsDone == NUM_WAITING);
+	}
+
+	void EditorTestSuite::TestMemoryMappedLoad()
+	{
+		static const UINT32 TEX_SIZE = 256;
+		static const UINT32 NUM_VERTICES = 4096;
+
+		Path pixelPath = Path::combine(FileSystem::getTempDirectoryPath(), "testmapped.pixels");
+		Path meshPath = Path::combine(FileSystem::getTempDirectoryPath(), "testmapped.mesh");
+		Path emptyPath = Path::combine(FileSystem::getTempDirectoryPath(), "testmapped.empty");
+
+		SPtr<PixelData> srcPixels = PixelData::create(TEX_SIZE, TEX_SIZE, 1, PF_R8G8B8A8);
+		for (UINT32 y = 0; y < TEX_SIZE; y++)
+		{
+			for (UINT32 x = 0; x < TEX_SIZE; x++)
+				srcPixels->setColorAt(Color(x / 255.0f, y / 255.0f, ((x + y) % 256) / 255.0f, 1.0f), x, y);
+		}
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+
+		SPtr<MeshData> srcMesh = MeshData::create(NUM_VERTICES, NUM_VERTICES, vertexDesc);
+		Vector<Vector3> positions(NUM_VERTICES);
+		UINT32* srcIndices = srcMesh->getIndices32();
+		for (UINT32 i = 0; i < NUM_VERTICES; i++)
+		{
+			positions[i] = Vector3((float)i, (float)(i * 2), (float)(i * 3));
+			srcIndices[i] = NUM_VERTICES - i - 1;
+		}
+
+		UINT32 positionsSize = NUM_VERTICES * sizeof(Vector3);
+		srcMesh->setVertexData(VES_POSITION, (UINT8*)positions.data(), positionsSize);
+
+		{
+			FileEncoder pixelEncoder(pixelPath);
+			pixelEncoder.encode(srcPixels.get());
+
+			FileEncoder meshEncoder(meshPath);
+			meshEncoder.encode(srcMesh.get());
+		}
+
+		UINT32 pixelDataSize = srcPixels->getConsecutiveSize();
+		UINT32 meshDataSize = srcMesh->getSize();
+
+		Timer timer;
+		SPtr<PixelData> pixels;
+		SPtr<MeshData> mesh;
+		{
+			FileDecoder pixelDecoder(pixelPath, true);
+			pixels = std::static_pointer_cast<PixelData>(pixelDecoder.decode());
+
+			FileDecoder meshDecoder(meshPath, true);
+			mesh = std::static_pointer_cast<MeshData>(meshDecoder.decode());
+		}
+		UINT64 mappedTime = timer.getMicroseconds();
+
+		// Decoders are gone, but the data still references the mappings, which are kept alive by the decoded objects
+		BS_TEST_ASSERT(pixels != nullptr && mesh != nullptr);
+		if (pixels == nullptr || mesh == nullptr)
+			return;
+
+		BS_TEST_ASSERT(pixels->getDataSource() != nullptr && pixels->getDataSource()->isMemoryMapped());
+		BS_TEST_ASSERT(mesh->getDataSource() != nullptr && mesh->getDataSource()->isMemoryMapped());
+
+		BS_TEST_ASSERT(memcmp(pixels->getData(), srcPixels->getData(), pixelDataSize) == 0);
+		BS_TEST_ASSERT(memcmp(mesh->getData(), srcMesh->getData(), meshDataSize) == 0);
+
+		Vector<Vector3> readPositions(NUM_VERTICES);
+		mesh->getVertexData(VES_POSITION, (UINT8*)readPositions.data(), positionsSize);
+		BS_TEST_ASSERT(readPositions == positions);
+		BS_TEST_ASSERT(mesh->getIndices32()[0] == NUM_VERTICES - 1);
+
+		// Mapped memory is read-only, so writes must first detach the data from the mapping
+		pixels->setColorAt(Color::Black, 0, 0);
+		BS_TEST_ASSERT(pixels->getDataSource() == nullptr);
+		BS_TEST_ASSERT(pixels->getColorAt(0, 0) == Color::Black);
+		BS_TEST_ASSERT(memcmp(pixels->getData() + 4, srcPixels->getData() + 4, pixelDataSize - 4) == 0);
+
+		positions[0] = Vector3::ZERO;
+		mesh->setVertexData(VES_POSITION, (UINT8*)positions.data(), positionsSize);
+		BS_TEST_ASSERT(mesh->getDataSource() == nullptr);
+		BS_TEST_ASSERT(mesh->getIndices32()[0] == NUM_VERTICES - 1);
+
+		// Files on disk must be left untouched
+		{
+			FileDecoder pixelDecoder(pixelPath);
+			SPtr<PixelData> filePixels = std::static_pointer_cast<PixelData>(pixelDecoder.decode());
+
+			BS_TEST_ASSERT(filePixels->getDataSource() == nullptr);
+			BS_TEST_ASSERT(memcmp(filePixels->getData(), srcPixels->getData(), pixelDataSize) == 0);
+		}
+
+		timer.reset();
+		{
+			FileDecoder pixelDecoder(pixelPath);
+			pixels = std::static_pointer_cast<PixelData>(pixelDecoder.decode());
+
+			FileDecoder meshDecoder(meshPath);
+			mesh = std::static_pointer_cast<MeshData>(meshDecoder.decode());
+		}
+		UINT64 streamTime = timer.getMicroseconds();
+
+		// Empty files aren't mapped, and result in an empty stream
+		FileSystem::createAndOpenFile(emptyPath)->close();
+		{
+			MemoryMappedDataStream emptyStream(emptyPath);
+			BS_TEST_ASSERT(!emptyStream.isMemoryMapped());
+			BS_TEST_ASSERT(emptyStream.size() == 0);
+		}
+
+		// Mappings must be released before the files can be removed
+		pixels = nullptr;
+		mesh = nullptr;
+
+		FileSystem::remove(pixelPath);
+		FileSystem::remove(meshPath);
+		FileSystem::remove(emptyPath);
+
+		LOGDBG("Decoding pixel and mesh data from mapped files: " + toString(mappedTime) + "us, from file streams: " +
+			toString(streamTime) + "us.");
+	}
+
+	void EditorTestSuite::TestBinaryDecode()
+	{
+		static const UINT32 NUM_INTS = 100000;
+		static const UINT32 NUM_ITERATIONS = 10;
+
+		SPtr<TestObjectC> root = bs_shared_ptr_new<TestObjectC>();
+		SPtr<TestObjectC> childA = bs_shared_ptr_new<TestObjectC>();
+		SPtr<TestObjectC> childB = bs_shared_ptr_new<TestObjectC>();
+
+		// Static size plain array, read in bulk, and a dynamic size one, read per element
+		root->arrIntA.resize(NUM_INTS);
+		for (UINT32 i = 0; i < NUM_INTS; i++)
+			root->arrIntA[i] = i * 7 + 3;
+
+		root->arrStrA = { "a", "bb", "ccc" };
+
+		// Inline objects nested three levels deep
+		root->objA.intA = 10;
+		root->objA.objB.intA = 11;
+		root->objA.arrObjA[1].strA = "nested";
+
+		root->arrObjA.resize(2);
+		root->arrObjA[1].strB = "arrayNested";
+		root->arrObjA[1].arrObjB[2].intA = 12;
+
+		// Reference cycles (through weak references), and an object referenced from multiple places
+		root->objPtrA = childA;
+		root->arrObjPtrA = { childA, childB };
+
+		childA->objPtrA = root;
+		childA->arrIntA = { 1, 2, 3 };
+
+		childB->objPtrA = childB;
+		childB->arrObjPtrA = { childA };
+
+		auto verify = [&](const SPtr<TestObjectC>& output)
+		{
+			BS_TEST_ASSERT(output != nullptr);
+			if (output == nullptr)
+				return;
+
+			BS_TEST_ASSERT(output->arrIntA == root->arrIntA);
+			BS_TEST_ASSERT(output->arrStrA == root->arrStrA);
+
+			BS_TEST_ASSERT(output->objA.intA == 10);
+			BS_TEST_ASSERT(output->objA.objB.intA == 11);
+			BS_TEST_ASSERT(output->objA.arrObjA.size() == 3 && output->objA.arrObjA[1].strA == "nested");
+			BS_TEST_ASSERT(output->objA.objPtrA != nullptr && output->objA.objPtrA->intA == 100);
+
+			BS_TEST_ASSERT(output->arrObjA.size() == 2);
+			if (output->arrObjA.size() == 2)
+			{
+				BS_TEST_ASSERT(output->arrObjA[1].strB == "arrayNested");
+				BS_TEST_ASSERT(output->arrObjA[1].arrObjB.size() == 3 && output->arrObjA[1].arrObjB[2].intA == 12);
+			}
+
+			BS_TEST_ASSERT(output->arrObjPtrA.size() == 2);
+			if (output->arrObjPtrA.size() != 2)
+				return;
+
+			SPtr<TestObjectC> outChildA = output->arrObjPtrA[0];
+			SPtr<TestObjectC> outChildB = output->arrObjPtrA[1];
+
+			BS_TEST_ASSERT(output->objPtrA == outChildA);
+			BS_TEST_ASSERT(outChildA->objPtrA == output);
+			BS_TEST_ASSERT(outChildA->arrIntA == childA->arrIntA);
+			BS_TEST_ASSERT(outChildB->objPtrA == outChildB);
+			BS_TEST_ASSERT(outChildB->arrObjPtrA.size() == 1 && outChildB->arrObjPtrA[0] == outChildA);
+		};
+
+		// Cycles would otherwise keep the objects alive
+		auto breakCycles = [](const SPtr<TestObjectC>& object)
+		{
+			if (object == nullptr)
+				return;
+
+			for (auto& entry : object->arrObjPtrA)
+				entry->objPtrA = nullptr;
+
+			object->objPtrA = nullptr;
+		};
+
+		MemorySerializer ms;
+		UINT32 size = 0;
+		UINT8* data = ms.encode(root.get(), size);
+
+		// Memory stream, plain data referenced directly
+		SPtr<TestObjectC> output = std::static_pointer_cast<TestObjectC>(ms.decode(data, size));
+		verify(output);
+		breakCycles(output);
+
+		// Through the intermediate representation
+		{
+			SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(data, size, false);
+
+			BinarySerializer bs;
+			SPtr<SerializedObject> intermediate = bs._decodeToIntermediate(stream, size);
+			output = std::static_pointer_cast<TestObjectC>(bs._decodeFromIntermediate(intermediate));
+			verify(output);
+			breakCycles(output);
+		}
+
+		// File stream, plain data read through a temporary buffer
+		Path filePath = Path::combine(FileSystem::getTempDirectoryPath(), "testbinarydecode.asset");
+		{
+			FileEncoder encoder(filePath);
+			encoder.encode(root.get());
+		}
+
+		{
+			FileDecoder decoder(filePath);
+			output = std::static_pointer_cast<TestObjectC>(decoder.decode());
+			verify(output);
+			breakCycles(output);
+		}
+
+		FileSystem::remove(filePath);
+
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			breakCycles(std::static_pointer_cast<TestObjectC>(ms.decode(data, size)));
+		UINT64 directTime = timer.getMicroseconds();
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(data, size, false);
+
+			BinarySerializer bs;
+			SPtr<SerializedObject> intermediate = bs._decodeToIntermediate(stream, size);
+			breakCycles(std::static_pointer_cast<TestObjectC>(bs._decodeFromIntermediate(intermediate)));
+		}
+		UINT64 intermediateTime = timer.getMicroseconds();
+
+		bs_free(data);
+		breakCycles(root);
+
+		LOGDBG("Decoding " + toString(size) + " bytes (" + toString(NUM_ITERATIONS) + " iterations): " + 
+			toString(directTime) + "us directly, " + toString(intermediateTime) + "us through the intermediate " + 
+			"representation.");
+	}
+
+	void EditorTestSuite::TestPrefabInstantiate()
+	{
+		static const UINT32 NUM_CHILDREN = 20;
+		static const UINT32 NUM_INSTANCES = 500;
+
+		HSceneObject root = SceneObject::create("root");
+		for (UINT32 i = 0; i < NUM_CHILDREN; i++)
+		{
+			HSceneObject child = SceneObject::create("child");
+			child->setParent(root);
+
+			GameObjectHandle<TestComponentC> cmp = child->addComponent<TestComponentC>();
+			cmp->obj.intA = i;
+		}
+
+		HPrefab prefab = Prefab::create(root);
+
+		Vector<HSceneObject> instances;
+
+		// Clone the prefab hierarchy the same way prefab instantiation used to, encoding it for every instance
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_INSTANCES; i++)
+			instances.push_back(prefab->_getRoot()->clone());
+
+		UINT64 cloneTime = timer.getMicroseconds();
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_INSTANCES; i++)
+			instances.push_back(prefab->_clone());
+
+		UINT64 instantiationDataTime = timer.getMicroseconds();
+
+		LOGDBG("Spawning " + toString(NUM_INSTANCES) + " prefab instances with " + toString(NUM_CHILDREN) + 
+			" children. Hierarchy clone: " + toString(cloneTime) + "us, instantiation data: " + 
+			toString(instantiationDataTime) + "us.");
+
+		// Both paths must create identical hierarchies with new objects
+		for (auto& instance : instances)
+		{
+			BS_TEST_ASSERT(instance->getNumChildren() == NUM_CHILDREN);
+
+			for (UINT32 i = 0; i < NUM_CHILDREN; i++)
+			{
+				HSceneObject child = instance->getChild(i);
+				BS_TEST_ASSERT(child->getInstanceId() != root->getChild(i)->getInstanceId());
+
+				GameObjectHandle<TestComponentC> cmp = child->getComponent<TestComponentC>();
+				BS_TEST_ASSERT(cmp != nullptr && cmp->obj.intA == i);
+			}
+		}
+
+		// Updating the prefab must invalidate the instantiation data
+		root->getChild(0)->getComponent<TestComponentC>()->obj.intA = 999;
+		prefab->update(root);
+
+		HSceneObject updatedInstance = prefab->_clone();
+		BS_TEST_ASSERT(updatedInstance->getChild(0)->getComponent<TestComponentC>()->obj.intA == 999);
+
+		// So must modifying the prefab hierarchy directly, same as when prefab diffs are stripped for a build
+		HSceneObject prefabRoot = prefab->_editRoot();
+		prefabRoot->getChild(1)->getComponent<TestComponentC>()->obj.intA = 1000;
+		prefabRoot->getChild(2)->_clearPrefabDiff();
+
+		HSceneObject editedInstance = prefab->_clone();
+		BS_TEST_ASSERT(editedInstance->getChild(0)->getComponent<TestComponentC>()->obj.intA == 999);
+		BS_TEST_ASSERT(editedInstance->getChild(1)->getComponent<TestComponentC>()->obj.intA == 1000);
+
+		for (auto& instance : instances)
+			instance->destroy();
+
+		updatedInstance->destroy();
+		editedInstance->destroy();
+		root->destroy();
+	}
+
+	void EditorTestSuite::TestPrefabPool()
+	{
+		HSceneObject root = SceneObject::create("root");
+
+		HSceneObject child0 = SceneObject::create("child0");
+		child0->setParent(root);
+		child0->addComponent<TestComponentC>();
+		child0->addComponent<TestComponentA>();
+
+		HSceneObject child1 = SceneObject::create("child1");
+		child1->setParent(root);
+		child1->addComponent<TestComponentD>();
+		child1->addComponent<TestComponentA>();
+
+		HPrefab prefab = Prefab::create(root);
+
+		PrefabPool pool(prefab, 1);
+		BS_TEST_ASSERT(pool.getNumPooled() == 1);
+
+		HSceneObject instance = pool.instantiate();
+		BS_TEST_ASSERT(pool.getNumPooled() == 0);
+		BS_TEST_ASSERT(instance->getActive());
+
+		UINT64 instanceId = instance->getInstanceId();
+		UINT64 child0Id = instance->getChild(0)->getInstanceId();
+
+		// Modify the instance
+		instance->setPosition(Vector3(1.0f, 2.0f, 3.0f));
+		instance->getChild(0)->getComponent<TestComponentC>()->obj.intA = 999;
+		instance->getChild(0)->addComponent<TestComponentD>();
+		instance->getChild(0)->getComponent<TestComponentA>()->destroy();
+		instance->getChild(1)->destroy();
+
+		HSceneObject addedChild = SceneObject::create("addedChild");
+		addedChild->setParent(instance);
+
+		pool.release(instance);
+		BS_TEST_ASSERT(pool.getNumPooled() == 1);
+		BS_TEST_ASSERT(!instance->getActive());
+
+		// Components re-added by the revert must go through the same lifecycle as instantiated ones, but stay disabled
+		// while pooled
+		GameObjectHandle<TestComponentA> readdedComponent = instance->getChild(0)->getComponent<TestComponentA>();
+		GameObjectHandle<TestComponentA> readdedChildComponent = instance->getChild(1)->getComponent<TestComponentA>();
+		BS_TEST_ASSERT(readdedComponent != nullptr && readdedChildComponent != nullptr);
+		BS_TEST_ASSERT(readdedComponent->initialized && readdedChildComponent->initialized);
+		BS_TEST_ASSERT(!readdedComponent->enabled && !readdedChildComponent->enabled);
+
+		gCoreSceneManager()._updateComponents();
+		BS_TEST_ASSERT(readdedComponent->numUpdates == 0 && readdedChildComponent->numUpdates == 0);
+
+		// Same objects must be reused, with only the modified state reverted
+		HSceneObject reused = pool.instantiate();
+		BS_TEST_ASSERT(reused->getInstanceId() == instanceId);
+		BS_TEST_ASSERT(reused->getActive());
+		BS_TEST_ASSERT(reused->getPosition() == root->getPosition());
+		BS_TEST_ASSERT(reused->getNumChildren() == 2);
+
+		HSceneObject reusedChild0 = reused->getChild(0);
+		BS_TEST_ASSERT(reusedChild0->getInstanceId() == child0Id);
+		BS_TEST_ASSERT(reusedChild0->getComponents().size() == 2);
+		BS_TEST_ASSERT(reusedChild0->getComponent<TestComponentC>()->obj.intA == TestObjectA().intA);
+
+		HSceneObject reusedChild1 = reused->getChild(1);
+		BS_TEST_ASSERT(reusedChild1->getName() == child1->getName());
+		BS_TEST_ASSERT(reusedChild1->getComponent<TestComponentD>() != nullptr);
+
+		// Once handed out again the re-added components must be enabled and receive updates
+		BS_TEST_ASSERT(readdedComponent->enabled && readdedChildComponent->enabled);
+
+		gCoreSceneManager()._updateComponents();
+		BS_TEST_ASSERT(readdedComponent->numUpdates == 1 && readdedChildComponent->numUpdates == 1);
+
+		pool.release(reused);
+		pool.clear();
+		BS_TEST_ASSERT(pool.getNumPooled() == 0);
+
+		root->destroy();
+	}
+
+	void EditorTestSuite::TestGUIMeshUpdate()
+	{
+		SPtr<RenderTexture> renderTexture = RenderTexture::create(TEX_TYPE_2D, 256, 256);
+		SPtr<Camera> camera = Camera::create(renderTexture);
+		const Viewport* viewport = camera->getViewport().get();
+
+		SPtr<GUIWidget> widget = GUIWidget::create(camera);
+		widget->setSkin(BuiltinResources::instance().getGUISkin());
+
+		GUIInputBox* inputBox = GUIInputBox::create();
+		inputBox->setText(L"Caret");
+		widget->getPanel()->addElement(inputBox);
+
+		// Focus the input box and move the caret, so the caret gets shown
+		gGUIManager().setFocus(inputBox, true);
+		gGUIManager().update();
+
+		gInput().onInputCommand(InputCommandType::CursorMoveLeft);
+		gGUIManager().update();
+
+		UINT32 numRebuilds = gGUIManager()._getNumMeshRebuilds(viewport);
+		BS_TEST_ASSERT(numRebuilds > 0);
+
+		// With no blink interval the caret blinks on every update
+		float blinkInterval = gGUIManager().getCaretBlinkInterval();
+		gGUIManager().setCaretBlinkInterval(0.0f);
+
+		static const UINT32 NUM_BLINKS = 4;
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_BLINKS; i++)
+		{
+			bool caretOn = gGUIManager().getCaretBlinkState();
+			gGUIManager().update();
+			BS_TEST_ASSERT(gGUIManager().getCaretBlinkState() != caretOn);
+		}
+		UINT64 blinkTime = timer.getMicroseconds() / NUM_BLINKS;
+
+		gGUIManager().setCaretBlinkInterval(blinkInterval);
+		BS_TEST_ASSERT(gGUIManager()._getNumMeshRebuilds(viewport) == numRebuilds);
+
+		// Each of the input box's meshes only contains its own elements, so the entire mesh can be re-tinted
+		inputBox->setTint(Color::Red);
+		gGUIManager().update();
+		BS_TEST_ASSERT(gGUIManager()._getNumMeshRebuilds(viewport) == numRebuilds);
+
+		// Layout changes still require a rebuild
+		inputBox->setWidth(100);
+
+		timer.reset();
+		gGUIManager().update();
+		UINT64 rebuildTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(gGUIManager()._getNumMeshRebuilds(viewport) == (numRebuilds + 1));
+
+		LOGDBG("GUI update with a caret blink: " + toString(blinkTime) + "us, with a layout change: " +
+			toString(rebuildTime) + "us.");
+
+		gGUIManager().setFocus(inputBox, false);
+		gGUIManager().update();
+
+		GUIElement::destroy(inputBox);
+		widget = nullptr;
+		camera->destroy();
+		renderTexture->destroy();
+	}
+
+	void EditorTestSuite::TestGUIElementGrid()
+	{
+		static const UINT32 WIDTH = 1024;
+		static const UINT32 HEIGHT = 1024;
+		static const UINT32 NUM_ELEMENTS = 1000;
+		static const UINT32 NUM_QUERIES = 10000;
+
+		SPtr<RenderTexture> renderTexture = RenderTexture::create(TEX_TYPE_2D, WIDTH, HEIGHT);
+		SPtr<Camera> camera = Camera::create(renderTexture);
+
+		SPtr<GUIWidget> widget = GUIWidget::create(camera);
+		widget->setSkin(BuiltinResources::instance().getGUISkin());
+
+		// Elements are placed in a child panel, so they can be clipped by changing the panel's bounds
+		GUIPanel* panel = widget->getPanel()->addNewElement<GUIPanel>();
+		panel->setPosition(0, 0);
+		panel->setWidth(WIDTH);
+		panel->setHeight(HEIGHT);
+
+		Vector<GUIElement*> elements;
+		auto addElements = [&](UINT32 count)
+		{
+			for (UINT32 i = 0; i < count; i++)
+			{
+				UINT32 width = 8 + std::rand() % 200;
+				UINT32 height = 8 + std::rand() % 200;
+
+				GUILabel* label = GUILabel::create(HString(L"Label"),
+					GUIOptions(GUIOption::fixedWidth(width), GUIOption::fixedHeight(height)));
+				label->setPosition(std::rand() % WIDTH - 100, std::rand() % HEIGHT - 100);
+
+				panel->addElement(label);
+				elements.push_back(label);
+			}
+		};
+
+		Vector<Vector2I> positions(NUM_QUERIES);
+		for (auto& position : positions)
+			position = Vector2I(std::rand() % (WIDTH + 200) - 100, std::rand() % (HEIGHT + 200) - 100);
+
+		// Elements under each position in the order the manager would process them, with null after each position
+		Vector<GUIElement*> candidates;
+		Vector<GUIElement*> gridHits;
+		Vector<GUIElement*> bruteForceHits;
+		UINT64 gridTime = 0;
+		UINT64 bruteForceTime = 0;
+
+		auto findHits = [&]()
+		{
+			widget->_updateLayout();
+
+			gridHits.clear();
+			bruteForceHits.clear();
+
+			Timer timer;
+			for (auto& position : positions)
+			{
+				candidates.clear();
+				widget->_findElementsAt(position, candidates);
+
+				for (auto& element : candidates)
+				{
+					if (element->_isInBounds(position))
+						gridHits.push_back(element);
+				}
+
+				gridHits.push_back(nullptr);
+			}
+			gridTime += timer.getMicroseconds();
+
+			timer.reset();
+			for (auto& position : positions)
+			{
+				for (auto& element : widget->getElements())
+				{
+					if (element->_isInBounds(position))
+						bruteForceHits.push_back(element);
+				}
+
+				bruteForceHits.push_back(nullptr);
+			}
+			bruteForceTime += timer.getMicroseconds();
+
+			return gridHits == bruteForceHits;
+		};
+
+		addElements(NUM_ELEMENTS);
+		BS_TEST_ASSERT(findHits());
+
+		// Register more elements
+		addElements(NUM_ELEMENTS / 4);
+		BS_TEST_ASSERT(findHits());
+
+		// Unregister some of the elements
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i += 3)
+			GUIElement::destroy(elements[i]);
+
+		BS_TEST_ASSERT(findHits());
+
+		// Move and resize the remaining elements
+		for (UINT32 i = 1; i < (UINT32)elements.size(); i += 3)
+		{
+			elements[i]->setPosition(std::rand() % WIDTH - 100, std::rand() % HEIGHT - 100);
+			elements[i]->setWidth(8 + std::rand() % 200);
+		}
+
+		BS_TEST_ASSERT(findHits());
+
+		// Clip the elements by shrinking and moving their parent panel
+		panel->setPosition(WIDTH / 4, HEIGHT / 8);
+		panel->setWidth(WIDTH / 2);
+		panel->setHeight(HEIGHT / 3);
+		BS_TEST_ASSERT(findHits());
+
+		LOGDBG("Finding elements at " + toString(NUM_QUERIES * 5) + " positions. Element grid: " + toString(gridTime) +
+			"us, all elements: " + toString(bruteForceTime) + "us.");
+
+		widget = nullptr;
+		camera->destroy();
+		renderTexture->destroy();
+	}
+
+	void EditorTestSuite::TestTextLayoutCache()
+	{
+		static const UINT32 FONT_SIZE = 10;
+		static const UINT32 NUM_QUERIES = 100000;
+
+		auto createChar = [](UINT32 charId, INT32 xAdvance)
+		{
+			CHAR_DESC desc;
+			desc.charId = charId;
+			desc.page = 0;
+			desc.uvX = desc.uvY = 0.0f;
+			desc.uvWidth = desc.uvHeight = 0.0f;
+			desc.width = (UINT32)xAdvance;
+			desc.height = 12;
+			desc.xOffset = desc.yOffset = 0;
+			desc.xAdvance = xAdvance;
+			desc.yAdvance = 0;
+
+			return desc;
+		};
+
+		SPtr<FontBitmap> searchedBitmap = bs_shared_ptr_new<FontBitmap>();
+		searchedBitmap->size = FONT_SIZE;
+		searchedBitmap->fontDesc.baselineOffset = 10;
+		searchedBitmap->fontDesc.lineHeight = 12;
+		searchedBitmap->fontDesc.spaceWidth = 4;
+		searchedBitmap->fontDesc.missingGlyph = createChar(0, 3);
+
+		// Printable ASCII characters with random kerning pairs, followed by one character at the end of the BMP and one
+		// outside of it
+		Vector<UINT32> charIds;
+		for (UINT32 i = 33; i < 127; i++)
+			charIds.push_back(i);
+
+		charIds.push_back(0x4E2D);
+		charIds.push_back(0x1F600);
+
+		for (auto& charId : charIds)
+		{
+			CHAR_DESC desc = createChar(charId, 5 + std::rand() % 5);
+
+			UINT32 numPairs = std::rand() % 4;
+			for (UINT32 i = 0; i < numPairs; i++)
+				desc.kerningPairs.push_back({ charIds[std::rand() % charIds.size()], 1 + std::rand() % 3 });
+
+			searchedBitmap->fontDesc.characters[charId] = desc;
+		}
+
+		// Duplicate pair, the first one should be used. Kerning for the opposite order is different so that the layouts
+		// of "AV" and "VA" have different widths.
+		CHAR_DESC& descA = searchedBitmap->fontDesc.characters['A'];
+		descA = createChar('A', 6);
+		descA.kerningPairs.push_back({ 'V', 2 });
+		descA.kerningPairs.push_back({ 'V', 5 });
+
+		CHAR_DESC& descV = searchedBitmap->fontDesc.characters['V'];
+		descV = createChar('V', 5);
+		descV.kerningPairs.push_back({ 'A', 1 });
+
+		SPtr<FontBitmap> tableBitmap = bs_shared_ptr_new<FontBitmap>(*searchedBitmap);
+		tableBitmap->_buildLookupTables();
+
+		BS_TEST_ASSERT(tableBitmap->getKerning('A', 'V') == 2);
+		BS_TEST_ASSERT(tableBitmap->getKerning('V', 'A') == 1);
+		BS_TEST_ASSERT(tableBitmap->getCharDesc(0x1F600).charId == 0x1F600);
+		BS_TEST_ASSERT(tableBitmap->getCharDesc(0x4E2E).charId == 0); // Past the end of the BMP table
+		BS_TEST_ASSERT(tableBitmap->getCharDesc(0x1F601).charId == 0); // Missing outside of the BMP
+		BS_TEST_ASSERT(tableBitmap->getCharDesc(' ').charId == 0); // Missing within the BMP table
+
+		// Query existing and missing characters, both within and outside of the BMP
+		Vector<std::pair<UINT32, UINT32>> queries(NUM_QUERIES);
+		for (auto& query : queries)
+		{
+			query.first = charIds[std::rand() % charIds.size()] + std::rand() % 2;
+			query.second = charIds[std::rand() % charIds.size()];
+		}
+
+		auto lookup = [&](const FontBitmap& bitmap, Vector<INT32>& output)
+		{
+			output.clear();
+			for (auto& query : queries)
+			{
+				output.push_back((INT32)bitmap.getCharDesc(query.first).charId);
+				output.push_back(bitmap.getCharDesc(query.first).xAdvance);
+				output.push_back(bitmap.getKerning(query.first, query.second));
+			}
+		};
+
+		Vector<INT32> searchedOutput;
+		Vector<INT32> tableOutput;
+
+		Timer timer;
+		lookup(*searchedBitmap, searchedOutput);
+		UINT64 searchTime = timer.getMicroseconds();
+
+		timer.reset();
+		lookup(*tableBitmap, tableOutput);
+		UINT64 tableTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(searchedOutput == tableOutput);
+
+		LOGDBG("Looking up " + toString(NUM_QUERIES) + " characters and kerning pairs. Lookup tables: " +
+			toString(tableTime) + "us, font description search: " + toString(searchTime) + "us.");
+
+		// Layout cache. "AV" is 13 pixels wide, "AVAV" 27, "VAVA" 26 and a space 4.
+		HFont font = Font::create({ tableBitmap });
+
+		UINT32 numHits, numMisses, numCollisions;
+		auto checkStats = [&](UINT32 expectedHits, UINT32 expectedMisses, UINT32 expectedCollisions)
+		{
+			UINT32 newHits, newMisses, newCollisions;
+			TextDataBase::_getLayoutCacheStats(newHits, newMisses, newCollisions);
+
+			bool matches = (newHits - numHits) == expectedHits && (newMisses - numMisses) == expectedMisses &&
+				(newCollisions - numCollisions) == expectedCollisions;
+
+			numHits = newHits;
+			numMisses = newMisses;
+			numCollisions = newCollisions;
+
+			return matches;
+		};
+
+		auto layoutsMatch = [](const TextDataBase& a, const TextDataBase& b)
+		{
+			if (a.getNumLines() != b.getNumLines() || a.getNumPages() != b.getNumPages())
+				return false;
+
+			for (UINT32 i = 0; i < a.getNumLines(); i++)
+			{
+				if (a.getLine(i).getNumChars() != b.getLine(i).getNumChars() ||
+					a.getLine(i).getWidth() != b.getLine(i).getWidth())
+					return false;
+			}
+
+			return a.getWidth() == b.getWidth() && a.getHeight() == b.getHeight();
+		};
+
+		TextDataBase::_getLayoutCacheStats(numHits, numMisses, numCollisions);
+
+		WString text = L"AV AVAV VAVA AV";
+		TextData<> first(text, font, FONT_SIZE, 30, 0, true);
+		BS_TEST_ASSERT(checkStats(0, 1, 0));
+
+		TextData<> second(text, font, FONT_SIZE, 30, 0, true);
+		BS_TEST_ASSERT(checkStats(1, 0, 0));
+		BS_TEST_ASSERT(layoutsMatch(first, second));
+
+		// Different width, and no word wrap
+		TextData<> wider(text, font, FONT_SIZE, 60, 0, true);
+		BS_TEST_ASSERT(checkStats(0, 1, 0));
+		BS_TEST_ASSERT(wider.getNumLines() < first.getNumLines());
+
+		TextData<> unwrapped(text, font, FONT_SIZE, 30, 0, false);
+		BS_TEST_ASSERT(checkStats(0, 1, 0));
+		BS_TEST_ASSERT(unwrapped.getNumLines() == 1);
+
+		// Force all layouts to share the same hash, so restoring a layout relies on the full parameter comparison
+		TextDataBase::_setLayoutHashMask(0);
+
+		TextData<> forward(L"AV", font, FONT_SIZE);
+		BS_TEST_ASSERT(checkStats(0, 1, 0));
+
+		TextData<> backward(L"VA", font, FONT_SIZE);
+		BS_TEST_ASSERT(checkStats(0, 1, 1));
+		BS_TEST_ASSERT(backward.getWidth() != forward.getWidth());
+
+		TextData<> backwardCached(L"VA", font, FONT_SIZE);
+		BS_TEST_ASSERT(checkStats(1, 0, 0));
+		BS_TEST_ASSERT(layoutsMatch(backward, backwardCached));
+
+		TextData<> forwardAgain(L"AV", font, FONT_SIZE);
+		BS_TEST_ASSERT(checkStats(0, 1, 1));
+		BS_TEST_ASSERT(layoutsMatch(forward, forwardAgain));
+
+		TextData<> forwardWrapped(L"AV", font, FONT_SIZE, 30, 0, true);
+		BS_TEST_ASSERT(checkStats(0, 1, 1));
+		BS_TEST_ASSERT(layoutsMatch(forward, forwardWrapped));
+
+		TextDataBase::_setLayoutHashMask((size_t)-1);
+
+		gResources().release(font);
+	}
+
+	void EditorTestSuite::TestDynamicFontAtlas()
+	{
+		// Glyphs occupy 6x6 cells with a pixel of padding, so each page fits a 3x3 grid of cells
+		static const UINT32 PAGE_SIZE = 22;
+		static const UINT32 NUM_PAGES = 2;
+		static const UINT32 NUM_CELLS_PER_PAGE = 9;
+		static const UINT32 FIRST_PAGE_IDX = 1;
+		static const UINT32 NUM_LOOKUPS = 100000;
+
+		SPtr<TestGlyphRasterizer> rasterizer = bs_shared_ptr_new<TestGlyphRasterizer>();
+		SPtr<DynamicFontAtlas> atlas = bs_shared_ptr_new<DynamicFontAtlas>(rasterizer, PAGE_SIZE, NUM_PAGES,
+			FIRST_PAGE_IDX);
+
+		// Characters used during the current frame are never evicted, so the test advances frames manually
+		auto nextFrame = []() { gTime()._update(); };
+
+		auto isResident = [](const CHAR_DESC* desc) { return desc != nullptr && desc->uvWidth > 0.0f; };
+
+		Vector<const CHAR_DESC*> chars;
+		auto cellsAreUnique = [&]()
+		{
+			Set<std::tuple<UINT32, float, float>> cells;
+			for (auto& desc : chars)
+			{
+				if (!isResident(desc))
+					continue;
+
+				if (!cells.insert(std::make_tuple(desc->page, desc->uvX, desc->uvY)).second)
+					return false;
+			}
+
+			return true;
+		};
+
+		// Fill the atlas
+		for (UINT32 i = 0; i < NUM_CELLS_PER_PAGE * NUM_PAGES; i++)
+		{
+			const CHAR_DESC* desc = atlas->getCharDesc(i);
+			BS_TEST_ASSERT(isResident(desc));
+			BS_TEST_ASSERT(desc->page == FIRST_PAGE_IDX + i / NUM_CELLS_PER_PAGE);
+
+			chars.push_back(desc);
+		}
+
+		BS_TEST_ASSERT(cellsAreUnique());
+		BS_TEST_ASSERT(rasterizer->numRenderedGlyphs == NUM_CELLS_PER_PAGE * NUM_PAGES);
+
+		// Resident characters aren't rendered again
+		BS_TEST_ASSERT(atlas->getCharDesc(0) == chars[0]);
+		BS_TEST_ASSERT(rasterizer->numRenderedGlyphs == NUM_CELLS_PER_PAGE * NUM_PAGES);
+
+		// Missing characters can't be pinned
+		BS_TEST_ASSERT(atlas->getCharDesc(TestGlyphRasterizer::NUM_CHARS) == nullptr);
+		BS_TEST_ASSERT(!atlas->pinChar(TestGlyphRasterizer::NUM_CHARS));
+		BS_TEST_ASSERT(!atlas->pinChar(TestGlyphRasterizer::NUM_CHARS - 1)); // Never requested
+
+		// Atlas is full of characters used this frame, so the new character is assigned a page but renders blank. All
+		// pages were last used during the same frame, so the first one is picked.
+		UINT32 overflowCharId = (UINT32)chars.size();
+		const CHAR_DESC* overflowChar = atlas->getCharDesc(overflowCharId);
+		BS_TEST_ASSERT(overflowChar != nullptr && !isResident(overflowChar));
+		BS_TEST_ASSERT(overflowChar->page == FIRST_PAGE_IDX);
+		chars.push_back(overflowChar);
+
+		// In the next frame the character is placed on its assigned page by evicting the least recently used character
+		// that isn't pinned. Nested pins are released only by the matching number of unpins.
+		nextFrame();
+		BS_TEST_ASSERT(atlas->pinChar(0));
+		BS_TEST_ASSERT(atlas->pinChar(0));
+		atlas->unpinChar(0);
+
+		BS_TEST_ASSERT(atlas->getCharDesc(overflowCharId) == overflowChar);
+		BS_TEST_ASSERT(isResident(overflowChar) && overflowChar->page == FIRST_PAGE_IDX);
+		BS_TEST_ASSERT(isResident(chars[0]));
+		BS_TEST_ASSERT(!isResident(chars[1]));
+		BS_TEST_ASSERT(cellsAreUnique());
+
+		// Evicted character is rendered again on its original page, evicting the next least recently used character
+		UINT32 numRenderedGlyphs = rasterizer->numRenderedGlyphs;
+		BS_TEST_ASSERT(atlas->getCharDesc(1) == chars[1]);
+		BS_TEST_ASSERT(isResident(chars[1]) && chars[1]->page == FIRST_PAGE_IDX);
+		BS_TEST_ASSERT(!isResident(chars[2]));
+		BS_TEST_ASSERT(rasterizer->numRenderedGlyphs == numRenderedGlyphs + 1);
+		BS_TEST_ASSERT(cellsAreUnique());
+
+		// Characters on a page where all characters are pinned are never evicted, so new characters go to other pages
+		Vector<UINT32> pinnedChars;
+		for (UINT32 i = 0; i < (UINT32)chars.size(); i++)
+		{
+			if (isResident(chars[i]) && chars[i]->page == FIRST_PAGE_IDX && i != 0)
+			{
+				BS_TEST_ASSERT(atlas->pinChar(i));
+				pinnedChars.push_back(i);
+			}
+		}
+
+		nextFrame();
+		UINT32 secondPageCharId = (UINT32)chars.size();
+		chars.push_back(atlas->getCharDesc(secondPageCharId));
+		BS_TEST_ASSERT(isResident(chars.back()) && chars.back()->page == FIRST_PAGE_IDX + 1);
+		BS_TEST_ASSERT(!isResident(chars[NUM_CELLS_PER_PAGE])); // Least recently used on the second page
+		BS_TEST_ASSERT(cellsAreUnique());
+
+		// Once every character is pinned the atlas is full, and new characters render blank until a cell is unpinned
+		for (UINT32 i = 0; i < (UINT32)chars.size(); i++)
+		{
+			if (isResident(chars[i]) && chars[i]->page == FIRST_PAGE_IDX + 1)
+			{
+				BS_TEST_ASSERT(atlas->pinChar(i));
+				pinnedChars.push_back(i);
+			}
+		}
+
+		nextFrame();
+		UINT32 blankCharId = (UINT32)chars.size();
+		chars.push_back(atlas->getCharDesc(blankCharId));
+		BS_TEST_ASSERT(chars.back() != nullptr && !isResident(chars.back()));
+
+		nextFrame();
+		BS_TEST_ASSERT(!isResident(atlas->getCharDesc(blankCharId)));
+
+		for (auto& charId : pinnedChars)
+			atlas->unpinChar(charId);
+
+		nextFrame();
+		BS_TEST_ASSERT(isResident(atlas->getCharDesc(blankCharId)));
+		BS_TEST_ASSERT(isResident(chars[0])); // Still pinned
+		BS_TEST_ASSERT(cellsAreUnique());
+
+		atlas->unpinChar(0);
+
+		// Kerning is queried from the rasterizer once per pair
+		BS_TEST_ASSERT(atlas->getKerning(3, 5) == rasterizer->getKerning(3, 5));
+		UINT32 numKerningQueries = rasterizer->numKerningQueries;
+		BS_TEST_ASSERT(atlas->getKerning(3, 5) == rasterizer->getKerning(3, 5));
+		BS_TEST_ASSERT(rasterizer->numKerningQueries == numKerningQueries + 1);
+
+		// Lookups of resident characters within a single frame, which neither render nor evict
+		Vector<UINT32> residentChars;
+		for (UINT32 i = 0; i < (UINT32)chars.size(); i++)
+		{
+			if (isResident(chars[i]))
+				residentChars.push_back(i);
+		}
+
+		numRenderedGlyphs = rasterizer->numRenderedGlyphs;
+
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_LOOKUPS; i++)
+			atlas->getCharDesc(residentChars[i % residentChars.size()]);
+
+		UINT64 lookupTime = timer.getMicroseconds();
+		BS_TEST_ASSERT(rasterizer->numRenderedGlyphs == numRenderedGlyphs);
+
+		LOGDBG("Looking up " + toString(NUM_LOOKUPS) + " characters in a dynamic font atlas: " + toString(lookupTime) +
+			"us.");
+
+		atlas->_updatePages();
+	}
+
+	void EditorTestSuite::TestPixelConversion()
+	{
+		static const UINT32 WIDTH = 512;
+		static const UINT32 HEIGHT = 512;
+
+		static const PixelFormat FORMAT_PAIRS[][2] =
+		{
+			{ PF_R8G8B8A8, PF_B8G8R8A8 },
+			{ PF_B8G8R8A8, PF_R8G8B8A8 },
+			{ PF_A8R8G8B8, PF_A8B8G8R8 },
+			{ PF_X8R8G8B8, PF_R8G8B8A8 },
+			{ PF_R8G8B8, PF_R8G8B8A8 },
+			{ PF_B8G8R8, PF_B8G8R8A8 },
+			{ PF_R8G8B8A8, PF_R8G8B8 },
+			{ PF_R8G8B8A8, PF_FLOAT32_RGBA },
+			{ PF_FLOAT32_RGBA, PF_R8G8B8A8 },
+			{ PF_FLOAT32_RGBA, PF_B8G8R8 },
+			{ PF_R8G8B8A8, PF_FLOAT16_RGBA },
+			{ PF_FLOAT16_RGBA, PF_R8G8B8A8 },
+		};
+
+		for (auto& formats : FORMAT_PAIRS)
+		{
+			PixelFormat srcFormat = formats[0];
+			PixelFormat dstFormat = formats[1];
+
+			SPtr<PixelData> src = PixelData::create(WIDTH, HEIGHT, 1, srcFormat);
+			SPtr<PixelData> expected = PixelData::create(WIDTH, HEIGHT, 1, dstFormat);
+			SPtr<PixelData> converted = PixelData::create(WIDTH, HEIGHT, 1, dstFormat);
+
+			// Include values outside of the [0, 1] range, to test clamping
+			UINT8* srcData = src->getData();
+			if (srcFormat == PF_FLOAT32_RGBA)
+			{
+				for (UINT32 i = 0; i < WIDTH * HEIGHT * 4; i++)
+					((float*)srcData)[i] = (std::rand() % 1500) * 0.001f - 0.25f;
+			}
+			else if (srcFormat == PF_FLOAT16_RGBA)
+			{
+				for (UINT32 i = 0; i < WIDTH * HEIGHT * 4; i++)
+					((UINT16*)srcData)[i] = Bitwise::floatToHalf((std::rand() % 1500) * 0.001f - 0.25f);
+			}
+			else
+			{
+				for (UINT32 i = 0; i < src->getConsecutiveSize(); i++)
+					srcData[i] = (UINT8)std::rand();
+			}
+
+			const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(srcFormat);
+			const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dstFormat);
+
+			Timer timer;
+			float r, g, b, a;
+			for (UINT32 i = 0; i < WIDTH * HEIGHT; i++)
+			{
+				PixelUtil::unpackColor(&r, &g, &b, &a, srcFormat, srcData + i * srcPixelSize);
+				PixelUtil::packColor(r, g, b, a, dstFormat, expected->getData() + i * dstPixelSize);
+			}
+			UINT64 genericTime = timer.getMicroseconds();
+
+			timer.reset();
+			PixelUtil::bulkPixelConversion(*src, *converted);
+			UINT64 bulkTime = timer.getMicroseconds();
+
+			BS_TEST_ASSERT(memcmp(expected->getData(), converted->getData(), expected->getConsecutiveSize()) == 0);
+
+			LOGDBG("Converting " + PixelUtil::getFormatName(srcFormat) + " to " + PixelUtil::getFormatName(dstFormat) +
+				". Per-pixel: " + toString(genericTime) + "us, bulk: " + toString(bulkTime) + "us.");
+		}
+	}
+
+	void EditorTestSuite::TestPhysicsDispatcher()
+	{
+		static const UINT32 NUM_STACKS_PER_AXIS = 25;
+		static const UINT32 STACK_HEIGHT = 16; // 10k bodies in total
+		static const UINT32 NUM_STEPS = 60;
+		static const float STEP = 1.0f / 60.0f;
+
+		UINT32 numBodies = NUM_STACKS_PER_AXIS * NUM_STACKS_PER_AXIS * STACK_HEIGHT;
+		UINT32 numDedicatedThreads = std::max(BS_THREAD_HARDWARE_CONCURRENCY, 2U) - 1;
+		UINT32 originalNumThreads = gPhysics().getNumSimulationThreads();
+
+		auto simulate = [&](UINT32 numThreads)
+		{
+			gPhysics().setNumSimulationThreads(numThreads);
+
+			HSceneObject root = SceneObject::create("root");
+
+			HSceneObject ground = SceneObject::create("ground");
+			ground->setParent(root);
+
+			HPlaneCollider groundCollider = ground->addComponent<CPlaneCollider>();
+			groundCollider->setNormal(Vector3::UNIT_Y);
+
+			// Stacks of boxes with small gaps, so they fall and settle on each other
+			HSceneObject topBody;
+			for (UINT32 x = 0; x < NUM_STACKS_PER_AXIS; x++)
+			{
+				for (UINT32 z = 0; z < NUM_STACKS_PER_AXIS; z++)
+				{
+					for (UINT32 y = 0; y < STACK_HEIGHT; y++)
+					{
+						HSceneObject body = SceneObject::create("body");
+						body->setParent(root);
+						body->setWorldPosition(Vector3(x * 2.0f, 0.6f + y * 1.1f, z * 2.0f));
+
+						body->addComponent<CRigidbody>();
+						HBoxCollider collider = body->addComponent<CBoxCollider>();
+						collider->setExtents(Vector3(0.5f, 0.5f, 0.5f));
+
+						topBody = body;
+					}
+				}
+			}
+
+			float startHeight = topBody->getWorldPosition().y;
+
+			Timer timer;
+			for (UINT32 i = 0; i < NUM_STEPS; i++)
+				gPhysics()._simulate(STEP);
+
+			UINT64 time = timer.getMicroseconds();
+
+			BS_TEST_ASSERT(topBody->getWorldPosition().y < startHeight);
+
+			root->destroy(true);
+			return time;
+		};
+
+		UINT64 schedulerTime = simulate(0);
+		UINT64 dedicatedTime = simulate(numDedicatedThreads);
+
+		gPhysics().setNumSimulationThreads(originalNumThreads);
+
+		LOGDBG("Simulating " + toString(numBodies) + " rigidbodies for " + toString(NUM_STEPS) + " steps. Task " + 
+			"scheduler: " + toString(schedulerTime) + "us, " + toString(numDedicatedThreads) + " dedicated threads: " + 
+			toString(dedicatedTime) + "us.");
+	}
+
+	void EditorTestSuite::TestPhysicsBatchQueries()
+	{
+		static const UINT32 NUM_BOXES_PER_AXIS = 32;
+		static const UINT32 NUM_QUERIES = 10000;
+
+		HSceneObject root = SceneObject::create("root");
+
+		// Grid of static boxes of varying heights, with gaps in between so some queries miss
+		for (UINT32 x = 0; x < NUM_BOXES_PER_AXIS; x++)
+		{
+			for (UINT32 z = 0; z < NUM_BOXES_PER_AXIS; z++)
+			{
+				HSceneObject box = SceneObject::create("box");
+				box->setParent(root);
+				box->setWorldPosition(Vector3(x * 2.0f, 0.0f, z * 2.0f));
+
+				HBoxCollider collider = box->addComponent<CBoxCollider>();
+				collider->setExtents(Vector3(0.5f, 1.0f + (x * 7 + z * 3) % 5, 0.5f));
+			}
+		}
+
+		Vector<PhysicsRayQuery> rays(NUM_QUERIES);
+		Vector<PhysicsSweepQuery> sweeps(NUM_QUERIES);
+		for (UINT32 i = 0; i < NUM_QUERIES; i++)
+		{
+			Vector3 origin((std::rand() % 6400) * 0.01f, 10.0f, (std::rand() % 6400) * 0.01f);
+
+			rays[i].origin = origin;
+			rays[i].unitDir = -Vector3::UNIT_Y;
+			rays[i].max = 20.0f;
+
+			sweeps[i].shape = PhysicsSweepShape::Sphere;
+			sweeps[i].position = origin;
+			sweeps[i].radius = 0.25f;
+			sweeps[i].unitDir = -Vector3::UNIT_Y;
+			sweeps[i].max = 20.0f;
+		}
+
+		Vector<PhysicsQueryHit> expectedHits(NUM_QUERIES);
+		Vector<bool> expectedWasHit(NUM_QUERIES);
+
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_QUERIES; i++)
+		{
+			expectedWasHit[i] = gPhysics().rayCast(rays[i].origin, rays[i].unitDir, expectedHits[i], rays[i].layer, 
+				rays[i].max);
+		}
+		UINT64 singleRayTime = timer.getMicroseconds();
+
+		Vector<PhysicsQueryHit> hits(NUM_QUERIES);
+		timer.reset();
+		UINT32 numHits = gPhysics().rayCastBatch(rays.data(), NUM_QUERIES, hits.data());
+		UINT64 batchRayTime = timer.getMicroseconds();
+
+		UINT32 numExpectedHits = 0;
+		for (UINT32 i = 0; i < NUM_QUERIES; i++)
+		{
+			BS_TEST_ASSERT(expectedWasHit[i] == (hits[i].colliderRaw != nullptr));
+
+			if (expectedWasHit[i])
+			{
+				BS_TEST_ASSERT(hits[i].colliderRaw == expectedHits[i].colliderRaw);
+				BS_TEST_ASSERT(Math::approxEquals(hits[i].distance, expectedHits[i].distance));
+
+				numExpectedHits++;
+			}
+		}
+
+		BS_TEST_ASSERT(numHits == numExpectedHits);
+
+		bool* anyHits = bs_newN<bool>(NUM_QUERIES);
+		gPhysics().rayCastAnyBatch(rays.data(), NUM_QUERIES, anyHits);
+		for (UINT32 i = 0; i < NUM_QUERIES; i++)
+			BS_TEST_ASSERT(anyHits[i] == expectedWasHit[i]);
+
+		bs_deleteN(anyHits, NUM_QUERIES);
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_QUERIES; i++)
+		{
+			Sphere sphere(sweeps[i].position, sweeps[i].radius);
+			expectedWasHit[i] = gPhysics().sphereCast(sphere, sweeps[i].unitDir, expectedHits[i], sweeps[i].layer, 
+				sweeps[i].max);
+		}
+		UINT64 singleSweepTime = timer.getMicroseconds();
+
+		timer.reset();
+		gPhysics().sweepBatch(sweeps.data(), NUM_QUERIES, hits.data());
+		UINT64 batchSweepTime = timer.getMicroseconds();
+
+		for (UINT32 i = 0; i < NUM_QUERIES; i++)
+		{
+			BS_TEST_ASSERT(expectedWasHit[i] == (hits[i].colliderRaw != nullptr));
+
+			if (expectedWasHit[i])
+				BS_TEST_ASSERT(Math::approxEquals(hits[i].distance, expectedHits[i].distance));
+		}
+
+		LOGDBG("Casting " + toString(NUM_QUERIES) + " rays. Individual: " + toString(singleRayTime) + "us, batched: " + 
+			toString(batchRayTime) + "us.");
+		LOGDBG("Sweeping " + toString(NUM_QUERIES) + " spheres. Individual: " + toString(singleSweepTime) + 
+			"us, batched: " + toString(batchSweepTime) + "us.");
+
+		root->destroy(true);
+	}
+
+	void EditorTestSuite::TestPhysicsAsyncSimulation()
+	{
+		static const UINT32 NUM_BODIES = 4;
+		static const UINT32 NUM_FRAMES = 120;
+		static const UINT32 NUM_WARMUP_FRAMES = 8;
+		static const float POSITION_TOLERANCE = 0.001f;
+		static const float ROTATION_TOLERANCE = 0.0001f;
+		static const float STEP_TOLERANCE = 0.01f;
+
+		float step = gPhysics()._getSimulationStep();
+		float frameDelta = step * 0.75f; // Mix of frames that start a step and frames that don't
+		UINT32 numSteps = Math::ceilToInt(NUM_FRAMES * frameDelta / step) + 2;
+		bool wasAsync = gPhysics().hasFlag(PhysicsFlag::AsyncSimulation);
+
+		// Spheres thrown sideways at different speeds, landing on the ground and rolling along it
+		auto createScene = [&](Vector<HSceneObject>& bodies)
+		{
+			HSceneObject root = SceneObject::create("root");
+
+			HSceneObject ground = SceneObject::create("ground");
+			ground->setParent(root);
+
+			HPlaneCollider groundCollider = ground->addComponent<CPlaneCollider>();
+			groundCollider->setNormal(Vector3::UNIT_Y);
+
+			bodies.clear();
+			for (UINT32 i = 0; i < NUM_BODIES; i++)
+			{
+				HSceneObject body = SceneObject::create("body");
+				body->setParent(root);
+				body->setWorldPosition(Vector3(0.0f, 1.0f + i * 0.5f, i * 3.0f));
+
+				HRigidbody rigidbody = body->addComponent<CRigidbody>();
+				HSphereCollider collider = body->addComponent<CSphereCollider>();
+				collider->setRadius(0.5f);
+
+				rigidbody->setVelocity(Vector3(2.0f + i, 0.0f, 0.0f));
+				bodies.push_back(body);
+			}
+
+			return root;
+		};
+
+		// Reference trajectories, recorded by synchronously simulating one step at a time, starting pose first
+		gPhysics().setFlag(PhysicsFlag::AsyncSimulation, false);
+
+		Vector<HSceneObject> bodies;
+		HSceneObject root = createScene(bodies);
+
+		Vector<Vector3> positions((numSteps + 1) * NUM_BODIES);
+		Vector<Quaternion> rotations((numSteps + 1) * NUM_BODIES);
+		for (UINT32 i = 0; i <= numSteps; i++)
+		{
+			if (i > 0)
+				gPhysics()._simulate(step);
+
+			for (UINT32 j = 0; j < NUM_BODIES; j++)
+			{
+				positions[i * NUM_BODIES + j] = bodies[j]->getWorldPosition();
+				rotations[i * NUM_BODIES + j] = bodies[j]->getWorldRotation();
+			}
+		}
+
+		root->destroy(true);
+
+		// Finds the point on the reference trajectory of a body closest to the provided position, as a fractional
+		// number of steps
+		auto findOnTrajectory = [&](UINT32 bodyIdx, const Vector3& position, float& distance)
+		{
+			float closest = 0.0f;
+			distance = std::numeric_limits<float>::max();
+			for (UINT32 i = 0; i < numSteps; i++)
+			{
+				const Vector3& start = positions[i * NUM_BODIES + bodyIdx];
+				Vector3 diff = positions[(i + 1) * NUM_BODIES + bodyIdx] - start;
+
+				float length2 = diff.squaredLength();
+				float t = length2 > 0.0f ? Math::clamp01(diff.dot(position - start) / length2) : 0.0f;
+
+				float curDistance = (start + diff * t - position).length();
+				if (curDistance < distance)
+				{
+					distance = curDistance;
+					closest = i + t;
+				}
+			}
+
+			return closest;
+		};
+
+		auto rotationMatches = [&](UINT32 bodyIdx, float stepIdx)
+		{
+			UINT32 start = std::min((UINT32)stepIdx, numSteps - 1);
+			float t = stepIdx - start;
+
+			Quaternion expected = Quaternion::slerp(t, rotations[start * NUM_BODIES + bodyIdx],
+				rotations[(start + 1) * NUM_BODIES + bodyIdx]);
+
+			return std::abs(expected.dot(bodies[bodyIdx]->getWorldRotation())) > (1.0f - ROTATION_TOLERANCE);
+		};
+
+		// Same scene, driven frame by frame with the simulation running asynchronously. A character controller is moved
+		// on every frame in the second half, while the step started at the end of the previous frame is running.
+		root = createScene(bodies);
+		gPhysics().setFlag(PhysicsFlag::AsyncSimulation, true);
+
+		SPtr<CharacterController> controller;
+		float firstDisplayed = 0.0f;
+		float lastDisplayed = 0.0f;
+		UINT64 asyncTime = 0;
+		for (UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			if (i == NUM_FRAMES / 2)
+			{
+				CHAR_CONTROLLER_DESC desc;
+				desc.position = Vector3(0.0f, 2.0f, -10.0f);
+
+				controller = CharacterController::create(desc);
+			}
+
+			if (controller != nullptr)
+			{
+				CharacterCollisionFlags collisionFlags = controller->move(Vector3(0.0f, -3.0f, 0.0f));
+				BS_TEST_ASSERT(collisionFlags.isSet(CharacterCollisionFlag::Down));
+			}
+
+			Timer timer;
+			gPhysics()._update(frameDelta);
+			asyncTime += timer.getMicroseconds();
+
+			// Displayed poses must lie on the reference trajectories, all at the same point in time, advancing by the
+			// frame delta each frame
+			if (i >= NUM_WARMUP_FRAMES)
+			{
+				for (UINT32 j = 0; j < NUM_BODIES; j++)
+				{
+					float distance;
+					float displayed = findOnTrajectory(j, bodies[j]->getWorldPosition(), distance);
+
+					BS_TEST_ASSERT(distance < POSITION_TOLERANCE);
+					BS_TEST_ASSERT(rotationMatches(j, displayed));
+
+					if (i == NUM_WARMUP_FRAMES && j == 0)
+						firstDisplayed = displayed;
+
+					float expected = firstDisplayed + (i - NUM_WARMUP_FRAMES) * frameDelta / step;
+					BS_TEST_ASSERT(Math::approxEquals(displayed, expected, STEP_TOLERANCE));
+
+					if (j == 0)
+						lastDisplayed = displayed;
+				}
+			}
+
+			timer.reset();
+			gPhysics()._startAsyncStep();
+			asyncTime += timer.getMicroseconds();
+		}
+
+		// Disabling async simulation completes the last started step, after which the state must match the reference
+		controller = nullptr;
+		gPhysics().setFlag(PhysicsFlag::AsyncSimulation, false);
+
+		float distance;
+		float lastStep = (float)Math::roundToInt(findOnTrajectory(0, bodies[0]->getWorldPosition(), distance));
+		for (UINT32 j = 0; j < NUM_BODIES; j++)
+		{
+			Vector3 expected = positions[(UINT32)lastStep * NUM_BODIES + j];
+
+			BS_TEST_ASSERT((bodies[j]->getWorldPosition() - expected).length() < POSITION_TOLERANCE);
+			BS_TEST_ASSERT(rotationMatches(j, lastStep));
+		}
+
+		// Last displayed poses must have been between one and two steps behind the last simulated step
+		float displayDelay = lastStep - lastDisplayed;
+		BS_TEST_ASSERT(displayDelay > (1.0f - STEP_TOLERANCE) && displayDelay < (2.0f + STEP_TOLERANCE));
+
+		root->destroy(true);
+		gPhysics().setFlag(PhysicsFlag::AsyncSimulation, wasAsync);
+
+		LOGDBG("Simulating " + toString(NUM_FRAMES) + " frames asynchronously. Time spent in physics calls: " + 
+			toString(asyncTime) + "us, displayed " + toString(displayDelay) + " steps behind the last simulated step.");
+	}
+
+	void EditorTestSuite::TestBulkTransformUpdate()
+	{
+		static const UINT32 NUM_OBJECTS = 8192;
+		static const UINT32 NESTED_INTERVAL = 16;
+
+		// Two identical hierarchies, one updated object by object and the other in bulk. Some of the objects have a
+		// child that is updated as well.
+		HSceneObject roots[2];
+		Vector<HSceneObject> objects[2];
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			roots[i] = SceneObject::create("root");
+			roots[i]->setPosition(Vector3(5.0f, 0.0f, -3.0f));
+			roots[i]->setRotation(Quaternion(Degree(0.0f), Degree(30.0f), Degree(0.0f)));
+			roots[i]->setScale(Vector3(2.0f, 2.0f, 2.0f));
+
+			for (UINT32 j = 0; j < NUM_OBJECTS; j++)
+			{
+				HSceneObject parent = roots[i];
+				if ((j % NESTED_INTERVAL) == 1)
+					parent = objects[i][j - 1];
+
+				HSceneObject so = SceneObject::create("object");
+				so->setParent(parent, false);
+				so->setPosition(Vector3((float)j, 0.0f, 0.0f));
+
+				objects[i].push_back(so);
+			}
+		}
+
+		Vector<Vector3> positions(NUM_OBJECTS);
+		Vector<Quaternion> rotations(NUM_OBJECTS);
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			positions[i] = Vector3((std::rand() % 1000) * 0.1f, (std::rand() % 1000) * 0.1f, 
+				(std::rand() % 1000) * 0.1f);
+			rotations[i] = Quaternion(Degree((float)(std::rand() % 360)), Degree((float)(std::rand() % 360)), 
+				Degree(0.0f));
+		}
+
+		// Parents before children, so children end up where requested
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			objects[0][i]->setWorldPosition(positions[i]);
+			objects[0][i]->setWorldRotation(rotations[i]);
+		}
+		UINT64 individualTime = timer.getMicroseconds();
+
+		// Children before parents, bulk update should handle the ordering itself
+		Vector<SceneObjectTransformUpdate> updates(NUM_OBJECTS);
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			UINT32 idx = NUM_OBJECTS - i - 1;
+			updates[i] = { objects[1][idx].get(), positions[idx], rotations[idx] };
+		}
+
+		timer.reset();
+		SceneObject::_setWorldTransforms(updates.data(), NUM_OBJECTS, true);
+		UINT64 bulkTime = timer.getMicroseconds();
+
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			Vector3 diff = objects[1][i]->getWorldPosition() - objects[0][i]->getWorldPosition();
+			BS_TEST_ASSERT(diff.length() < 0.001f);
+			float rotDot = objects[1][i]->getWorldRotation().dot(objects[0][i]->getWorldRotation());
+			BS_TEST_ASSERT(Math::abs(rotDot) > 0.9999f);
+		}
+
+		LOGDBG("Moving " + toString(NUM_OBJECTS) + " scene objects. Individual: " + toString(individualTime) + 
+			"us, bulk: " + toString(bulkTime) + "us.");
+
+		roots[0]->destroy(true);
+		roots[1]->destroy(true);
+	}
+
+	void EditorTestSuite::TestAudioMixer()
+	{
+		static const UINT32 SAMPLE_RATE = 48000;
+		static const UINT32 CLIP_RATE = 44100;
+		static const UINT32 NUM_VOICES = 4096;
+		static const UINT32 MAX_VOICES = 32;
+
+		/** Sink that keeps everything written to it. */
+		class CaptureAudioSink : public AudioSink
+		{
+		public:
+			void write(const float* samples, UINT32 numFrames) override
+			{
+				output.insert(output.end(), samples, samples + numFrames * 2);
+			}
+
+			Vector<float> output;
+		};
+
+		// One second of a 440Hz sine wave
+		Vector<float> clip(CLIP_RATE);
+		for (UINT32 i = 0; i < CLIP_RATE; i++)
+			clip[i] = Math::sin(Radian(Math::TWO_PI * 440.0f * i / (float)CLIP_RATE)) * 0.5f;
+
+		// Non-spatial mono voice at the mixer sample rate should come out unchanged, apart from the center pan, once the
+		// gain ramp of the first block is done
+		{
+			AudioMixerVoice voice;
+			voice.samples = clip.data();
+			voice.numFrames = CLIP_RATE;
+			voice.sampleRate = SAMPLE_RATE;
+			voice.is3D = false;
+			voice.playing = true;
+
+			SPtr<CaptureAudioSink> sink = bs_shared_ptr_new<CaptureAudioSink>();
+			AudioMixer mixer(SAMPLE_RATE);
+			mixer.setSink(sink);
+
+			AudioMixerVoice* voicePtr = &voice;
+			mixer.mix(&voicePtr, 1, nullptr, 0, AudioMixer::BLOCK_SIZE * 4 + 7);
+
+			BS_TEST_ASSERT(sink->output.size() == (AudioMixer::BLOCK_SIZE * 4 + 7) * 2);
+			for (UINT32 i = AudioMixer::BLOCK_SIZE; i < AudioMixer::BLOCK_SIZE * 4 + 7; i++)
+			{
+				float expected = clip[i] * std::sqrt(0.5f);
+				BS_TEST_ASSERT(Math::abs(sink->output[i * 2 + 0] - expected) < 0.0001f);
+				BS_TEST_ASSERT(Math::abs(sink->output[i * 2 + 1] - expected) < 0.0001f);
+			}
+
+			// Voice that stops being heard should fade out over a block, rather than being cut off
+			sink->output.clear();
+			mixer.setMaxVoices(0);
+			mixer.mix(&voicePtr, 1, nullptr, 0, AudioMixer::BLOCK_SIZE * 2);
+
+			BS_TEST_ASSERT(voice.isVirtual);
+			BS_TEST_ASSERT(Math::abs(sink->output[2]) > 0.0f);
+			for (UINT32 i = AudioMixer::BLOCK_SIZE - 1; i < AudioMixer::BLOCK_SIZE * 2; i++)
+				BS_TEST_ASSERT(Math::abs(sink->output[i * 2]) < 0.01f);
+		}
+
+		// Many looping spatial voices around the listener, with a resampling step
+		Vector<AudioMixerVoice> voices(NUM_VOICES);
+		Vector<AudioMixerVoice*> voicePtrs(NUM_VOICES);
+		for (UINT32 i = 0; i < NUM_VOICES; i++)
+		{
+			AudioMixerVoice& voice = voices[i];
+			voice.samples = clip.data();
+			voice.numFrames = CLIP_RATE;
+			voice.sampleRate = CLIP_RATE;
+			voice.position = Vector3((std::rand() % 2000) * 0.1f - 100.0f, 0.0f, (std::rand() % 2000) * 0.1f - 100.0f);
+			voice.priority = std::rand() % 4;
+			voice.loop = true;
+			voice.playing = true;
+
+			voicePtrs[i] = &voice;
+		}
+
+		Vector<AudioMixerVoice> unlimitedVoices = voices;
+		Vector<AudioMixerVoice*> unlimitedVoicePtrs(NUM_VOICES);
+		for (UINT32 i = 0; i < NUM_VOICES; i++)
+			unlimitedVoicePtrs[i] = &unlimitedVoices[i];
+
+		SPtr<NullAudioSink> sink = bs_shared_ptr_new<NullAudioSink>();
+		AudioMixer mixer(SAMPLE_RATE, MAX_VOICES);
+		mixer.setSink(sink);
+
+		Timer timer;
+		mixer.mix(voicePtrs.data(), NUM_VOICES, nullptr, 0, SAMPLE_RATE);
+		UINT64 limitedTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(sink->getNumFrames() == SAMPLE_RATE);
+		BS_TEST_ASSERT(mixer.getNumAudibleVoices() <= MAX_VOICES);
+
+		// Virtual voices must keep playing in sync with the audible ones
+		UINT32 numVirtual = 0;
+		for (UINT32 i = 0; i < NUM_VOICES; i++)
+		{
+			BS_TEST_ASSERT(voices[i].playing);
+			BS_TEST_ASSERT(Math::abs((float)(voices[i].playPosition - voices[0].playPosition)) < 0.01f);
+
+			if (voices[i].isVirtual)
+				numVirtual++;
+		}
+
+		BS_TEST_ASSERT(numVirtual >= NUM_VOICES - MAX_VOICES);
+
+		AudioMixer unlimitedMixer(SAMPLE_RATE, NUM_VOICES);
+		unlimitedMixer.setSink(bs_shared_ptr_new<NullAudioSink>());
+
+		timer.reset();
+		unlimitedMixer.mix(unlimitedVoicePtrs.data(), NUM_VOICES, nullptr, 0, SAMPLE_RATE);
+		UINT64 unlimitedTime = timer.getMicroseconds();
+
+		LOGDBG("Mixing one second of " + toString(NUM_VOICES) + " voices. Limited to " + toString(MAX_VOICES) + 
+			" voices: " + toString(limitedTime) + "us, unlimited: " + toString(unlimitedTime) + "us.");
+	}
+
+	void EditorTestSuite::TestTexAtlasPacking()
+	{
+		static const UINT32 NUM_SETS = 6;
+		static const UINT32 NUM_ELEMENTS = 1500;
+		static const UINT32 PAGE_SIZE = 512;
+		static const float OCCUPANCY_TOLERANCE = 0.01f;
+
+		// Fixed seed so the compared occupancies don't depend on what other tests did with std::rand()
+		std::mt19937 generator(1337);
+		auto random = [&](UINT32 min, UINT32 max)
+		{
+			return std::uniform_int_distribution<UINT32>(min, max)(generator);
+		};
+
+		TexAtlasHeuristic heuristics[] = { TexAtlasHeuristic::BestShortSideFit, TexAtlasHeuristic::BestLongSideFit,
+			TexAtlasHeuristic::BestAreaFit, TexAtlasHeuristic::BottomLeft, TexAtlasHeuristic::ContactPoint };
+		static const UINT32 NUM_HEURISTICS = sizeof(heuristics) / sizeof(heuristics[0]);
+
+		// Checks that all elements are placed within their pages and don't overlap
+		auto validate = [](const Vector<TexAtlasElementDesc>& elements, const Vector<TexAtlasPageDesc>& pages)
+		{
+			for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+			{
+				const TexAtlasElementDesc& a = elements[i];
+				if (a.output.page < 0 || a.output.page >= (INT32)pages.size())
+					return false;
+
+				const TexAtlasPageDesc& page = pages[a.output.page];
+				if (a.output.x + a.input.width > page.width || a.output.y + a.input.height > page.height)
+					return false;
+
+				for (UINT32 j = i + 1; j < (UINT32)elements.size(); j++)
+				{
+					const TexAtlasElementDesc& b = elements[j];
+					if (a.output.page != b.output.page)
+						continue;
+
+					if (a.output.x < b.output.x + b.input.width && b.output.x < a.output.x + a.input.width &&
+						a.output.y < b.output.y + b.input.height && b.output.y < a.output.y + a.input.height)
+						return false;
+				}
+			}
+
+			return true;
+		};
+
+		// Every set spans multiple pages. Occupancy of the first page is compared, as it is the only page packed from 
+		// the same elements by all methods, and the only one guaranteed to be full.
+		float binaryTreeOccupancy = 0.0f;
+		float skylineOccupancy = 0.0f;
+		float maxRectsOccupancy[NUM_HEURISTICS] = { };
+
+		UINT64 binaryTreeTime = 0;
+		UINT64 skylineTime = 0;
+		UINT64 maxRectsTime = 0;
+		for (UINT32 i = 0; i < NUM_SETS; i++)
+		{
+			// Alternate between elements of random sizes, glyph-like elements of similar heights, and thin elements
+			Vector<TexAtlasElementDesc> elements(NUM_ELEMENTS);
+			for (auto& element : elements)
+			{
+				switch (i % 3)
+				{
+				case 0:
+					element.input.width = random(1, 64);
+					element.input.height = random(1, 64);
+					break;
+				case 1:
+					element.input.width = random(6, 29);
+					element.input.height = random(24, 35);
+					break;
+				case 2:
+					element.input.width = random(40, 119);
+					element.input.height = random(2, 11);
+
+					if (random(0, 1))
+						std::swap(element.input.width, element.input.height);
+					break;
+				}
+			}
+
+			Timer timer;
+			Vector<TexAtlasElementDesc> binaryTreeElements = elements;
+			TexAtlasGenerator binaryTreeGen(false, PAGE_SIZE, PAGE_SIZE, true, TexAtlasPackMethod::BinaryTree);
+			Vector<TexAtlasPageDesc> binaryTreePages = binaryTreeGen.createAtlasLayout(binaryTreeElements);
+			binaryTreeTime += timer.getMicroseconds();
+
+			BS_TEST_ASSERT(validate(binaryTreeElements, binaryTreePages));
+			binaryTreeOccupancy += binaryTreePages[0].occupancy;
+
+			timer.reset();
+			Vector<TexAtlasElementDesc> skylineElements = elements;
+			TexAtlasGenerator skylineGen(false, PAGE_SIZE, PAGE_SIZE, true, TexAtlasPackMethod::Skyline,
+				TexAtlasHeuristic::BottomLeft);
+			Vector<TexAtlasPageDesc> skylinePages = skylineGen.createAtlasLayout(skylineElements);
+			skylineTime += timer.getMicroseconds();
+
+			BS_TEST_ASSERT(validate(skylineElements, skylinePages));
+			skylineOccupancy += skylinePages[0].occupancy;
+
+			for (UINT32 j = 0; j < NUM_HEURISTICS; j++)
+			{
+				timer.reset();
+				Vector<TexAtlasElementDesc> maxRectsElements = elements;
+				TexAtlasGenerator maxRectsGen(false, PAGE_SIZE, PAGE_SIZE, true, TexAtlasPackMethod::MaxRects, 
+					heuristics[j]);
+				Vector<TexAtlasPageDesc> maxRectsPages = maxRectsGen.createAtlasLayout(maxRectsElements);
+
+				if (heuristics[j] == TexAtlasHeuristic::BestShortSideFit)
+					maxRectsTime += timer.getMicroseconds();
+
+				BS_TEST_ASSERT(validate(maxRectsElements, maxRectsPages));
+				maxRectsOccupancy[j] += maxRectsPages[0].occupancy;
+			}
+		}
+
+		// Compared as averages, within a tolerance, so small differences between packers don't fail the test
+		BS_TEST_ASSERT(skylineOccupancy / NUM_SETS + OCCUPANCY_TOLERANCE >= binaryTreeOccupancy / NUM_SETS);
+		for (UINT32 i = 0; i < NUM_HEURISTICS; i++)
+			BS_TEST_ASSERT(maxRectsOccupancy[i] / NUM_SETS + OCCUPANCY_TOLERANCE >= binaryTreeOccupancy / NUM_SETS);
+
+		LOGDBG("Packing " + toString(NUM_SETS) + " sets of " + toString(NUM_ELEMENTS) + " elements. Average occupancy: " +
+			"binary tree " + toString(binaryTreeOccupancy / NUM_SETS) + ", skyline " + 
+			toString(skylineOccupancy / NUM_SETS) + ", max rects " + toString(maxRectsOccupancy[0] / NUM_SETS) + 
+			". Binary tree: " + toString(binaryTreeTime) + "us, skyline: " + toString(skylineTime) + "us, max rects: " + 
+			toString(maxRectsTime) + "us.");
+	}
+
+	void EditorTestSuite::TestMipmapGeneration()
+	{
+		static const MipMapFilter FILTERS[] = 
+			{ MipMapFilter::Box, MipMapFilter::Triangle, MipMapFilter::Kaiser, MipMapFilter::Lanczos };
+		static const MipMapWrapMode WRAP_MODES[] = 
+			{ MipMapWrapMode::Mirror, MipMapWrapMode::Repeat, MipMapWrapMode::Clamp };
+
+		// Box filter must average each 2x2 block of a known pattern exactly
+		{
+			SPtr<PixelData> src = PixelData::create(4, 4, 1, PF_FLOAT32_RGBA);
+			for (UINT32 y = 0; y < 4; y++)
+			{
+				for (UINT32 x = 0; x < 4; x++)
+					src->setColorAt(Color(x * 0.25f, y * 0.25f, (x + y * 4) / 16.0f, 1.0f), x, y);
+			}
+
+			MipMapGenOptions options;
+			options.filter = MipMapFilter::Box;
+
+			Vector<SPtr<PixelData>> mips = PixelUtil::genMipmaps(*src, options);
+			BS_TEST_ASSERT(mips.size() == 3);
+
+			SPtr<PixelData> level = mips[1];
+			BS_TEST_ASSERT(level->getWidth() == 2 && level->getHeight() == 2);
+
+			for (UINT32 y = 0; y < 2; y++)
+			{
+				for (UINT32 x = 0; x < 2; x++)
+				{
+					Color expected = (src->getColorAt(x * 2, y * 2) + src->getColorAt(x * 2 + 1, y * 2) +
+						src->getColorAt(x * 2, y * 2 + 1) + src->getColorAt(x * 2 + 1, y * 2 + 1)) * 0.25f;
+
+					Color actual = level->getColorAt(x, y);
+					for (UINT32 i = 0; i < 4; i++)
+						BS_TEST_ASSERT(Math::abs(actual[i] - expected[i]) < 0.0001f);
+				}
+			}
+		}
+
+		// Constant image must stay constant for every filter and wrap mode, and NPOT levels must halve rounding down
+		{
+			static const UINT32 WIDTH = 37;
+			static const UINT32 HEIGHT = 23;
+			const Color constant(0.2f, 0.4f, 0.6f, 0.8f);
+
+			SPtr<PixelData> src = PixelData::create(WIDTH, HEIGHT, 1, PF_FLOAT32_RGBA);
+			for (UINT32 y = 0; y < HEIGHT; y++)
+			{
+				for (UINT32 x = 0; x < WIDTH; x++)
+					src->setColorAt(constant, x, y);
+			}
+
+			for (auto& filter : FILTERS)
+			{
+				for (auto& wrapMode : WRAP_MODES)
+				{
+					MipMapGenOptions options;
+					options.filter = filter;
+					options.wrapMode = wrapMode;
+
+					Timer timer;
+					Vector<SPtr<PixelData>> mips = PixelUtil::genMipmaps(*src, options);
+					UINT64 time = timer.getMicroseconds();
+
+					BS_TEST_ASSERT(mips.size() == PixelUtil::getMaxMipmaps(WIDTH, HEIGHT, 1, PF_FLOAT32_RGBA) + 1);
+
+					UINT32 width = WIDTH;
+					UINT32 height = HEIGHT;
+					for (UINT32 i = 0; i < (UINT32)mips.size(); i++)
+					{
+						BS_TEST_ASSERT(mips[i]->getWidth() == width && mips[i]->getHeight() == height);
+
+						for (UINT32 y = 0; y < height; y++)
+						{
+							for (UINT32 x = 0; x < width; x++)
+							{
+								Color color = mips[i]->getColorAt(x, y);
+								for (UINT32 j = 0; j < 4; j++)
+									BS_TEST_ASSERT(Math::abs(color[j] - constant[j]) < 0.001f);
+							}
+						}
+
+						width = std::max(1U, width / 2);
+						height = std::max(1U, height / 2);
+					}
+
+					BS_TEST_ASSERT(mips.back()->getWidth() == 1 && mips.back()->getHeight() == 1);
+
+					LOGDBG("Generating mipmaps with filter " + toString((UINT32)filter) + " and wrap mode " + 
+						toString((UINT32)wrapMode) + ": " + toString(time) + "us.");
+				}
+			}
+		}
+
+		// Fraction of pixels passing the alpha test must stay close to the base level's
+		{
+			static const UINT32 SIZE = 128;
+			static const float CUTOFF = 0.7f;
+			static const float TOLERANCE = 0.03f;
+
+			SPtr<PixelData> src = PixelData::create(SIZE, SIZE, 1, PF_R8G8B8A8);
+			for (UINT32 y = 0; y < SIZE; y++)
+			{
+				for (UINT32 x = 0; x < SIZE; x++)
+				{
+					float alpha = 0.5f + 0.5f * Math::sin(x * 0.1f) * Math::sin(y * 0.07f);
+					src->setColorAt(Color(1.0f, 1.0f, 1.0f, alpha), x, y);
+				}
+			}
+
+			auto getCoverage = [&](const PixelData& data)
+			{
+				UINT32 numPassing = 0;
+				for (UINT32 y = 0; y < data.getHeight(); y++)
+				{
+					for (UINT32 x = 0; x < data.getWidth(); x++)
+					{
+						if (data.getColorAt(x, y).a > CUTOFF)
+							numPassing++;
+					}
+				}
+
+				return numPassing / (float)(data.getWidth() * data.getHeight());
+			};
+
+			float baseCoverage = getCoverage(*src);
+			for (auto& filter : FILTERS)
+			{
+				MipMapGenOptions options;
+				options.filter = filter;
+				options.preserveAlphaCoverage = true;
+				options.alphaCoverageCutoff = CUTOFF;
+
+				Vector<SPtr<PixelData>> mips = PixelUtil::genMipmaps(*src, options);
+
+				// Small levels don't have enough pixels to represent the coverage accurately
+				for (auto& mip : mips)
+				{
+					if (mip->getWidth() * mip->getHeight() < 64)
+						break;
+
+					BS_TEST_ASSERT(Math::abs(getCoverage(*mip) - baseCoverage) < TOLERANCE);
+				}
+			}
+		}
+	}
+
+	void EditorTestSuite::TestResourcePackage()
+	{
+		static const UINT32 NUM_RESOURCES = 32;
+
+		Vector<String> uuids(NUM_RESOURCES);
+		Vector<WString> contents(NUM_RESOURCES);
+		Vector<Path> filePaths(NUM_RESOURCES);
+		Vector<RESOURCE_PACKAGE_ENTRY_DESC> entries(NUM_RESOURCES);
+
+		for (UINT32 i = 0; i < NUM_RESOURCES; i++)
+		{
+			// Varying lengths, so some entries span multiple alignment blocks
+			WString content = L"Packaged resource " + toWString(i) + L": ";
+			UINT32 length = (UINT32)(std::rand() % 8192);
+			for (UINT32 j = 0; j < length; j++)
+				content += (wchar_t)(L'a' + std::rand() % 26);
+
+			filePaths[i] = Path::combine(FileSystem::getTempDirectoryPath(), "testpackage" + toString(i) + ".asset");
+
+			// Created resource is unloaded once the handle goes out of scope
+			HPlainText text = PlainText::create(content);
+			gResources().save(text, filePaths[i], true);
+
+			uuids[i] = text.getUUID();
+			contents[i] = content;
+
+			entries[i].uuid = uuids[i];
+			entries[i].filePath = filePaths[i];
+		}
+
+		Path packagePath = Path::combine(FileSystem::getTempDirectoryPath(), "testpackage.pack");
+
+		Timer timer;
+		BS_TEST_ASSERT(ResourcePackage::create(entries, packagePath));
+		UINT64 createTime = timer.getMicroseconds();
+
+		// Remove the individual files, so the resources can only be read from the package
+		for (auto& entry : filePaths)
+			FileSystem::remove(entry);
+
+		SPtr<ResourcePackage> package = ResourcePackage::load(packagePath);
+		BS_TEST_ASSERT(package != nullptr);
+		if (package == nullptr)
+			return;
+
+		BS_TEST_ASSERT(package->getNumEntries() == NUM_RESOURCES);
+		BS_TEST_ASSERT(!package->contains(UUIDGenerator::generateRandom()));
+
+		gResources().registerResourcePackage(package);
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_RESOURCES; i++)
+		{
+			BS_TEST_ASSERT(package->contains(uuids[i]));
+			BS_TEST_ASSERT(!gResources().isLoaded(uuids[i]));
+
+			// Load half by UUID and half by path. Paths are resolved to a UUID through the manifest, and then found in
+			// the package.
+			HPlainText text;
+			if (i % 2 == 0)
+				text = static_resource_cast<PlainText>(gResources().loadFromUUID(uuids[i]));
+			else
+				text = static_resource_cast<PlainText>(gResources().load(filePaths[i]));
+
+			BS_TEST_ASSERT(text.isLoaded());
+			if (!text.isLoaded())
+				continue;
+
+			BS_TEST_ASSERT(text.getUUID() == uuids[i]);
+			BS_TEST_ASSERT(text->getString() == contents[i]);
+
+			gResources().release(text);
+		}
+		UINT64 loadTime = timer.getMicroseconds();
+
+		gResources().unregisterResourcePackage(package);
+
+		// Package keeps the file mapped, so release it before removing the file
+		package = nullptr;
+		FileSystem::remove(packagePath);
+
+		LOGDBG("Packing " + toString(NUM_RESOURCES) + " resources: " + toString(createTime) + "us, loading them from " +
+			"the package: " + toString(loadTime) + "us.");
+	}
 }
\ No newline at end of file
@@ -48,18 +48,30 @@ namespace BansheeEngine
 			Dragging
 		};
 
+		/** Location of a single render element of a GUI element within one of the cached GUI meshes. */
+		struct GUIMeshRange
+		{
+			UINT32 meshIdx;
+			UINT32 quadOffset;
+			UINT32 numQuads;
+			UINT32 depth;
+		};
+
 		/**	GUI render data for a single viewport. */
 		struct GUIRenderData
 		{
 			GUIRenderData()
-				:isDirty(true)
+				:isDirty(true), numRebuilds(0)
 			{ }
 
 			Vector<SPtr<TransientMesh>> cachedMeshes;
 			Vector<SpriteMaterialInfo> cachedMaterials;
 			Vector<GUIWidget*> cachedWidgetsPerMesh;
+			Vector<UINT32> cachedNumRenderElements;
+			UnorderedMap<GUIElement*, Vector<GUIMeshRange>> cachedElementRanges;
 			Vector<GUIWidget*> widgets;
 			bool isDirty;
+			UINT32 numRebuilds;
 		};
 
 		/**	Render data for a single GUI group used for notifying the core GUI renderer. */
@@ -164,6 +176,12 @@ namespace BansheeEngine
 		/**	Checks is the input caret visible this frame. */
 		bool getCaretBlinkState() const { return mIsCaretOn; }
 
+		/**	Changes how often does the input caret blink, in seconds. */
+		void setCaretBlinkInterval(float interval) { mCaretBlinkInterval = interval; }
+
+		/**	Returns how often does the input caret blink, in seconds. */
+		float getCaretBlinkInterval() const { return mCaretBlinkInterval; }
+
 		/**
 		 * Returns input caret helper tool that allows you to easily position and show an input caret in your GUI controls.
 		 */
@@ -214,12 +232,31 @@ namespace BansheeEngine
 		/** Gets the core thread portion of the GUI manager, responsible for rendering of GUI elements. */
 		GUIManagerCore* getCore() const { return mCore.load(std::memory_order_relaxed); }
 
+		/**
+		 * Returns how many times were the GUI meshes of the provided viewport rebuilt from scratch, as opposed to only
+		 * having the contents of dirty elements updated.
+		 */
+		UINT32 _getNumMeshRebuilds(const Viewport* viewport) const;
+
 	private:
 		friend class GUIManagerCore;
 
 		/**	Recreates all dirty GUI meshes and makes them ready for rendering. */
 		void updateMeshes();
 
+		/**
+		 * Rewrites the portions of the cached GUI meshes belonging to the provided elements, without regrouping or
+		 * refilling any other elements.
+		 *
+		 * @param[in]	renderData		Render data containing the cached meshes to update.
+		 * @param[in]	dirtyElements	Elements whose contents changed since the meshes were last built.
+		 * @return						False if any of the elements no longer fits in its previous mesh range (e.g. its
+		 *								number of quads, depth or material changed), in which case nothing is modified and
+		 *								the meshes need to be fully rebuilt. True otherwise. Tint changes are allowed
+		 *								if all elements in the affected mesh change to the same tint.
+		 */
+		bool updateDirtyElements(GUIRenderData& renderData, const FrameVector<GUIElement*>& dirtyElements);
+
 		/**	Recreates the input caret texture. */
 		void updateCaretTexture();
 
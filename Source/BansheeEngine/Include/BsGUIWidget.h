@@ -120,11 +120,36 @@ namespace BansheeEngine
 		void _markMeshDirty(GUIElementBase* elem);
 
 		/**
-		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt (this implies the entire
-		 * widget mesh will be rebuilt as well).
+		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt (this implies the widget
+		 * mesh will be updated as well).
 		 */
 		void _markContentDirty(GUIElementBase* elem);
 
+		/**
+		 * Checks if the widget mesh needs to be fully rebuilt, because elements were added, removed, moved, hidden or had
+		 * their depth changed.
+		 */
+		bool _isMeshDirty() const { return mWidgetIsDirty; }
+
+		/** Returns a list of elements whose contents will be updated on the next call to isDirty(true). */
+		const Set<GUIElement*>& _getDirtyContents() const { return mDirtyContents; }
+
+		/** 
+		 * Notifies the widget that bounds of one of its elements changed, meaning the grid used for finding elements at a
+		 * specific position needs to be rebuilt. 
+		 */
+		void _markElementBoundsDirty() { mElementGridDirty = true; }
+
+		/**
+		 * Finds all elements whose clipped bounds contain the provided position. This only narrows down the list of
+		 * candidates, caller still needs to check element visibility and call GUIElement::_isInBounds() on each.
+		 *
+		 * @param[in]	position	Position relative to the widget.
+		 * @param[out]	elements	Found elements will be appended to this list, in the same order as returned by 
+		 *							getElements().
+		 */
+		void _findElementsAt(const Vector2I& position, Vector<GUIElement*>& elements) const;
+
 		/**	Updates the layout of all child elements, repositioning and resizing them as needed. */
 		void _updateLayout();
 
@@ -173,9 +198,18 @@ namespace BansheeEngine
 	private:
 		GUIWidget(const GUIWidget& other) { }
 
+		static const UINT32 ELEMENT_GRID_CELL_SIZE;
+		static const UINT32 ELEMENT_GRID_MAX_CELLS_PER_AXIS;
+
 		/**	Calculates widget bounds using the bounds of all child elements. */
 		void updateBounds() const;
 
+		/**	
+		 * Rebuilds the grid used for finding elements at a specific position. Each cell references all elements whose
+		 * clipped bounds overlap it.
+		 */
+		void updateElementGrid() const;
+
 		/**	Updates the size of the primary GUI panel based on the viewport. */
 		void updateRootPanel();
 
@@ -198,6 +232,15 @@ namespace BansheeEngine
 		mutable bool mWidgetIsDirty;
 		mutable Rect2I mBounds;
 
+		mutable Rect2I mElementGridBounds;
+		mutable UINT32 mElementGridCellWidth;
+		mutable UINT32 mElementGridCellHeight;
+		mutable UINT32 mElementGridNumCellsX;
+		mutable UINT32 mElementGridNumCellsY;
+		mutable Vector<UINT32> mElementGridCellStarts;
+		mutable Vector<GUIElement*> mElementGridCells;
+		mutable bool mElementGridDirty;
+
 		HGUISkin mSkin;
 	};
 
@@ -63,6 +63,12 @@ namespace BansheeEngine
 		 */
 		void add(RenderableElement* element, float distFromCamera);
 
+		/**
+		 * Appends all entries from another render queue to the end of this queue, in the same order as they were added to
+		 * the other queue. Useful for merging queues populated in parallel. Only unsorted entries are appended.
+		 */
+		void add(const RenderQueue& other);
+
 		/**	Clears all render operations from the queue. */
 		void clear();
 		
@@ -79,6 +85,16 @@ namespace BansheeEngine
 		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; }
 
 	protected:
+		/**
+		 * Sorts the elements by packing all sort criteria into a single 64-bit key per element and sorting the keys
+		 * using a radix sort. Produces the same order as the comparison based sort, except if the value ranges in the
+		 * queue are too large for a key to fit, in which case the distance is quantized.
+		 *
+		 * @return	False if the criteria could not be packed into a key with reasonable distance precision, in which
+		 *			case the elements were not sorted.
+		 */
+		bool sortWithKeys();
+
 		/**	Callback used for sorting elements with no material grouping. */
 		static bool elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
 
@@ -94,6 +110,10 @@ namespace BansheeEngine
 
 		Vector<RenderQueueElement> mSortedRenderElements;
 		StateReduction mStateReductionMode;
+
+		Vector<UINT64> mSortKeys;
+		Vector<UINT64> mSortKeysTemp;
+		Vector<UINT32> mSortIdxTemp;
 	};
 
 	/** @} */
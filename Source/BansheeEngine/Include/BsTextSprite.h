@@ -133,7 +133,13 @@ namespace BansheeEngine
 		/**	Clears internal geometry buffers. */
 		void clearMesh();
 
+		/** Releases the font characters pinned by the last call to update(). */
+		void unpinChars();
+
 		mutable StaticAlloc<STATIC_BUFFER_SIZE, STATIC_BUFFER_SIZE> mAlloc;
+
+		SPtr<const FontBitmap> mPinnedFontData;
+		Vector<UINT32> mPinnedChars;
 	};
 
 	/** @} */
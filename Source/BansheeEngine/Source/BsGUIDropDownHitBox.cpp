@@ -1,6 +1,7 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsGUIDropDownHitBox.h"
+#include "BsGUIWidget.h"
 #include "BsGUICommandEvent.h"
 #include "BsGUIMouseEvent.h"
 
@@ -38,6 +39,9 @@ namespace BansheeEngine
 		mBounds.push_back(bounds);
 
 		updateClippedBounds();
+
+		if (mParentWidget != nullptr)
+			mParentWidget->_markElementBoundsDirty();
 	}
 
 	void GUIDropDownHitBox::setBounds(const Vector<Rect2I>& bounds)
@@ -45,6 +49,9 @@ namespace BansheeEngine
 		mBounds = bounds;
 
 		updateClippedBounds();
+
+		if (mParentWidget != nullptr)
+			mParentWidget->_markElementBoundsDirty();
 	}
 
 	void GUIDropDownHitBox::updateClippedBounds()
@@ -29,7 +29,11 @@ namespace BansheeEngine
 
 	void GUIElement::updateRenderElementsInternal()
 	{
+		Rect2I oldClippedBounds = mClippedBounds;
 		updateClippedBounds();
+
+		if (mClippedBounds != oldClippedBounds && mParentWidget != nullptr)
+			mParentWidget->_markElementBoundsDirty();
 	}
 
 	void GUIElement::updateClippedBounds()
@@ -101,7 +105,11 @@ namespace BansheeEngine
 		GUIElementBase::_setLayoutData(data);
 		_setElementDepth(elemDepth);
 
+		Rect2I oldClippedBounds = mClippedBounds;
 		updateClippedBounds();
+
+		if (mClippedBounds != oldClippedBounds && mParentWidget != nullptr)
+			mParentWidget->_markElementBoundsDirty();
 	}
 
 	void GUIElement::_changeParentWidget(GUIWidget* widget)
@@ -106,7 +106,7 @@ namespace BansheeEngine
 		UINT32 numElements = mImageSprite->getNumRenderElements();
 		numElements += mTextSprite->getNumRenderElements();
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 			numElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
 
 		if(mSelectionShown)
@@ -158,7 +158,7 @@ namespace BansheeEngine
 		TEXT_SPRITE_DESC textDesc = getTextDesc();
 		mTextSprite->update(textDesc, (UINT64)_getParentWidget());
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			gGUIManager().getInputCaretTool()->updateText(this, textDesc); // TODO - These shouldn't be here. Only call this when one of these parameters changes.
 			gGUIManager().getInputCaretTool()->updateSprite();
@@ -203,7 +203,7 @@ namespace BansheeEngine
 			return mImageSprite;
 		}
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -248,7 +248,7 @@ namespace BansheeEngine
 		if(renderElemIdx < newNumElements)
 			return Vector2I(mLayoutData.area.x, mLayoutData.area.y);;
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -289,7 +289,7 @@ namespace BansheeEngine
 		if(renderElemIdx < newNumElements)
 			return mLayoutData.getLocalClipRect();
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -392,6 +392,23 @@ namespace BansheeEngine
 		Rect2I clipRect = renderElemToClipRect(renderElementIdx);
 
 		sprite->fillBuffer(vertices, uv, indices, startingQuad, maxNumQuads, vertexStride, indexStride, localRenderElementIdx, offset, clipRect);
+
+		// Caret stays a part of the mesh while it is shown, so blinking doesn't require the mesh to be rebuilt.
+		// Instead its quads are collapsed into a single point while blinked out.
+		if(sprite == gGUIManager().getInputCaretTool()->getSprite() && !gGUIManager().getCaretBlinkState())
+		{
+			UINT8* vertDst = vertices + startingQuad * 4 * vertexStride;
+
+			Vector2 point;
+			memcpy(&point, vertDst, sizeof(Vector2));
+
+			UINT32 numVertices = sprite->getNumQuads(localRenderElementIdx) * 4;
+			for(UINT32 i = 0; i < numVertices; i++)
+			{
+				memcpy(vertDst, &point, sizeof(Vector2));
+				vertDst += vertexStride;
+			}
+		}
 	}
 
 	bool GUIInputBox::_mouseEvent(const GUIMouseEvent& ev)
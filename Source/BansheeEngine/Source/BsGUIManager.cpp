@@ -432,22 +432,46 @@ namespace BansheeEngine
 		{
 			GUIRenderData& renderData = cachedMeshData.second;
 
-			// Check if anything is dirty. If nothing is we can skip the update
+			// Check if anything is dirty. If nothing is we can skip the update. If widgets only have elements whose
+			// contents changed (and not their position, depth or visibility) we try to rewrite just those elements in
+			// the existing meshes, and only rebuild the meshes from scratch if that fails.
 			bool isDirty = renderData.isDirty;
+			bool rebuildAll = renderData.isDirty;
+			bool updatedInPlace = false;
 			renderData.isDirty = false;
 
-			for(auto& widget : renderData.widgets)
+			bs_frame_mark();
 			{
-				if (widget->isDirty(true))
+				FrameVector<GUIElement*> dirtyElements;
+				for(auto& widget : renderData.widgets)
 				{
-					isDirty = true;
+					if (!widget->getIsActive())
+						continue;
+
+					if (widget->_isMeshDirty())
+						rebuildAll = true;
+					else if (!rebuildAll)
+					{
+						for (auto& element : widget->_getDirtyContents())
+							dirtyElements.push_back(element);
+					}
+
+					if (widget->isDirty(true))
+					{
+						isDirty = true;
+					}
 				}
+
+				if (isDirty && !rebuildAll)
+					updatedInPlace = updateDirtyElements(renderData, dirtyElements);
 			}
+			bs_frame_clear();
 
-			if(!isDirty)
+			if(!isDirty || updatedInPlace)
 				continue;
 
 			mCoreDirty = true;
+			renderData.numRebuilds++;
 
 			bs_frame_mark();
 			{
@@ -610,6 +634,8 @@ namespace BansheeEngine
 				}
 
 				renderData.cachedMaterials.resize(numMeshes);
+				renderData.cachedNumRenderElements.resize(numMeshes);
+				renderData.cachedElementRanges.clear();
 
 				if(mSeparateMeshesByWidget)
 					renderData.cachedWidgetsPerMesh.resize(numMeshes);
@@ -619,6 +645,7 @@ namespace BansheeEngine
 				for(auto& group : sortedGroups)
 				{
 					renderData.cachedMaterials[groupIdx] = group->matInfo;
+					renderData.cachedNumRenderElements[groupIdx] = (UINT32)group->elements.size();
 
 					if(mSeparateMeshesByWidget)
 					{
@@ -652,6 +679,17 @@ namespace BansheeEngine
 						for(UINT32 i = indexStart; i < indexEnd; i++)
 							indices[i] += vertOffset;
 
+						// Remember where the element ended up, so its contents can later be updated without a full rebuild
+						Vector<GUIMeshRange>& ranges = renderData.cachedElementRanges[matElement.element];
+						if (ranges.size() <= matElement.renderElement)
+							ranges.resize(matElement.renderElement + 1);
+
+						GUIMeshRange& range = ranges[matElement.renderElement];
+						range.meshIdx = groupIdx;
+						range.quadOffset = quadOffset;
+						range.numQuads = numQuads;
+						range.depth = matElement.element->_getRenderElementDepth(matElement.renderElement);
+
 						quadOffset += numQuads;
 					}
 
@@ -673,6 +711,111 @@ namespace BansheeEngine
 		}
 	}
 
+	bool GUIManager::updateDirtyElements(GUIRenderData& renderData, const FrameVector<GUIElement*>& dirtyElements)
+	{
+		// Tint is applied per mesh, so a tint change can only be handled here if the entire mesh changes to the same
+		// tint
+		UINT32 numMeshes = (UINT32)renderData.cachedMeshes.size();
+		FrameVector<UINT32> numRetintedElements(numMeshes, 0);
+		FrameVector<Color> newTints(numMeshes);
+
+		// Make sure every dirty element still fits exactly into the range it was assigned during the last rebuild
+		for (auto& element : dirtyElements)
+		{
+			auto iterFind = renderData.cachedElementRanges.find(element);
+			if (iterFind == renderData.cachedElementRanges.end())
+			{
+				// Element isn't part of any mesh. That's fine as long as it doesn't need to be rendered.
+				if (element->_isVisible() && element->_getNumRenderElements() > 0)
+					return false;
+
+				continue;
+			}
+
+			if (!element->_isVisible())
+				return false;
+
+			const Vector<GUIMeshRange>& ranges = iterFind->second;
+			UINT32 numRenderElems = element->_getNumRenderElements();
+			if (numRenderElems != (UINT32)ranges.size())
+				return false;
+
+			for (UINT32 i = 0; i < numRenderElems; i++)
+			{
+				const GUIMeshRange& range = ranges[i];
+
+				if (element->_getNumQuads(i) != range.numQuads)
+					return false;
+
+				if (element->_getRenderElementDepth(i) != range.depth)
+					return false;
+
+				const SpriteMaterialInfo& matInfo = element->_getMaterial(i);
+				if (matInfo == renderData.cachedMaterials[range.meshIdx])
+					continue;
+
+				SpriteMaterialInfo retintedMatInfo = renderData.cachedMaterials[range.meshIdx];
+				retintedMatInfo.tint = matInfo.tint;
+
+				if (matInfo != retintedMatInfo)
+					return false;
+
+				if (numRetintedElements[range.meshIdx] > 0 && newTints[range.meshIdx] != matInfo.tint)
+					return false;
+
+				newTints[range.meshIdx] = matInfo.tint;
+				numRetintedElements[range.meshIdx]++;
+			}
+		}
+
+		for (UINT32 i = 0; i < numMeshes; i++)
+		{
+			if (numRetintedElements[i] == 0)
+				continue;
+
+			if (numRetintedElements[i] != renderData.cachedNumRenderElements[i])
+				return false;
+		}
+
+		for (UINT32 i = 0; i < numMeshes; i++)
+		{
+			if (numRetintedElements[i] == 0)
+				continue;
+
+			renderData.cachedMaterials[i].tint = newTints[i];
+			mCoreDirty = true;
+		}
+
+		// Only write the vertices of the dirty elements. Indices depend only on the element's position in the mesh,
+		// which didn't change.
+		for (auto& element : dirtyElements)
+		{
+			auto iterFind = renderData.cachedElementRanges.find(element);
+			if (iterFind == renderData.cachedElementRanges.end())
+				continue;
+
+			const Vector<GUIMeshRange>& ranges = iterFind->second;
+			for (UINT32 i = 0; i < (UINT32)ranges.size(); i++)
+			{
+				const GUIMeshRange& range = ranges[i];
+				UINT32 numVertices = range.numQuads * 4;
+				UINT32 numIndices = range.numQuads * 6;
+				SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(numVertices, numIndices, mVertexDesc);
+
+				UINT8* vertices = meshData->getElementData(VES_POSITION);
+				UINT8* uvs = meshData->getElementData(VES_TEXCOORD);
+				UINT32* indices = meshData->getIndices32();
+				UINT32 vertexStride = meshData->getVertexDesc()->getVertexStride();
+				UINT32 indexStride = meshData->getIndexElementSize();
+
+				element->_fillBuffer(vertices, uvs, indices, 0, range.numQuads, vertexStride, indexStride, i);
+				mMeshHeap->update(renderData.cachedMeshes[range.meshIdx], meshData, range.quadOffset * 4);
+			}
+		}
+
+		return true;
+	}
+
 	void GUIManager::updateCaretTexture()
 	{
 		if(mCaretTexture == nullptr)
@@ -1247,6 +1390,7 @@ namespace BansheeEngine
 			Vector2I windowPos = windowUnderPointer->screenToWindowPos(pointerScreenPos);
 			Vector4 vecWindowPos((float)windowPos.x, (float)windowPos.y, 0.0f, 1.0f);
 
+			Vector<GUIElement*> elements;
 			UINT32 widgetIdx = 0;
 			for(auto& widgetInfo : mWidgets)
 			{
@@ -1260,9 +1404,12 @@ namespace BansheeEngine
 				if(widgetWindows[widgetIdx] == windowUnderPointer 
 					&& widget->inBounds(windowToBridgedCoords(widget->getTarget()->getTarget(), windowPos)))
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
 					Vector2I localPos = getWidgetRelativePos(widget, pointerScreenPos);
 
+					// Only test elements whose bounds overlap the pointer, as reported by the widget's element grid
+					elements.clear();
+					widget->_findElementsAt(localPos, elements);
+
 					// Elements with lowest depth (most to the front) get handled first
 					for(auto iter = elements.begin(); iter != elements.end(); ++iter)
 					{
@@ -1645,6 +1792,15 @@ namespace BansheeEngine
 		return nullptr;
 	}
 
+	UINT32 GUIManager::_getNumMeshRebuilds(const Viewport* viewport) const
+	{
+		auto iterFind = mCachedGUIData.find(viewport);
+		if (iterFind == mCachedGUIData.end())
+			return 0;
+
+		return iterFind->second.numRebuilds;
+	}
+
 	SPtr<RenderWindow> GUIManager::getBridgeWindow(const SPtr<RenderTexture>& target) const
 	{
 		if (target == nullptr)
@@ -14,16 +14,21 @@
 
 namespace BansheeEngine
 {
+	const UINT32 GUIWidget::ELEMENT_GRID_CELL_SIZE = 64;
+	const UINT32 GUIWidget::ELEMENT_GRID_MAX_CELLS_PER_AXIS = 64;
+
 	GUIWidget::GUIWidget(const SPtr<Camera>& camera)
 		: mCamera(camera), mPanel(nullptr), mDepth(0), mIsActive(true), mTransform(Matrix4::IDENTITY), mCachedRTId(0)
-		, mWidgetIsDirty(false)
+		, mWidgetIsDirty(false), mElementGridCellWidth(0), mElementGridCellHeight(0), mElementGridNumCellsX(0)
+		, mElementGridNumCellsY(0), mElementGridDirty(true)
 	{
 		construct(camera);
 	}
 
 	GUIWidget::GUIWidget(const HCamera& camera)
 		: mCamera(camera->_getCamera()), mPanel(nullptr), mDepth(0), mIsActive(true), mTransform(Matrix4::IDENTITY)
-		, mCachedRTId(0), mWidgetIsDirty(false)
+		, mCachedRTId(0), mWidgetIsDirty(false), mElementGridCellWidth(0), mElementGridCellHeight(0)
+		, mElementGridNumCellsX(0), mElementGridNumCellsY(0), mElementGridDirty(true)
 	{
 		construct(mCamera);
 	}
@@ -256,6 +261,7 @@ namespace BansheeEngine
 		{
 			mElements.push_back(static_cast<GUIElement*>(elem));
 			mWidgetIsDirty = true;
+			mElementGridDirty = true;
 		}
 	}
 
@@ -269,6 +275,7 @@ namespace BansheeEngine
 		{
 			mElements.erase(iterFind);
 			mWidgetIsDirty = true;
+			mElementGridDirty = true;
 		}
 
 		if (elem->_getType() == GUIElementBase::Type::Element)
@@ -384,6 +391,123 @@ namespace BansheeEngine
 		}
 	}
 
+	void GUIWidget::_findElementsAt(const Vector2I& position, Vector<GUIElement*>& elements) const
+	{
+		if (mElementGridDirty)
+			updateElementGrid();
+
+		if (mElementGridNumCellsX == 0 || mElementGridNumCellsY == 0)
+			return;
+
+		if (!mElementGridBounds.contains(position))
+			return;
+
+		UINT32 cellX = (UINT32)(position.x - mElementGridBounds.x) / mElementGridCellWidth;
+		UINT32 cellY = (UINT32)(position.y - mElementGridBounds.y) / mElementGridCellHeight;
+		UINT32 cellIdx = cellY * mElementGridNumCellsX + cellX;
+
+		for (UINT32 i = mElementGridCellStarts[cellIdx]; i < mElementGridCellStarts[cellIdx + 1]; i++)
+			elements.push_back(mElementGridCells[i]);
+	}
+
+	void GUIWidget::updateElementGrid() const
+	{
+		mElementGridDirty = false;
+		mElementGridNumCellsX = 0;
+		mElementGridNumCellsY = 0;
+		mElementGridCellStarts.clear();
+		mElementGridCells.clear();
+
+		// Grid covers the combined bounds of all elements, split into cells of fixed size. Cells are made larger if the
+		// bounds are too large, to keep the number of cells an element can overlap bounded.
+		bool hasBounds = false;
+		for (auto& elem : mElements)
+		{
+			const Rect2I& elemBounds = elem->_getClippedBounds();
+			if (elemBounds.width == 0 || elemBounds.height == 0)
+				continue;
+
+			if (!hasBounds)
+			{
+				mElementGridBounds = elemBounds;
+				hasBounds = true;
+			}
+			else
+				mElementGridBounds.encapsulate(elemBounds);
+		}
+
+		if (!hasBounds)
+			return;
+
+		auto divideUp = [](UINT32 value, UINT32 divisor) { return (value + divisor - 1) / divisor; };
+
+		mElementGridCellWidth = std::max(ELEMENT_GRID_CELL_SIZE, 
+			divideUp(mElementGridBounds.width, ELEMENT_GRID_MAX_CELLS_PER_AXIS));
+		mElementGridCellHeight = std::max(ELEMENT_GRID_CELL_SIZE, 
+			divideUp(mElementGridBounds.height, ELEMENT_GRID_MAX_CELLS_PER_AXIS));
+
+		mElementGridNumCellsX = divideUp(mElementGridBounds.width, mElementGridCellWidth);
+		mElementGridNumCellsY = divideUp(mElementGridBounds.height, mElementGridCellHeight);
+
+		UINT32 numCells = mElementGridNumCellsX * mElementGridNumCellsY;
+		mElementGridCellStarts.resize(numCells + 1, 0);
+
+		auto getCellRange = [&](const Rect2I& bounds, UINT32& minX, UINT32& minY, UINT32& maxX, UINT32& maxY)
+		{
+			minX = (UINT32)(bounds.x - mElementGridBounds.x) / mElementGridCellWidth;
+			minY = (UINT32)(bounds.y - mElementGridBounds.y) / mElementGridCellHeight;
+			maxX = (UINT32)(bounds.x + (INT32)bounds.width - 1 - mElementGridBounds.x) / mElementGridCellWidth;
+			maxY = (UINT32)(bounds.y + (INT32)bounds.height - 1 - mElementGridBounds.y) / mElementGridCellHeight;
+		};
+
+		// Count the number of elements in each cell first, so all cells can be stored in a single contiguous array
+		for (auto& elem : mElements)
+		{
+			const Rect2I& elemBounds = elem->_getClippedBounds();
+			if (elemBounds.width == 0 || elemBounds.height == 0)
+				continue;
+
+			UINT32 minX, minY, maxX, maxY;
+			getCellRange(elemBounds, minX, minY, maxX, maxY);
+
+			for (UINT32 y = minY; y <= maxY; y++)
+			{
+				for (UINT32 x = minX; x <= maxX; x++)
+					mElementGridCellStarts[y * mElementGridNumCellsX + x + 1]++;
+			}
+		}
+
+		for (UINT32 i = 0; i < numCells; i++)
+			mElementGridCellStarts[i + 1] += mElementGridCellStarts[i];
+
+		mElementGridCells.resize(mElementGridCellStarts[numCells]);
+
+		bs_frame_mark();
+		{
+			FrameVector<UINT32> cellWriteIdx(mElementGridCellStarts.begin(), mElementGridCellStarts.end() - 1);
+
+			for (auto& elem : mElements)
+			{
+				const Rect2I& elemBounds = elem->_getClippedBounds();
+				if (elemBounds.width == 0 || elemBounds.height == 0)
+					continue;
+
+				UINT32 minX, minY, maxX, maxY;
+				getCellRange(elemBounds, minX, minY, maxX, maxY);
+
+				for (UINT32 y = minY; y <= maxY; y++)
+				{
+					for (UINT32 x = minX; x <= maxX; x++)
+					{
+						UINT32 cellIdx = y * mElementGridNumCellsX + x;
+						mElementGridCells[cellWriteIdx[cellIdx]++] = elem;
+					}
+				}
+			}
+		}
+		bs_frame_clear();
+	}
+
 	void GUIWidget::ownerTargetResized()
 	{
 		updateRootPanel();
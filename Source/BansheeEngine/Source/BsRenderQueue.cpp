@@ -6,6 +6,7 @@
 #include "BsMesh.h"
 #include "BsMaterial.h"
 #include "BsRenderableElement.h"
+#include "BsRadixSort.h"
 
 using namespace std::placeholders;
 
@@ -70,25 +71,46 @@ namespace BansheeEngine
 		}
 	}
 
-	void RenderQueue::sort()
+	void RenderQueue::add(const RenderQueue& other)
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
+		UINT32 offset = (UINT32)mSortableElementIdx.size();
+
+		mElements.insert(mElements.end(), other.mElements.begin(), other.mElements.end());
 
-		switch (mStateReductionMode)
+		for (auto& otherElem : other.mSortableElements)
 		{
-		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
-		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
-		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferSort;
-			break;
+			UINT32 idx = offset + otherElem.seqIdx;
+			mSortableElementIdx.push_back(idx);
+
+			mSortableElements.push_back(otherElem);
+			mSortableElements.back().seqIdx = idx;
 		}
+	}
 
+	void RenderQueue::sort()
+	{
 		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+		if (!sortWithKeys())
+		{
+			std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
+
+			switch (mStateReductionMode)
+			{
+			case StateReduction::None:
+				sortMethod = &elementSorterNoGroup;
+				break;
+			case StateReduction::Material:
+				sortMethod = &elementSorterPreferGroup;
+				break;
+			case StateReduction::Distance:
+				sortMethod = &elementSorterPreferSort;
+				break;
+			}
+
+			const Vector<SortableElement>& lookup = mSortableElements;
+			std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), 
+				[&](UINT32 a, UINT32 b) { return sortMethod(a, b, lookup); });
+		}
 
 		UINT32 prevShaderId = (UINT32)-1;
 		UINT32 prevPassIdx = (UINT32)-1;
@@ -148,6 +170,94 @@ namespace BansheeEngine
 		}
 	}
 
+	bool RenderQueue::sortWithKeys()
+	{
+		// Minimum number of bits to keep for distance. If the other fields need more bits than that, fall back to
+		// comparison sort, so relative order of objects is never lost.
+		static const UINT32 MIN_DISTANCE_BITS = 16;
+
+		UINT32 numElements = (UINT32)mSortableElements.size();
+		if (numElements == 0)
+			return true;
+
+		// Find ranges of all values so each field in the key uses only the bits it needs
+		INT32 minPriority = mSortableElements[0].priority;
+		INT32 maxPriority = minPriority;
+		UINT32 minShaderId = mSortableElements[0].shaderId;
+		UINT32 maxShaderId = minShaderId;
+		UINT32 maxPassIdx = 0;
+
+		for (auto& elem : mSortableElements)
+		{
+			minPriority = std::min(minPriority, elem.priority);
+			maxPriority = std::max(maxPriority, elem.priority);
+			minShaderId = std::min(minShaderId, elem.shaderId);
+			maxShaderId = std::max(maxShaderId, elem.shaderId);
+			maxPassIdx = std::max(maxPassIdx, elem.passIdx);
+		}
+
+		UINT32 priorityBits = RadixSort::getNumBits((UINT64)((INT64)maxPriority - (INT64)minPriority));
+		UINT32 shaderBits = 0;
+		UINT32 passBits = 0;
+
+		// Shader and pass only participate in the key if the queue groups by them
+		if (mStateReductionMode != StateReduction::None)
+		{
+			shaderBits = RadixSort::getNumBits(maxShaderId - minShaderId);
+			passBits = RadixSort::getNumBits(maxPassIdx);
+		}
+
+		UINT32 otherBits = priorityBits + shaderBits + passBits;
+		if (otherBits + MIN_DISTANCE_BITS > 64)
+			return false;
+
+		// Quantize distance only if the full value doesn't fit
+		UINT32 distanceBits = std::min(32U, 64 - otherBits);
+		UINT32 distanceShift = 32 - distanceBits;
+
+		mSortKeys.resize(numElements);
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const SortableElement& elem = mSortableElements[i];
+
+			// Higher priority goes first, so invert it
+			UINT64 priority = (UINT64)((INT64)maxPriority - (INT64)elem.priority);
+			UINT64 shaderId = elem.shaderId - minShaderId;
+			UINT64 passIdx = elem.passIdx;
+			UINT64 distance = RadixSort::toSortableKey(elem.distFromCamera) >> distanceShift;
+
+			UINT64 key = priority;
+			switch (mStateReductionMode)
+			{
+			case StateReduction::None:
+				key = (key << distanceBits) | distance;
+				break;
+			case StateReduction::Material:
+				key = (key << shaderBits) | shaderId;
+				key = (key << passBits) | passIdx;
+				key = (key << distanceBits) | distance;
+				break;
+			case StateReduction::Distance:
+				key = (key << distanceBits) | distance;
+				key = (key << shaderBits) | shaderId;
+				key = (key << passBits) | passIdx;
+				break;
+			}
+
+			// Index array is still in sequential order, which the stable sort preserves for equal keys
+			mSortKeys[i] = key;
+			mSortableElementIdx[i] = elem.seqIdx;
+		}
+
+		mSortKeysTemp.resize(numElements);
+		mSortIdxTemp.resize(numElements);
+
+		RadixSort::sort(mSortKeys.data(), mSortableElementIdx.data(), mSortKeysTemp.data(), mSortIdxTemp.data(), 
+			numElements, otherBits + distanceBits);
+
+		return true;
+	}
+
 	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
 	{
 		const SortableElement& a = lookup[aIdx];
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsTextSprite.h"
 #include "BsTextData.h"
+#include "BsFont.h"
 #include "BsVector2.h"
 
 namespace BansheeEngine
@@ -14,6 +15,7 @@ namespace BansheeEngine
 	TextSprite::~TextSprite()
 	{
 		clearMesh();
+		unpinChars();
 	}
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
@@ -24,6 +26,19 @@ namespace BansheeEngine
 
 			UINT32 numPages = textData.getNumPages();
 
+			// Characters rendered at runtime must stay in the font atlas for as long as the sprite references their
+			// texture coordinates. New characters are pinned before the old ones are released, so shared characters
+			// are never left unpinned.
+			const SPtr<const FontBitmap>& fontData = textData.getFontData();
+
+			Vector<UINT32> pinnedChars;
+			if (fontData != nullptr)
+				fontData->_pinChars(desc.text, pinnedChars);
+
+			unpinChars();
+			mPinnedFontData = fontData;
+			mPinnedChars = std::move(pinnedChars);
+
 			// Free all previous memory
 			for (auto& cachedElem : mCachedRenderElements)
 			{
@@ -75,6 +90,15 @@ namespace BansheeEngine
 		updateBounds();
 	}
 
+	void TextSprite::unpinChars()
+	{
+		if (mPinnedFontData != nullptr)
+			mPinnedFontData->_unpinChars(mPinnedChars);
+
+		mPinnedFontData = nullptr;
+		mPinnedChars.clear();
+	}
+
 	UINT32 TextSprite::genTextQuads(UINT32 page, const TextDataBase& textData, UINT32 width, UINT32 height,
 		TextHorzAlign horzAlign, TextVertAlign vertAlign, SpriteAnchor anchor, Vector2* vertices, Vector2* uv, UINT32* indices, UINT32 bufferSizeQuads)
 	{
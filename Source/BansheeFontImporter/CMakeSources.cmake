@@ -1,11 +1,13 @@
 set(BS_BANSHEEFONTIMPORTER_INC_NOFILTER
 	"Include/BsFontPrerequisites.h"
 	"Include/BsFontImporter.h"
+	"Include/BsFreeTypeGlyphRasterizer.h"
 )
 
 set(BS_BANSHEEFONTIMPORTER_SRC_NOFILTER
 	"Source/BsFontPlugin.cpp"
 	"Source/BsFontImporter.cpp"
+	"Source/BsFreeTypeGlyphRasterizer.cpp"
 )
 
 source_group("Header Files" FILES ${BS_BANSHEEFONTIMPORTER_INC_NOFILTER})
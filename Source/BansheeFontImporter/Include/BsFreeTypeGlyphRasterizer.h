@@ -0,0 +1,54 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsFontPrerequisites.h"
+#include "BsDynamicFontAtlas.h"
+
+struct FT_LibraryRec_;
+struct FT_FaceRec_;
+
+namespace BansheeEngine
+{
+	/** @addtogroup Font
+	 *  @{
+	 */
+
+	/** Glyph rasterizer that renders characters of fonts with dynamic character sets, by using the FreeType library. */
+	class BS_FONT_EXPORT FreeTypeGlyphRasterizer : public GlyphRasterizer
+	{
+	public:
+		FreeTypeGlyphRasterizer(const DYNAMIC_FONT_DESC& desc, UINT32 size);
+		~FreeTypeGlyphRasterizer();
+
+		/** @copydoc GlyphRasterizer::renderGlyph */
+		bool renderGlyph(UINT32 charId, CHAR_DESC& desc, Vector<UINT8>& pixels) override;
+
+		/** @copydoc GlyphRasterizer::getKerning */
+		INT32 getKerning(UINT32 firstCharId, UINT32 secondCharId) override;
+
+		/** @copydoc GlyphRasterizer::getMaxGlyphSize */
+		UINT32 getMaxGlyphSize() const override { return mMaxGlyphSize; }
+
+		/** Checks if the font data was successfully parsed. */
+		bool isValid() const { return mFace != nullptr; }
+
+		/**
+		 * Creates a new rasterizer for the specified font and size. Returns null if the font data cannot be parsed.
+		 * Registered with FontManager::_registerGlyphRasterizerFactory() when the font importer plugin is loaded.
+		 */
+		static SPtr<GlyphRasterizer> create(const DYNAMIC_FONT_DESC& desc, UINT32 size);
+
+		/** Returns FreeType glyph load flags corresponding to the specified render mode. */
+		static INT32 getLoadFlags(FontRenderMode renderMode);
+
+	private:
+		Vector<UINT8> mFontData; /**< FreeType references the font file contents for the lifetime of the face. */
+		FT_LibraryRec_* mLibrary;
+		FT_FaceRec_* mFace;
+		INT32 mLoadFlags;
+		UINT32 mMaxGlyphSize;
+	};
+
+	/** @} */
+}
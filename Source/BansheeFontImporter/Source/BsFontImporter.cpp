@@ -10,6 +10,9 @@
 #include "BsCoreApplication.h"
 #include "BsCoreThread.h"
 #include "BsCoreThreadAccessor.h"
+#include "BsFreeTypeGlyphRasterizer.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
 
 #include <ft2build.h>
 #include <freetype/freetype.h>
@@ -76,25 +79,7 @@ namespace BansheeEngine
 		Vector<UINT32> fontSizes = fontImportOptions->getFontSizes();
 		UINT32 dpi = fontImportOptions->getDPI();
 
-		FT_Int32 loadFlags;
-		switch (fontImportOptions->getRenderMode())
-		{
-		case FontRenderMode::Smooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::Raster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::HintedSmooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
-			break;
-		case FontRenderMode::HintedRaster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
-			break;
-		default:
-			loadFlags = FT_LOAD_TARGET_NORMAL;
-			break;
-		}
+		FT_Int32 loadFlags = (FT_Int32)FreeTypeGlyphRasterizer::getLoadFlags(fontImportOptions->getRenderMode());
 
 		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
 
@@ -174,7 +159,7 @@ namespace BansheeEngine
 			}
 
 			// Create an optimal layout for character bitmaps
-			TexAtlasGenerator texAtlasGen(false, MAXIMUM_TEXTURE_SIZE, MAXIMUM_TEXTURE_SIZE);
+			TexAtlasGenerator texAtlasGen(false, MAXIMUM_TEXTURE_SIZE, MAXIMUM_TEXTURE_SIZE, false, TexAtlasPackMethod::MaxRects);
 			Vector<TexAtlasPageDesc> pages = texAtlasGen.createAtlasLayout(atlasElements);
 
 			INT32 baselineOffset = 0;
@@ -360,7 +345,24 @@ namespace BansheeEngine
 			dataPerSize.push_back(fontData);
 		}
 
-		SPtr<Font> newFont = Font::_createPtr(dataPerSize);
+		SPtr<Font> newFont;
+		if (fontImportOptions->getDynamic())
+		{
+			// Characters outside of the imported ranges are rendered from the source file at runtime
+			DYNAMIC_FONT_DESC dynamicDesc;
+			dynamicDesc.dpi = dpi;
+			dynamicDesc.renderMode = fontImportOptions->getRenderMode();
+			dynamicDesc.pageSize = fontImportOptions->getDynamicPageSize();
+			dynamicDesc.numPages = fontImportOptions->getDynamicNumPages();
+
+			SPtr<DataStream> stream = FileSystem::openFile(filePath);
+			dynamicDesc.fontData.resize(stream->size());
+			stream->read(dynamicDesc.fontData.data(), dynamicDesc.fontData.size());
+
+			newFont = Font::_createPtr(dataPerSize, dynamicDesc);
+		}
+		else
+			newFont = Font::_createPtr(dataPerSize);
 
 		FT_Done_FreeType(library);
 
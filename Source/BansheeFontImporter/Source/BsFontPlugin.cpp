@@ -3,6 +3,8 @@
 #include "BsFontPrerequisites.h"
 #include "BsImporter.h"
 #include "BsFontImporter.h"
+#include "BsFreeTypeGlyphRasterizer.h"
+#include "BsFontManager.h"
 
 namespace BansheeEngine
 {
@@ -19,6 +21,10 @@ namespace BansheeEngine
 		FontImporter* importer = bs_new<FontImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		// Importer plugins are loaded on start-up, before any fonts, so fonts with dynamic character sets can render
+		// characters at runtime
+		FontManager::instance()._registerGlyphRasterizerFactory(&FreeTypeGlyphRasterizer::create);
+
 		return nullptr;
 	}
 }
\ No newline at end of file
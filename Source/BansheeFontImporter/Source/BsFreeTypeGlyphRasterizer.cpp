@@ -0,0 +1,183 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsFreeTypeGlyphRasterizer.h"
+#include "BsDebug.h"
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include FT_FREETYPE_H
+
+namespace BansheeEngine
+{
+	FreeTypeGlyphRasterizer::FreeTypeGlyphRasterizer(const DYNAMIC_FONT_DESC& desc, UINT32 size)
+		:mFontData(desc.fontData), mLibrary(nullptr), mFace(nullptr), mLoadFlags(getLoadFlags(desc.renderMode))
+		, mMaxGlyphSize(0)
+	{
+		if (FT_Init_FreeType(&mLibrary))
+		{
+			LOGERR("Error occurred during FreeType library initialization.");
+			mLibrary = nullptr;
+			return;
+		}
+
+		FT_Error error = FT_New_Memory_Face(mLibrary, mFontData.data(), (FT_Long)mFontData.size(), 0, &mFace);
+		if (error)
+		{
+			LOGERR("Failed to load font data for runtime character rendering.");
+			mFace = nullptr;
+			return;
+		}
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(size * (1 << 6));
+		if (FT_Set_Char_Size(mFace, ftSize, 0, desc.dpi, desc.dpi))
+		{
+			LOGERR("Could not set character size.");
+
+			FT_Done_Face(mFace);
+			mFace = nullptr;
+			return;
+		}
+
+		// Size of the bounding box that fits all glyphs in the face, rounded up
+		const FT_Size_Metrics& metrics = mFace->size->metrics;
+		if (FT_IS_SCALABLE(mFace))
+		{
+			FT_Pos width = FT_MulFix(mFace->bbox.xMax - mFace->bbox.xMin, metrics.x_scale);
+			FT_Pos height = FT_MulFix(mFace->bbox.yMax - mFace->bbox.yMin, metrics.y_scale);
+
+			mMaxGlyphSize = (UINT32)((std::max(width, height) + 63) >> 6);
+		}
+		else
+			mMaxGlyphSize = (UINT32)((std::max(metrics.max_advance, metrics.height) + 63) >> 6);
+
+		// Leave room for antialiasing bleeding outside of the bounding box
+		mMaxGlyphSize += 2;
+	}
+
+	FreeTypeGlyphRasterizer::~FreeTypeGlyphRasterizer()
+	{
+		if (mFace != nullptr)
+			FT_Done_Face(mFace);
+
+		if (mLibrary != nullptr)
+			FT_Done_FreeType(mLibrary);
+	}
+
+	bool FreeTypeGlyphRasterizer::renderGlyph(UINT32 charId, CHAR_DESC& desc, Vector<UINT8>& pixels)
+	{
+		if (mFace == nullptr)
+			return false;
+
+		FT_UInt glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+		if (glyphIdx == 0)
+			return false;
+
+		if (FT_Load_Glyph(mFace, glyphIdx, mLoadFlags))
+			return false;
+
+		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(mLoadFlags);
+		if (FT_Render_Glyph(mFace->glyph, renderMode))
+			return false;
+
+		FT_GlyphSlot slot = mFace->glyph;
+
+		UINT32 width = (UINT32)slot->bitmap.width;
+		UINT32 height = (UINT32)slot->bitmap.rows;
+
+		if (slot->bitmap.buffer == nullptr && width > 0 && height > 0)
+			return false;
+
+		pixels.resize(width * height);
+
+		UINT8* sourceBuffer = slot->bitmap.buffer;
+		UINT8* dstBuffer = pixels.data();
+
+		if (slot->bitmap.pixel_mode == ft_pixel_mode_grays)
+		{
+			for (UINT32 bitmapRow = 0; bitmapRow < height; bitmapRow++)
+			{
+				memcpy(dstBuffer, sourceBuffer, width);
+
+				dstBuffer += width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if (slot->bitmap.pixel_mode == ft_pixel_mode_mono)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for (UINT32 bitmapRow = 0; bitmapRow < height; bitmapRow++)
+			{
+				for (UINT32 bitmapColumn = 0; bitmapColumn < width; bitmapColumn++)
+				{
+					UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
+					dstBuffer[bitmapColumn] = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
+				}
+
+				dstBuffer += width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else
+		{
+			LOGWRN("Unsupported pixel mode for a FreeType bitmap.");
+			return false;
+		}
+
+		desc.charId = charId;
+		desc.page = 0;
+		desc.uvX = 0.0f;
+		desc.uvY = 0.0f;
+		desc.uvWidth = 0.0f;
+		desc.uvHeight = 0.0f;
+		desc.width = width;
+		desc.height = height;
+		desc.xOffset = slot->bitmap_left;
+		desc.yOffset = slot->bitmap_top;
+		desc.xAdvance = slot->advance.x >> 6;
+		desc.yAdvance = slot->advance.y >> 6;
+		desc.kerningPairs.clear();
+
+		return true;
+	}
+
+	INT32 FreeTypeGlyphRasterizer::getKerning(UINT32 firstCharId, UINT32 secondCharId)
+	{
+		if (mFace == nullptr || !FT_HAS_KERNING(mFace))
+			return 0;
+
+		FT_UInt firstGlyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)firstCharId);
+		FT_UInt secondGlyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)secondCharId);
+
+		FT_Vector kerning;
+		if (FT_Get_Kerning(mFace, firstGlyphIdx, secondGlyphIdx, FT_KERNING_DEFAULT, &kerning))
+			return 0;
+
+		return (INT32)(kerning.x >> 6); // Y kerning is ignored because it is so rare
+	}
+
+	SPtr<GlyphRasterizer> FreeTypeGlyphRasterizer::create(const DYNAMIC_FONT_DESC& desc, UINT32 size)
+	{
+		SPtr<FreeTypeGlyphRasterizer> rasterizer = bs_shared_ptr_new<FreeTypeGlyphRasterizer>(desc, size);
+		if (!rasterizer->isValid())
+			return nullptr;
+
+		return rasterizer;
+	}
+
+	INT32 FreeTypeGlyphRasterizer::getLoadFlags(FontRenderMode renderMode)
+	{
+		switch (renderMode)
+		{
+		case FontRenderMode::Smooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+		case FontRenderMode::Raster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
+		case FontRenderMode::HintedSmooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
+		case FontRenderMode::HintedRaster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
+		default:
+			return FT_LOAD_TARGET_NORMAL;
+		}
+	}
+}
@@ -161,7 +161,15 @@ namespace BansheeEngine
 
 		Vector<SPtr<PixelData>> mipLevels;
 		if (numMips > 0)
-			mipLevels = PixelUtil::genMipmaps(*imgData, MipMapGenOptions());
+		{
+			MipMapGenOptions mipOptions;
+			mipOptions.filter = textureImportOptions->getMipmapFilter();
+			mipOptions.isSRGB = sRGB;
+			mipOptions.preserveAlphaCoverage = textureImportOptions->getPreserveAlphaCoverage();
+			mipOptions.alphaCoverageCutoff = textureImportOptions->getAlphaCoverageCutoff();
+
+			mipLevels = PixelUtil::genMipmaps(*imgData, mipOptions);
+		}
 		else
 			mipLevels.insert(mipLevels.begin(), imgData);
 
@@ -18,6 +18,7 @@ set(BS_BANSHEEPHYSX_INC_NOFILTER
 	"Include/BsPhysXSphericalJoint.h"
 	"Include/BsPhysXD6Joint.h"
 	"Include/BsPhysXCharacterController.h"
+	"Include/BsPhysXCPUDispatcher.h"
 )
 
 set(BS_BANSHEEPHYSX_SRC_NOFILTER
@@ -40,6 +41,7 @@ set(BS_BANSHEEPHYSX_SRC_NOFILTER
 	"Source/BsPhysXSphericalJoint.cpp"
 	"Source/BsPhysXD6Joint.cpp"
 	"Source/BsPhysXCharacterController.cpp"
+	"Source/BsPhysXCPUDispatcher.cpp"
 )
 
 set(BS_BANSHEEPHYSX_INC_RTTI
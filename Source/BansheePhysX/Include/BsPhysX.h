@@ -5,6 +5,8 @@
 #include "BsPhysXPrerequisites.h"
 #include "BsPhysics.h"
 #include "BsPhysicsCommon.h"
+#include "BsSceneObject.h"
+#include "BsPhysXRigidbody.h"
 #include "PxPhysics.h"
 #include "foundation/Px.h"
 #include "characterkinematic\PxControllerManager.h"
@@ -58,6 +60,18 @@ namespace BansheeEngine
 		/** @copydoc Physics::update */
 		void update() override;
 
+		/** @copydoc Physics::_update */
+		void _update(float frameDelta) override;
+
+		/** @copydoc Physics::_getSimulationStep */
+		float _getSimulationStep() const override { return mSimulationStep; }
+
+		/** @copydoc Physics::_startAsyncStep */
+		void _startAsyncStep() override;
+
+		/** @copydoc Physics::_simulate */
+		void _simulate(float step) override;
+
 		/** @copydoc Physics::createMaterial */
 		SPtr<PhysicsMaterial> createMaterial(float staticFriction, float dynamicFriction, float restitution) override;
 
@@ -180,12 +194,27 @@ namespace BansheeEngine
 		bool convexOverlapAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
 			UINT64 layer = BS_ALL_LAYERS) const override;
 
+		/** @copydoc Physics::rayCastBatch */
+		UINT32 rayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const override;
+
+		/** @copydoc Physics::rayCastAnyBatch */
+		UINT32 rayCastAnyBatch(const PhysicsRayQuery* queries, UINT32 numQueries, bool* hits) const override;
+
+		/** @copydoc Physics::sweepBatch */
+		UINT32 sweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const override;
+
 		/** @copydoc Physics::setFlag */
 		void setFlag(PhysicsFlags flags, bool enabled) override;
 
 		/** @copydoc Physics::setPaused */
 		void setPaused(bool paused) override;
 
+		/** @copydoc Physics::setNumSimulationThreads */
+		void setNumSimulationThreads(UINT32 numThreads) override;
+
+		/** @copydoc Physics::getNumSimulationThreads */
+		UINT32 getNumSimulationThreads() const override;
+
 		/** @copydoc Physics::getGravity */
 		Vector3 getGravity() const override;
 
@@ -235,6 +264,18 @@ namespace BansheeEngine
 		/** Triggered by the PhysX simulation when a joint breaks. */
 		void _reportJointBreakEvent(const JointBreakEvent& event);
 
+		/** 
+		 * Stops interpolating the transform of the provided rigidbody, leaving it at its current transform. Should be
+		 * called when the rigidbody is moved externally or destroyed.
+		 */
+		void _stopInterpolation(PhysXRigidbody* rigidbody);
+
+		/** 
+		 * Waits until the asynchronous simulation step completes, if one is running. Should be called before making
+		 * changes that cannot be buffered by the scene while it is being simulated.
+		 */
+		void _waitForAsyncStep();
+
 		/** Returns the default PhysX material. */
 		physx::PxMaterial* getDefaultMaterial() const { return mDefaultMaterial; }
 
@@ -256,6 +297,35 @@ namespace BansheeEngine
 		/** Sends out all events recorded during simulation to the necessary physics objects. */
 		void triggerEvents();
 
+		/** 
+		 * Advances the simulation by the provided amount of time and waits for it to complete. Returns false if the
+		 * simulation failed.
+		 */
+		bool simulateStep(float step);
+
+		/** Updates rigidbodies moved during the last simulation step with their new transforms. */
+		void applyActiveTransforms();
+
+		/** Assigns transforms queued in the transform update buffer to their scene objects, and clears the buffer. */
+		void writeTransformUpdates();
+
+		/** 
+		 * Records transforms of rigidbodies moved during the last simulation step for interpolation. Rigidbodies that 
+		 * haven't moved are moved to their final transform and are no longer interpolated.
+		 *
+		 * @param[in]	stepEnd		Simulation time at the end of the step.
+		 */
+		void captureActiveTransforms(float stepEnd);
+
+		/** Moves interpolated rigidbodies to transforms corresponding to the current frame time. */
+		void interpolateTransforms();
+
+		/** Moves all interpolated rigidbodies to their most recently simulated transforms and stops interpolating them. */
+		void clearInterpolation();
+
+		/** Waits until the asynchronous simulation step completes, applies its results and triggers its events. */
+		void fetchAsyncStep();
+
 		/**
 		 * Helper method that performs a sweep query by checking if the provided geometry hits any physics objects
 		 * when moved along the specified direction. Returns information about the first hit.
@@ -285,6 +355,13 @@ namespace BansheeEngine
 		/** Helper method that checks if the provided geometry overlaps any physics object. */
 		inline bool overlapAny(const physx::PxGeometry& geometry, const physx::PxTransform& tfrm, UINT64 layer) const;
 
+		/** 
+		 * Executes @p func on ranges of a query batch with @p numQueries queries, in parallel if the batch is large 
+		 * enough. Returns the sum of hit counts returned by @p func.
+		 */
+		template<class T>
+		UINT32 executeQueryBatch(UINT32 numQueries, const T& func) const;
+
 		float mSimulationStep = 1.0f/60.0f;
 		float mSimulationTime = 0.0f;
 		float mFrameTime = 0.0f;
@@ -292,6 +369,18 @@ namespace BansheeEngine
 		UINT32 mNextRegionIdx = 1;
 		bool mPaused = false;
 
+		float mAsyncStepLength = 0.0f;
+		float mAsyncStepEnd = 0.0f;
+		bool mAsyncStepPending = false;
+		bool mAsyncStepRunning = false;
+		UINT8* mAsyncScratchBuffer = nullptr;
+
+		Vector<PhysXRigidbody*> mInterpolatedBodies;
+		Vector<SceneObjectTransformUpdate> mTransformUpdates; /**< Buffer reused for writing back rigidbody transforms. */
+		/** Simulation times of the transforms recorded by interpolated rigidbodies, oldest first. */
+		float mInterpolationTimes[PhysXRigidbody::NUM_INTERPOLATION_POSES] = { };
+		UINT32 mInterpolationStamp = 0;
+
 		Vector<TriggerEvent> mTriggerEvents;
 		Vector<ContactEvent> mContactEvents;
 		Vector<JointBreakEvent> mJointBreakEvents;
@@ -309,6 +398,8 @@ namespace BansheeEngine
 		static const UINT32 SCRATCH_BUFFER_SIZE;
 		/** Determines how many physics updates per frame are allowed. Only relevant when framerate is low. */
 		static const UINT32 MAX_ITERATIONS_PER_FRAME;
+		/** Number of queries of a batched query executed by a single job. */
+		static const UINT32 QUERY_BATCH_GRANULARITY;
 	};
 
 	/** Provides easier access to PhysX. */
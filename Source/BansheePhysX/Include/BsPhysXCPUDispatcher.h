@@ -0,0 +1,106 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPhysXPrerequisites.h"
+#include "task/PxCpuDispatcher.h"
+#include "task/PxTask.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup PhysX
+	 *  @{
+	 */
+
+	/**
+	 * Fixed size multi-producer multi-consumer queue of PhysX tasks. Doesn't allocate memory when tasks are pushed or
+	 * popped.
+	 */
+	class PhysXTaskQueue
+	{
+	public:
+		static const UINT32 CAPACITY = 1024;
+
+		PhysXTaskQueue();
+
+		/** Pushes a task to the end of the queue. Returns false if the queue is full. */
+		bool push(physx::PxBaseTask* task);
+
+		/** Pops a task from the start of the queue, or returns null if the queue is empty. */
+		physx::PxBaseTask* pop();
+
+	private:
+		/** Slot in the queue. Sequence number determines whether the slot is ready to be written to or read from. */
+		struct Cell
+		{
+			std::atomic<UINT32> sequence;
+			physx::PxBaseTask* task;
+		};
+
+		Cell mCells[CAPACITY];
+		UINT8 mPadding0[64];
+		std::atomic<UINT32> mPushPos;
+		UINT8 mPadding1[64];
+		std::atomic<UINT32> mPopPos;
+	};
+
+	/**
+	 * Executes tasks submitted by the PhysX simulation. By default tasks are queued on the global TaskScheduler, but a
+	 * fixed number of threads may be dedicated to running the tasks instead. Dedicated threads have their own task queues
+	 * and don't allocate any memory per task.
+	 */
+	class PhysXCPUDispatcher : public physx::PxCpuDispatcher
+	{
+	public:
+		PhysXCPUDispatcher();
+		~PhysXCPUDispatcher();
+
+		/** @copydoc physx::PxCpuDispatcher::submitTask */
+		void submitTask(physx::PxBaseTask& task) override;
+
+		/** @copydoc physx::PxCpuDispatcher::getWorkerCount */
+		physx::PxU32 getWorkerCount() const override;
+
+		/**
+		 * Changes the number of threads dedicated to running PhysX tasks. If zero, tasks are queued on the global
+		 * TaskScheduler.
+		 *
+		 * @note	Must not be called while simulation is running.
+		 */
+		void setNumWorkers(UINT32 numWorkers);
+
+		/** Returns the number of threads dedicated to running PhysX tasks. Zero if running on the TaskScheduler. */
+		UINT32 getNumWorkers() const { return (UINT32)mWorkers.size(); }
+
+	private:
+		/** Thread dedicated to running PhysX tasks, along with its task queue. */
+		struct Worker
+		{
+			PhysXTaskQueue queue;
+			Thread thread;
+		};
+
+		/** Main method of a dedicated worker thread. Executes tasks until the workers are stopped. */
+		void runWorker(UINT32 idx);
+
+		/** Attempts to find a task to execute, checking the worker's own queue and then the queues of other workers. */
+		physx::PxBaseTask* findTask(UINT32 idx);
+
+		/** Stops and destroys all dedicated worker threads. */
+		void stopWorkers();
+
+		/** Number of times an idle worker checks for new tasks before it goes to sleep. */
+		static const UINT32 NUM_SPIN_ITERATIONS;
+
+		Vector<Worker*> mWorkers;
+		std::atomic<UINT32> mNextQueueIdx;
+		std::atomic<INT32> mNumQueuedTasks;
+		std::atomic<UINT32> mNumSleepingWorkers;
+		std::atomic<bool> mShutdown;
+
+		Mutex mSleepMutex;
+		Signal mSleepCond;
+	};
+
+	/** @} */
+}
@@ -158,7 +158,36 @@ namespace BansheeEngine
 		physx::PxRigidDynamic* _getInternal() const { return mInternal; }
 
 	private:
+		friend class PhysX;
+
+		/** Number of most recent simulation step results recorded for interpolation. */
+		static const UINT32 NUM_INTERPOLATION_POSES = 3;
+
+		/** 
+		 * Records the transform resulting from the most recent simulation step, discarding the oldest recorded transform.
+		 * If the rigidbody isn't being interpolated, all older transforms are set to the current scene object transform.
+		 */
+		void setInterpolationTarget(const Vector3& position, const Quaternion& rotation);
+
+		/** Moves the rigidbody's scene object to the most recently recorded transform. */
+		void applyLatestPose();
+
+		/** 
+		 * Calculates a transform between two consecutive recorded transforms.
+		 *
+		 * @param[in]	idx			Index of the older of the two transforms, where 0 is the oldest recorded transform.
+		 * @param[in]	t			Interpolation factor in [0, 1] range, where 1 represents the transform at @p idx + 1.
+		 * @param[out]	position	Interpolated world position.
+		 * @param[out]	rotation	Interpolated world rotation.
+		 */
+		void evaluateInterpolation(UINT32 idx, float t, Vector3& position, Quaternion& rotation) const;
+
 		physx::PxRigidDynamic* mInternal;
+
+		Vector3 mPositions[NUM_INTERPOLATION_POSES]; /**< Recorded simulation step results, oldest first. */
+		Quaternion mRotations[NUM_INTERPOLATION_POSES];
+		UINT32 mInterpolationIdx = (UINT32)-1; /**< Index in the list of bodies interpolated by PhysX, if any. */
+		UINT32 mInterpolationStamp = 0; /**< Simulation step during which the interpolation target was last set. */
 	};
 
 	/** @} */
@@ -15,6 +15,7 @@
 #include "BsPhysXSliderJoint.h"
 #include "BsPhysXD6Joint.h"
 #include "BsPhysXCharacterController.h"
+#include "BsPhysXCPUDispatcher.h"
 #include "BsTaskScheduler.h"
 #include "BsCCollider.h"
 #include "BsFPhysXCollider.h"
@@ -282,28 +283,6 @@ namespace BansheeEngine
 		}
 	};
 
-	class PhysXCPUDispatcher : public PxCpuDispatcher
-	{
-	public:
-		void submitTask(PxBaseTask& physxTask) override
-		{
-			// Note: Banshee's task scheduler is pretty low granularity. Consider a better task manager in case PhysX ends
-			// up submitting many tasks.
-			// - PhysX's task manager doesn't seem much lighter either. But perhaps I can at least create a task pool to 
-			//   avoid allocating them constantly.
-
-			auto runTask = [&]() { physxTask.run(); physxTask.release(); };
-			SPtr<Task> task = Task::create("PhysX", runTask);
-
-			TaskScheduler::instance().addTask(task);
-		}
-
-		PxU32 getWorkerCount() const override
-		{
-			return (PxU32)TaskScheduler::instance().getNumWorkers();
-		}
-	};
-
 	class PhysXBroadPhaseCallback : public PxBroadPhaseCallback
 	{
 		void onObjectOutOfBounds(PxShape& shape, PxActor& actor) override
@@ -458,6 +437,7 @@ namespace BansheeEngine
 	static const UINT32 SIZE_16K = 1 << 14;
 	const UINT32 PhysX::SCRATCH_BUFFER_SIZE = SIZE_16K * 64; // 1MB by default
 	const UINT32 PhysX::MAX_ITERATIONS_PER_FRAME = 4; // At 60 physics updates per second this would mean user is running at 15fps
+	const UINT32 PhysX::QUERY_BATCH_GRANULARITY = 64;
 
 	PhysX::PhysX(const PHYSICS_INIT_DESC& input)
 		:Physics(input)
@@ -500,6 +480,8 @@ namespace BansheeEngine
 		// Character controller
 		mCharManager = PxCreateControllerManager(*mScene);
 
+		gPhysXCPUDispatcher.setNumWorkers(input.numSimulationThreads);
+
 		mSimulationStep = input.timeStep;
 		mSimulationTime = -mSimulationStep * 1.01f; // Ensures simulation runs on the first frame
 		mDefaultMaterial = mPhysics->createMaterial(0.0f, 0.0f, 0.0f);
@@ -507,6 +489,15 @@ namespace BansheeEngine
 
 	PhysX::~PhysX()
 	{
+		if (mAsyncStepRunning)
+			mScene->fetchResults(true);
+
+		if (mAsyncScratchBuffer != nullptr)
+			bs_free_aligned16(mAsyncScratchBuffer);
+
+		for (auto& rigidbody : mInterpolatedBodies)
+			rigidbody->mInterpolationIdx = (UINT32)-1;
+
 		mCharManager->release();
 		mScene->release();
 
@@ -515,24 +506,46 @@ namespace BansheeEngine
 
 		mPhysics->release();
 		mFoundation->release();
+
+		gPhysXCPUDispatcher.setNumWorkers(0);
 	}
 
 	void PhysX::update()
 	{
 		if (mPaused)
+		{
+			// Retrieve results of a step started before the simulation was paused
+			_waitForAsyncStep();
 			return;
+		}
 
-		mUpdateInProgress = true;
+		_update(gTime().getFrameDelta());
+	}
+
+	void PhysX::_update(float frameDelta)
+	{
+		// Retrieve results of the step started at the end of the previous frame
+		_waitForAsyncStep();
+
+		bool async = mFlags.isSet(PhysicsFlag::AsyncSimulation);
 
 		float nextFrameTime = mSimulationTime + mSimulationStep;
-		mFrameTime += gTime().getFrameDelta();
+		mFrameTime += frameDelta;
 
 		if(mFrameTime < nextFrameTime)
 		{
-			// Note: Potentially interpolate (would mean a one frame delay needs to be introduced)
+			if (async)
+			{
+				mUpdateInProgress = true;
+				interpolateTransforms();
+				mUpdateInProgress = false;
+			}
+
 			return;
 		}
 
+		mUpdateInProgress = true;
+
 		float simulationAmount = std::max(mFrameTime - mSimulationTime, mSimulationStep); // At least one step
 		INT32 numIterations = Math::floorToInt(simulationAmount / mSimulationStep);
 
@@ -545,59 +558,250 @@ namespace BansheeEngine
 		UINT32 iterationCount = 0;
 		while (simulationAmount >= step) // In case we're running really slow multiple updates might be needed
 		{
-			// Note: Consider delaying fetchResults one frame. This could improve performance because Physics update would be
-			//       able to run parallel to the simulation thread, but at a cost to input latency.
-
-			bs_frame_mark();
-			UINT8* scratchBuffer = bs_frame_alloc_aligned(SCRATCH_BUFFER_SIZE, 16);
-
-			mScene->simulate(step, nullptr, scratchBuffer, SCRATCH_BUFFER_SIZE);
-			simulationAmount -= step;
-			mSimulationTime += step;
-
-			UINT32 errorState;
-			if(!mScene->fetchResults(true, &errorState))
+			// In async mode the last step is started at the end of the frame, and its results fetched next frame
+			if (async && (simulationAmount - step) < step)
 			{
-				LOGWRN("Physics simulation failed. Error code: " + toString(errorState));
+				mAsyncStepLength = step;
+				mAsyncStepPending = true;
 
-				bs_frame_free_aligned(scratchBuffer);
-				bs_frame_clear();
+				simulationAmount -= step;
+				mSimulationTime += step;
+				mAsyncStepEnd = mSimulationTime;
 
 				iterationCount++;
-				continue;
+				break;
 			}
 
-			bs_frame_free_aligned(scratchBuffer);
-			bs_frame_clear();
+			bool success = simulateStep(step);
+			simulationAmount -= step;
+			mSimulationTime += step;
+
+			if (success && async)
+				captureActiveTransforms(mSimulationTime);
 
 			iterationCount++;
 		}
 
-		// Update rigidbodies with new transforms
+		if (async)
+			interpolateTransforms();
+		else
+			applyActiveTransforms();
+
+		mUpdateInProgress = false;
+
+		triggerEvents();
+	}
+
+	void PhysX::_simulate(float step)
+	{
+		_waitForAsyncStep();
+
+		clearInterpolation();
+
+		mUpdateInProgress = true;
+
+		if (simulateStep(step))
+			applyActiveTransforms();
+
+		mUpdateInProgress = false;
+
+		triggerEvents();
+	}
+
+	bool PhysX::simulateStep(float step)
+	{
+		bs_frame_mark();
+		UINT8* scratchBuffer = bs_frame_alloc_aligned(SCRATCH_BUFFER_SIZE, 16);
+
+		mScene->simulate(step, nullptr, scratchBuffer, SCRATCH_BUFFER_SIZE);
+
+		UINT32 errorState;
+		bool success = mScene->fetchResults(true, &errorState);
+		if (!success)
+			LOGWRN("Physics simulation failed. Error code: " + toString(errorState));
+
+		bs_frame_free_aligned(scratchBuffer);
+		bs_frame_clear();
+
+		return success;
+	}
+
+	void PhysX::_startAsyncStep()
+	{
+		if (!mAsyncStepPending)
+			return;
+
+		if (mAsyncScratchBuffer == nullptr)
+			mAsyncScratchBuffer = (UINT8*)bs_alloc_aligned16(SCRATCH_BUFFER_SIZE);
+
+		mScene->simulate(mAsyncStepLength, nullptr, mAsyncScratchBuffer, SCRATCH_BUFFER_SIZE);
+
+		mAsyncStepPending = false;
+		mAsyncStepRunning = true;
+	}
+
+	void PhysX::_waitForAsyncStep()
+	{
+		if (mAsyncStepRunning)
+			fetchAsyncStep();
+	}
+
+	void PhysX::fetchAsyncStep()
+	{
+		mUpdateInProgress = true;
+
+		UINT32 errorState;
+		if (mScene->fetchResults(true, &errorState))
+			captureActiveTransforms(mAsyncStepEnd);
+		else
+			LOGWRN("Physics simulation failed. Error code: " + toString(errorState));
+
+		mAsyncStepRunning = false;
+		mUpdateInProgress = false;
+
+		triggerEvents();
+	}
+
+	void PhysX::applyActiveTransforms()
+	{
 		PxU32 numActiveTransforms;
 		const PxActiveTransform* activeTransforms = mScene->getActiveTransforms(numActiveTransforms);
 
+		mTransformUpdates.clear();
+		mTransformUpdates.reserve(numActiveTransforms);
+
 		for (PxU32 i = 0; i < numActiveTransforms; i++)
 		{
-			Rigidbody* rigidbody = static_cast<Rigidbody*>(activeTransforms[i].userData);
-
 			// Note: This should never happen, as actors gets their userData set to null when they're destroyed. However
 			// in some cases PhysX seems to keep those actors alive for a frame or few, and reports their state here. Until
 			// I find out why I need to perform this check.
 			if(activeTransforms[i].actor->userData == nullptr)
 				continue;
 
+			PhysXRigidbody* rigidbody = static_cast<PhysXRigidbody*>(activeTransforms[i].userData);
 			const PxTransform& transform = activeTransforms[i].actor2World;
 
-			// Note: Make this faster, avoid dereferencing Rigidbody and attempt to access pos/rot destination directly,
-			//       use non-temporal writes
-			rigidbody->_setTransform(fromPxVector(transform.p), fromPxQuaternion(transform.q));
+			mTransformUpdates.push_back(
+				{ rigidbody->mLinkedSO.get(), fromPxVector(transform.p), fromPxQuaternion(transform.q) });
 		}
 
-		// Note: Consider extrapolating for the remaining "simulationAmount" value
+		writeTransformUpdates();
+	}
+
+	void PhysX::writeTransformUpdates()
+	{
+		SceneObject::_setWorldTransforms(mTransformUpdates.data(), (UINT32)mTransformUpdates.size(), true);
+		mTransformUpdates.clear();
+	}
+
+	void PhysX::captureActiveTransforms(float stepEnd)
+	{
+		mInterpolationStamp++;
+
+		PxU32 numActiveTransforms;
+		const PxActiveTransform* activeTransforms = mScene->getActiveTransforms(numActiveTransforms);
+
+		for (PxU32 i = 0; i < numActiveTransforms; i++)
+		{
+			// See applyActiveTransforms()
+			if(activeTransforms[i].actor->userData == nullptr)
+				continue;
+
+			PhysXRigidbody* rigidbody = static_cast<PhysXRigidbody*>(activeTransforms[i].userData);
+			const PxTransform& transform = activeTransforms[i].actor2World;
+
+			rigidbody->setInterpolationTarget(fromPxVector(transform.p), fromPxQuaternion(transform.q));
+			rigidbody->mInterpolationStamp = mInterpolationStamp;
+
+			if (rigidbody->mInterpolationIdx == (UINT32)-1)
+			{
+				rigidbody->mInterpolationIdx = (UINT32)mInterpolatedBodies.size();
+				mInterpolatedBodies.push_back(rigidbody);
+			}
+		}
+
+		// Bodies that didn't move during this step have come to rest
+		for (UINT32 i = 0; i < (UINT32)mInterpolatedBodies.size();)
+		{
+			PhysXRigidbody* rigidbody = mInterpolatedBodies[i];
+			if (rigidbody->mInterpolationStamp == mInterpolationStamp)
+			{
+				i++;
+				continue;
+			}
+
+			rigidbody->applyLatestPose();
+			_stopInterpolation(rigidbody);
+		}
+
+		static const UINT32 LAST = PhysXRigidbody::NUM_INTERPOLATION_POSES - 1;
+		for (UINT32 i = 0; i < LAST; i++)
+			mInterpolationTimes[i] = mInterpolationTimes[i + 1];
+
+		mInterpolationTimes[LAST] = stepEnd;
+	}
+
+	void PhysX::interpolateTransforms()
+	{
+		if (mInterpolatedBodies.empty())
+			return;
+
+		// Bodies are displayed two steps behind the frame time. After update() the frame time F and the end of the last
+		// scheduled step S satisfy S <= F < S + step. On frames that start a step its results aren't available yet, so
+		// the latest result is at S - step and F can be up to two steps ahead of it. On other frames the latest result
+		// is at S, less than one step behind F. Two steps is therefore the smallest constant delay that never displays
+		// a time past the latest result, and a constant delay is required for motion to stay smooth. Results of three
+		// steps are kept so the displayed time always falls between two of them.
+		static const UINT32 LAST = PhysXRigidbody::NUM_INTERPOLATION_POSES - 1;
+		float displayTime = mFrameTime - 2.0f * mSimulationStep;
+
+		UINT32 idx = 0;
+		while (idx < (LAST - 1) && displayTime > mInterpolationTimes[idx + 1])
+			idx++;
+
+		float start = mInterpolationTimes[idx];
+		float end = mInterpolationTimes[idx + 1];
+		float t = end > start ? Math::clamp01((displayTime - start) / (end - start)) : 1.0f;
+
+		mTransformUpdates.resize(mInterpolatedBodies.size());
+		for (UINT32 i = 0; i < (UINT32)mInterpolatedBodies.size(); i++)
+		{
+			PhysXRigidbody* rigidbody = mInterpolatedBodies[i];
+			SceneObjectTransformUpdate& update = mTransformUpdates[i];
+
+			update.sceneObject = rigidbody->mLinkedSO.get();
+			rigidbody->evaluateInterpolation(idx, t, update.position, update.rotation);
+		}
+
+		writeTransformUpdates();
+	}
+
+	void PhysX::clearInterpolation()
+	{
+		mUpdateInProgress = true;
+
+		for (auto& rigidbody : mInterpolatedBodies)
+		{
+			rigidbody->applyLatestPose();
+			rigidbody->mInterpolationIdx = (UINT32)-1;
+		}
+
+		mInterpolatedBodies.clear();
 		mUpdateInProgress = false;
+	}
 
-		triggerEvents();
+	void PhysX::_stopInterpolation(PhysXRigidbody* rigidbody)
+	{
+		UINT32 idx = rigidbody->mInterpolationIdx;
+		if (idx == (UINT32)-1)
+			return;
+
+		PhysXRigidbody* last = mInterpolatedBodies.back();
+		mInterpolatedBodies[idx] = last;
+		last->mInterpolationIdx = idx;
+
+		mInterpolatedBodies.pop_back();
+		rigidbody->mInterpolationIdx = (UINT32)-1;
 	}
 
 	void PhysX::_reportContactEvent(const ContactEvent& event)
@@ -1138,10 +1342,149 @@ namespace BansheeEngine
 		return output.data;
 	}
 
+	template<class T>
+	UINT32 PhysX::executeQueryBatch(UINT32 numQueries, const T& func) const
+	{
+		if (numQueries <= QUERY_BATCH_GRANULARITY || !TaskScheduler::isStarted())
+			return func(0, numQueries);
+
+		std::atomic<UINT32> numHits(0);
+		TaskScheduler::instance().parallelFor(0, numQueries, QUERY_BATCH_GRANULARITY, 
+			[&](UINT32 begin, UINT32 end)
+		{
+			numHits.fetch_add(func(begin, end), std::memory_order_relaxed);
+		});
+
+		return numHits.load();
+	}
+
+	UINT32 PhysX::rayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const
+	{
+		// Misses share a single empty handle, as creating one allocates
+		HCollider emptyHandle;
+
+		auto castRays = [&](UINT32 begin, UINT32 end)
+		{
+			UINT32 numHits = 0;
+			for (UINT32 i = begin; i < end; i++)
+			{
+				const PhysicsRayQuery& query = queries[i];
+
+				PhysicsQueryHit& hit = hits[i];
+				hit.colliderRaw = nullptr;
+				hit.collider = emptyHandle;
+
+				PxRaycastBuffer output;
+
+				PxQueryFilterData filterData;
+				memcpy(&filterData.data.word0, &query.layer, sizeof(query.layer));
+
+				if (mScene->raycast(toPxVector(query.origin), toPxVector(query.unitDir), query.max, output,
+					PxHitFlag::eDEFAULT | PxHitFlag::eUV, filterData))
+				{
+					parseHit(output.block, hit);
+					numHits++;
+				}
+			}
+
+			return numHits;
+		};
+
+		return executeQueryBatch(numQueries, castRays);
+	}
+
+	UINT32 PhysX::rayCastAnyBatch(const PhysicsRayQuery* queries, UINT32 numQueries, bool* hits) const
+	{
+		auto castRays = [&](UINT32 begin, UINT32 end)
+		{
+			UINT32 numHits = 0;
+			for (UINT32 i = begin; i < end; i++)
+			{
+				const PhysicsRayQuery& query = queries[i];
+
+				PxRaycastBuffer output;
+
+				PxQueryFilterData filterData;
+				filterData.flags |= PxQueryFlag::eANY_HIT;
+				memcpy(&filterData.data.word0, &query.layer, sizeof(query.layer));
+
+				hits[i] = mScene->raycast(toPxVector(query.origin), toPxVector(query.unitDir), query.max, output,
+					PxHitFlag::eDEFAULT | PxHitFlag::eMESH_ANY, filterData);
+
+				if (hits[i])
+					numHits++;
+			}
+
+			return numHits;
+		};
+
+		return executeQueryBatch(numQueries, castRays);
+	}
+
+	UINT32 PhysX::sweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits) const
+	{
+		// Misses share a single empty handle, as creating one allocates
+		HCollider emptyHandle;
+
+		auto sweepShapes = [&](UINT32 begin, UINT32 end)
+		{
+			UINT32 numHits = 0;
+			for (UINT32 i = begin; i < end; i++)
+			{
+				const PhysicsSweepQuery& query = queries[i];
+
+				PhysicsQueryHit& hit = hits[i];
+				hit.colliderRaw = nullptr;
+				hit.collider = emptyHandle;
+
+				PxTransform transform = toPxTransform(query.position, query.rotation);
+
+				bool wasHit = false;
+				switch (query.shape)
+				{
+				case PhysicsSweepShape::Sphere:
+					wasHit = sweep(PxSphereGeometry(query.radius), transform, query.unitDir, hit, query.layer, 
+						query.max);
+					break;
+				case PhysicsSweepShape::Box:
+					wasHit = sweep(PxBoxGeometry(toPxVector(query.halfExtents)), transform, query.unitDir, hit, 
+						query.layer, query.max);
+					break;
+				case PhysicsSweepShape::Capsule:
+					wasHit = sweep(PxCapsuleGeometry(query.radius, query.halfHeight), transform, query.unitDir, hit,
+						query.layer, query.max);
+					break;
+				}
+
+				if (wasHit)
+					numHits++;
+			}
+
+			return numHits;
+		};
+
+		return executeQueryBatch(numQueries, sweepShapes);
+	}
+
 	void PhysX::setFlag(PhysicsFlags flag, bool enabled)
 	{
 		Physics::setFlag(flag, enabled);
 
+		// Character controller options cannot change while the simulation is running
+		_waitForAsyncStep();
+
+		if (!mFlags.isSet(PhysicsFlag::AsyncSimulation))
+		{
+			// Step was scheduled but not yet started, leave it for the next synchronous update
+			if (mAsyncStepPending)
+			{
+				mSimulationTime -= mAsyncStepLength;
+				mAsyncStepPending = false;
+			}
+
+			clearInterpolation();
+		}
+
 		mCharManager->setOverlapRecoveryModule(mFlags.isSet(PhysicsFlag::CCT_OverlapRecovery));
 		mCharManager->setPreciseSweeps(mFlags.isSet(PhysicsFlag::CCT_PreciseSweeps));
 		mCharManager->setTessellation(mFlags.isSet(PhysicsFlag::CCT_Tesselation), mTesselationLength);
@@ -1152,6 +1495,19 @@ namespace BansheeEngine
 		mPaused = paused;
 	}
 
+	void PhysX::setNumSimulationThreads(UINT32 numThreads)
+	{
+		// Dispatcher threads cannot change while the simulation is running
+		_waitForAsyncStep();
+
+		gPhysXCPUDispatcher.setNumWorkers(numThreads);
+	}
+
+	UINT32 PhysX::getNumSimulationThreads() const
+	{
+		return gPhysXCPUDispatcher.getNumWorkers();
+	}
+
 	Vector3 PhysX::getGravity() const
 	{
 		return fromPxVector(mScene->getGravity());
@@ -1166,6 +1522,7 @@ namespace BansheeEngine
 	{
 		mTesselationLength = length;
 
+		_waitForAsyncStep();
 		mCharManager->setTessellation(mFlags.isSet(PhysicsFlag::CCT_Tesselation), mTesselationLength);
 	}
 
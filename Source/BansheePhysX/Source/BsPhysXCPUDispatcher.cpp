@@ -0,0 +1,231 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsPhysXCPUDispatcher.h"
+#include "BsTaskScheduler.h"
+
+using namespace physx;
+
+namespace BansheeEngine
+{
+	/** Index of the dedicated PhysX worker the current thread belongs to, or -1 if it is not a PhysX worker. */
+	static BS_THREADLOCAL UINT32 gPhysXWorkerIdx = (UINT32)-1;
+
+	const UINT32 PhysXCPUDispatcher::NUM_SPIN_ITERATIONS = 1000;
+
+	PhysXTaskQueue::PhysXTaskQueue()
+		:mPushPos(0), mPopPos(0)
+	{
+		for (UINT32 i = 0; i < CAPACITY; i++)
+		{
+			mCells[i].sequence.store(i, std::memory_order_relaxed);
+			mCells[i].task = nullptr;
+		}
+	}
+
+	bool PhysXTaskQueue::push(PxBaseTask* task)
+	{
+		Cell* cell;
+		UINT32 pos = mPushPos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			cell = &mCells[pos & (CAPACITY - 1)];
+			UINT32 sequence = cell->sequence.load(std::memory_order_acquire);
+			INT32 diff = (INT32)(sequence - pos);
+
+			if (diff == 0)
+			{
+				if (mPushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0) // Full
+				return false;
+			else
+				pos = mPushPos.load(std::memory_order_relaxed);
+		}
+
+		cell->task = task;
+		cell->sequence.store(pos + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	PxBaseTask* PhysXTaskQueue::pop()
+	{
+		Cell* cell;
+		UINT32 pos = mPopPos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			cell = &mCells[pos & (CAPACITY - 1)];
+			UINT32 sequence = cell->sequence.load(std::memory_order_acquire);
+			INT32 diff = (INT32)(sequence - (pos + 1));
+
+			if (diff == 0)
+			{
+				if (mPopPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0) // Empty
+				return nullptr;
+			else
+				pos = mPopPos.load(std::memory_order_relaxed);
+		}
+
+		PxBaseTask* task = cell->task;
+		cell->sequence.store(pos + CAPACITY, std::memory_order_release);
+
+		return task;
+	}
+
+	PhysXCPUDispatcher::PhysXCPUDispatcher()
+		:mNextQueueIdx(0), mNumQueuedTasks(0), mNumSleepingWorkers(0), mShutdown(false)
+	{ }
+
+	PhysXCPUDispatcher::~PhysXCPUDispatcher()
+	{
+		stopWorkers();
+	}
+
+	void PhysXCPUDispatcher::submitTask(PxBaseTask& physxTask)
+	{
+		if (mWorkers.empty())
+		{
+			auto runTask = [&]() { physxTask.run(); physxTask.release(); };
+			SPtr<Task> task = Task::create("PhysX", runTask);
+
+			TaskScheduler::instance().addTask(task);
+			return;
+		}
+
+		// Tasks submitted by workers go to their own queue, as they likely operate on data the worker just touched
+		UINT32 queueIdx = gPhysXWorkerIdx;
+		if (queueIdx == (UINT32)-1)
+			queueIdx = mNextQueueIdx.fetch_add(1, std::memory_order_relaxed) % (UINT32)mWorkers.size();
+
+		// Increment before the task becomes visible, so the counter never goes negative
+		mNumQueuedTasks.fetch_add(1);
+		if (!mWorkers[queueIdx]->queue.push(&physxTask))
+		{
+			mNumQueuedTasks.fetch_sub(1);
+
+			physxTask.run();
+			physxTask.release();
+			return;
+		}
+
+		if (mNumSleepingWorkers.load() > 0)
+		{
+			Lock lock(mSleepMutex);
+			mSleepCond.notify_one();
+		}
+	}
+
+	PxU32 PhysXCPUDispatcher::getWorkerCount() const
+	{
+		if (mWorkers.empty())
+			return (PxU32)TaskScheduler::instance().getNumWorkers();
+
+		return (PxU32)mWorkers.size();
+	}
+
+	void PhysXCPUDispatcher::setNumWorkers(UINT32 numWorkers)
+	{
+		if (numWorkers == (UINT32)mWorkers.size())
+			return;
+
+		stopWorkers();
+
+		mShutdown = false;
+		for (UINT32 i = 0; i < numWorkers; i++)
+			mWorkers.push_back(bs_new<Worker>());
+
+		// All queues need to exist before any worker starts, as workers look for tasks in each other's queues. Workers run
+		// on their own threads rather than on the ThreadPool, as they are persistent and the pool's capacity is limited.
+		for (UINT32 i = 0; i < numWorkers; i++)
+			mWorkers[i]->thread = Thread(std::bind(&PhysXCPUDispatcher::runWorker, this, i));
+	}
+
+	void PhysXCPUDispatcher::runWorker(UINT32 idx)
+	{
+		ThreadBansheePolicy::onThreadStarted("PhysXWorker");
+		gPhysXWorkerIdx = idx;
+
+		UINT32 numIdleIterations = 0;
+		while (true)
+		{
+			PxBaseTask* task = findTask(idx);
+			if (task != nullptr)
+			{
+				task->run();
+				task->release();
+
+				numIdleIterations = 0;
+				continue;
+			}
+
+			// PhysX submits tasks in bursts, so keep checking for a while before going to sleep
+			if (numIdleIterations < NUM_SPIN_ITERATIONS)
+			{
+				numIdleIterations++;
+				std::this_thread::yield();
+
+				if (!mShutdown.load())
+					continue;
+			}
+
+			Lock lock(mSleepMutex);
+			if (mShutdown.load())
+				break;
+
+			mNumSleepingWorkers++;
+
+			while (mNumQueuedTasks.load() == 0 && !mShutdown.load())
+				mSleepCond.wait(lock);
+
+			mNumSleepingWorkers--;
+			numIdleIterations = 0;
+		}
+
+		gPhysXWorkerIdx = (UINT32)-1;
+		ThreadBansheePolicy::onThreadEnded("PhysXWorker");
+	}
+
+	PxBaseTask* PhysXCPUDispatcher::findTask(UINT32 idx)
+	{
+		if (mNumQueuedTasks.load() == 0)
+			return nullptr;
+
+		UINT32 numWorkers = (UINT32)mWorkers.size();
+		for (UINT32 i = 0; i < numWorkers; i++)
+		{
+			PxBaseTask* task = mWorkers[(idx + i) % numWorkers]->queue.pop();
+			if (task != nullptr)
+			{
+				mNumQueuedTasks.fetch_sub(1);
+				return task;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void PhysXCPUDispatcher::stopWorkers()
+	{
+		if (mWorkers.empty())
+			return;
+
+		{
+			Lock lock(mSleepMutex);
+			mShutdown = true;
+		}
+
+		mSleepCond.notify_all();
+
+		for (auto& worker : mWorkers)
+			worker->thread.join();
+
+		for (auto& worker : mWorkers)
+			bs_delete(worker);
+
+		mWorkers.clear();
+	}
+}
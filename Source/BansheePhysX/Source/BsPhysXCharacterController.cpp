@@ -71,12 +71,16 @@ namespace BansheeEngine
 		pxDesc.reportCallback = this;
 		pxDesc.material = gPhysX().getDefaultMaterial();
 
+		// Controllers cannot be added, removed or moved while the simulation is running
+		gPhysX()._waitForAsyncStep();
 		mController = static_cast<PxCapsuleController*>(manager->createController(pxDesc));
 		mController->setUserData(this);
 	}
 
 	PhysXCharacterController::~PhysXCharacterController()
 	{
+		gPhysX()._waitForAsyncStep();
+
 		mController->setUserData(nullptr);
 		mController->release();
 	}
@@ -92,6 +96,7 @@ namespace BansheeEngine
 		float delta = curTime - mLastMoveCall;
 		mLastMoveCall = curTime;
 
+		gPhysX()._waitForAsyncStep();
 		PxControllerCollisionFlags collisionFlag = mController->move(toPxVector(displacement), mMinMoveDistance, delta, filters);
 
 		CharacterCollisionFlags output;
@@ -114,6 +119,7 @@ namespace BansheeEngine
 
 	void PhysXCharacterController::setPosition(const Vector3& position)
 	{
+		gPhysX()._waitForAsyncStep();
 		mController->setPosition(toPxExtVector(position));
 	}
 
@@ -124,6 +130,7 @@ namespace BansheeEngine
 
 	void PhysXCharacterController::setFootPosition(const Vector3& position)
 	{
+		gPhysX()._waitForAsyncStep();
 		mController->setFootPosition(toPxExtVector(position));
 	}
 
@@ -134,6 +141,7 @@ namespace BansheeEngine
 
 	void PhysXCharacterController::setRadius(float radius)
 	{
+		gPhysX()._waitForAsyncStep();
 		mController->setRadius(radius);
 	}
 
@@ -144,6 +152,7 @@ namespace BansheeEngine
 
 	void PhysXCharacterController::setHeight(float height)
 	{
+		gPhysX()._waitForAsyncStep();
 		mController->setHeight(height);
 	}
 
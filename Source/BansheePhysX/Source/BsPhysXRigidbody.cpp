@@ -55,12 +55,18 @@ namespace BansheeEngine
 
 	PhysXRigidbody::~PhysXRigidbody()
 	{
+		if (mInterpolationIdx != (UINT32)-1)
+			gPhysX()._stopInterpolation(this);
+
 		mInternal->userData = nullptr;
 		mInternal->release();
 	}
 
 	void PhysXRigidbody::move(const Vector3& position)
 	{
+		if (mInterpolationIdx != (UINT32)-1)
+			gPhysX()._stopInterpolation(this);
+
 		if (getIsKinematic())
 		{
 			PxTransform target;
@@ -79,6 +85,9 @@ namespace BansheeEngine
 
 	void PhysXRigidbody::rotate(const Quaternion& rotation)
 	{
+		if (mInterpolationIdx != (UINT32)-1)
+			gPhysX()._stopInterpolation(this);
+
 		if (getIsKinematic())
 		{
 			PxTransform target;
@@ -107,6 +116,9 @@ namespace BansheeEngine
 
 	void PhysXRigidbody::setTransform(const Vector3& pos, const Quaternion& rot)
 	{
+		if (mInterpolationIdx != (UINT32)-1)
+			gPhysX()._stopInterpolation(this);
+
 		mInternal->setGlobalPose(toPxTransform(pos, rot));
 	}
 
@@ -429,4 +441,43 @@ namespace BansheeEngine
 
 		bs_stack_free(shapes);
 	}
+
+	void PhysXRigidbody::setInterpolationTarget(const Vector3& position, const Quaternion& rotation)
+	{
+		static const UINT32 LAST = NUM_INTERPOLATION_POSES - 1;
+
+		if (mInterpolationIdx != (UINT32)-1)
+		{
+			for (UINT32 i = 0; i < LAST; i++)
+			{
+				mPositions[i] = mPositions[i + 1];
+				mRotations[i] = mRotations[i + 1];
+			}
+		}
+		else
+		{
+			Vector3 currentPosition = mLinkedSO->getWorldPosition();
+			Quaternion currentRotation = mLinkedSO->getWorldRotation();
+
+			for (UINT32 i = 0; i < LAST; i++)
+			{
+				mPositions[i] = currentPosition;
+				mRotations[i] = currentRotation;
+			}
+		}
+
+		mPositions[LAST] = position;
+		mRotations[LAST] = rotation;
+	}
+
+	void PhysXRigidbody::applyLatestPose()
+	{
+		_setTransform(mPositions[NUM_INTERPOLATION_POSES - 1], mRotations[NUM_INTERPOLATION_POSES - 1]);
+	}
+
+	void PhysXRigidbody::evaluateInterpolation(UINT32 idx, float t, Vector3& position, Quaternion& rotation) const
+	{
+		position = mPositions[idx] + (mPositions[idx + 1] - mPositions[idx]) * t;
+		rotation = Quaternion::slerp(t, mRotations[idx], mRotations[idx + 1]);
+	}
 }
\ No newline at end of file
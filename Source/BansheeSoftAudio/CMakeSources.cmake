@@ -0,0 +1,34 @@
+set(BS_BANSHEESOFTAUDIO_INC_NOFILTER
+	"Include/BsSoftAudioPrerequisites.h"
+	"Include/BsSoftAudio.h"
+	"Include/BsSoftAudioClip.h"
+	"Include/BsSoftAudioSource.h"
+	"Include/BsSoftAudioListener.h"
+	"../BansheeOpenAudio/Include/BsOAImporter.h"
+	"../BansheeOpenAudio/Include/BsAudioDecoder.h"
+	"../BansheeOpenAudio/Include/BsWaveDecoder.h"
+	"../BansheeOpenAudio/Include/BsFLACDecoder.h"
+	"../BansheeOpenAudio/Include/BsOggVorbisDecoder.h"
+	"../BansheeOpenAudio/Include/BsOggVorbisEncoder.h"
+)
+
+set(BS_BANSHEESOFTAUDIO_SRC_NOFILTER
+	"Source/BsSoftAudioPlugin.cpp"
+	"Source/BsSoftAudio.cpp"
+	"Source/BsSoftAudioClip.cpp"
+	"Source/BsSoftAudioSource.cpp"
+	"Source/BsSoftAudioListener.cpp"
+	"../BansheeOpenAudio/Source/BsOAImporter.cpp"
+	"../BansheeOpenAudio/Source/BsWaveDecoder.cpp"
+	"../BansheeOpenAudio/Source/BsFLACDecoder.cpp"
+	"../BansheeOpenAudio/Source/BsOggVorbisDecoder.cpp"
+	"../BansheeOpenAudio/Source/BsOggVorbisEncoder.cpp"
+)
+
+source_group("Header Files" FILES ${BS_BANSHEESOFTAUDIO_INC_NOFILTER})
+source_group("Source Files" FILES ${BS_BANSHEESOFTAUDIO_SRC_NOFILTER})
+
+set(BS_BANSHEESOFTAUDIO_SRC
+	${BS_BANSHEESOFTAUDIO_INC_NOFILTER}
+	${BS_BANSHEESOFTAUDIO_SRC_NOFILTER}
+)
\ No newline at end of file
@@ -0,0 +1,105 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsSoftAudioPrerequisites.h"
+#include "BsAudio.h"
+#include "BsAudioMixer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup SoftAudio
+	 *  @{
+	 */
+
+	/**
+	 * Global manager for the headless audio implementation that mixes all audio on the CPU using AudioMixer. There is no
+	 * output device: mixed audio is written to an AudioSink, which discards it by default. Provide a different sink
+	 * through getMixer() to record the output.
+	 */
+	class SoftAudio : public Audio
+	{
+	public:
+		SoftAudio();
+		virtual ~SoftAudio();
+
+		/** @copydoc Audio::setVolume */
+		void setVolume(float volume) override;
+
+		/** @copydoc Audio::getVolume */
+		float getVolume() const override;
+
+		/** @copydoc Audio::setPaused */
+		void setPaused(bool paused) override;
+
+		/** @copydoc Audio::isPaused */
+		bool isPaused() const override { return mIsPaused; }
+
+		/** @copydoc Audio::update */
+		void _update() override;
+
+		/** @copydoc Audio::setActiveDevice */
+		void setActiveDevice(const AudioDevice& device) override;
+
+		/** @copydoc Audio::getActiveDevice */
+		AudioDevice getActiveDevice() const override { return mDevice; }
+
+		/** @copydoc Audio::getDefaultDevice */
+		AudioDevice getDefaultDevice() const override { return mDevice; }
+
+		/** @copydoc Audio::getAllDevices */
+		const Vector<AudioDevice>& getAllDevices() const override { return mAllDevices; }
+
+		/** Returns the mixer used for mixing all the playing sources. */
+		AudioMixer& getMixer() { return mMixer; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Registers a new AudioListener. Should be called on listener creation. */
+		void _registerListener(SoftAudioListener* listener);
+
+		/** Unregisters an existing AudioListener. Should be called before listener destruction. */
+		void _unregisterListener(SoftAudioListener* listener);
+
+		/** Registers a new AudioSource. Should be called on source creation. */
+		void _registerSource(SoftAudioSource* source);
+
+		/** Unregisters an existing AudioSource. Should be called before source destruction. */
+		void _unregisterSource(SoftAudioSource* source);
+
+		/** @} */
+	private:
+		/** @copydoc Audio::createClip */
+		SPtr<AudioClip> createClip(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples,
+			const AUDIO_CLIP_DESC& desc) override;
+
+		/** @copydoc Audio::createListener */
+		SPtr<AudioListener> createListener() override;
+
+		/** @copydoc Audio::createSource */
+		SPtr<AudioSource> createSource() override;
+
+		/** Largest amount of audio mixed in a single update, in seconds. Protects against long frames. */
+		static const float MAX_MIX_TIME;
+
+		AudioMixer mMixer;
+		double mPendingFrames;
+		bool mIsPaused;
+
+		Vector<SoftAudioListener*> mListeners;
+		UnorderedSet<SoftAudioSource*> mSources;
+
+		Vector<AudioMixerVoice*> mVoices;
+		Vector<AudioMixerListener> mMixerListeners;
+
+		Vector<AudioDevice> mAllDevices;
+		AudioDevice mDevice;
+	};
+
+	/** Provides easier access to SoftAudio. */
+	SoftAudio& gSoftAudio();
+
+	/** @} */
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsSoftAudioPrerequisites.h"
+#include "BsAudioClip.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup SoftAudio
+	 *  @{
+	 */
+
+	/**
+	 * Software implementation of an AudioClip. Samples are always decoded into floating point format on load, so they can
+	 * be read directly by the mixer. Streaming and compressed read modes are treated as AudioReadMode::LoadDecompressed.
+	 */
+	class SoftAudioClip : public AudioClip
+	{
+	public:
+		SoftAudioClip(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples, const AUDIO_CLIP_DESC& desc);
+		virtual ~SoftAudioClip();
+
+		/** Returns decoded samples in [-1, 1] range, with channels interleaved. */
+		const float* getSamples() const { return mSamples.data(); }
+
+		/** Returns the number of samples per channel. */
+		UINT32 getNumFrames() const { return mNumFrames; }
+
+		/** Returns the number of channels in the decoded samples. Clips with more than two channels are decoded as mono. */
+		UINT32 getNumDecodedChannels() const { return mNumDecodedChannels; }
+
+	protected:
+		/** @copydoc Resource::initialize */
+		void initialize() override;
+
+		/** @copydoc AudioClip::getSourceFormatData */
+		SPtr<DataStream> getSourceStream(UINT32& size) override;
+
+		Vector<float> mSamples;
+		UINT32 mNumFrames;
+		UINT32 mNumDecodedChannels;
+
+		// These streams exist to save original audio data in case it's needed later (usually for saving with the editor, or
+		// manual data manipulation). In normal usage (in-game) these will be null so no memory is wasted.
+		SPtr<DataStream> mSourceStreamData;
+		UINT32 mSourceStreamSize;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsSoftAudioPrerequisites.h"
+#include "BsAudioListener.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup SoftAudio
+	 *  @{
+	 */
+
+	/**
+	 * Software implementation of an AudioListener. Listener properties are read by SoftAudio every time audio is mixed,
+	 * so no changes need to be propagated.
+	 */
+	class SoftAudioListener : public AudioListener
+	{
+	public:
+		SoftAudioListener();
+		virtual ~SoftAudioListener();
+	};
+
+	/** @} */
+}
\ No newline at end of file
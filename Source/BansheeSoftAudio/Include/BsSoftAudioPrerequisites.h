@@ -0,0 +1,40 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+#if (BS_PLATFORM == BS_PLATFORM_WIN32) && !defined(__MINGW32__)
+#	ifdef BS_SOFTAUDIO_EXPORTS
+#		define BS_SOFTAUDIO_EXPORT __declspec(dllexport)
+#	else
+#       if defined( __MINGW32__ )
+#           define BS_SOFTAUDIO_EXPORT
+#       else
+#    		define BS_SOFTAUDIO_EXPORT __declspec(dllimport)
+#       endif
+#	endif
+#elif defined (BS_GCC_VISIBILITY)
+#    define BS_SOFTAUDIO_EXPORT  __attribute__ ((visibility("default")))
+#else
+#    define BS_SOFTAUDIO_EXPORT
+#endif
+
+
+namespace BansheeEngine
+{
+	class SoftAudioListener;
+	class SoftAudioSource;
+	class SoftAudioClip;
+}
+
+/** @addtogroup Plugins
+ *  @{
+ */
+
+/** @defgroup SoftAudio BansheeSoftAudio
+ *	Headless audio system implementation that mixes all audio on the CPU, without relying on an audio library. It has no
+ *	output device, so it is meant for servers and automated tests rather than shipped games.
+ */
+
+/** @} */
\ No newline at end of file
@@ -0,0 +1,82 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsSoftAudioPrerequisites.h"
+#include "BsAudioSource.h"
+#include "BsAudioMixer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup SoftAudio
+	 *  @{
+	 */
+
+	/**
+	 * Software implementation of an AudioSource. Playback state is stored in a voice that is advanced by the mixer.
+	 *
+	 * @note	Velocity is stored but ignored, as the mixer doesn't simulate the doppler effect.
+	 */
+	class SoftAudioSource : public AudioSource
+	{
+	public:
+		SoftAudioSource();
+		virtual ~SoftAudioSource();
+
+		/** @copydoc AudioSource::setClip */
+		void setClip(const HAudioClip& clip) override;
+
+		/** @copydoc AudioSource::setPosition */
+		void setPosition(const Vector3& position) override;
+
+		/** @copydoc AudioSource::setVolume */
+		void setVolume(float volume) override;
+
+		/** @copydoc AudioSource::setPitch */
+		void setPitch(float pitch) override;
+
+		/** @copydoc AudioSource::setIsLooping */
+		void setIsLooping(bool loop) override;
+
+		/** @copydoc AudioSource::setPriority */
+		void setPriority(INT32 priority) override;
+
+		/** @copydoc AudioSource::setMinDistance */
+		void setMinDistance(float distance) override;
+
+		/** @copydoc AudioSource::setAttenuation */
+		void setAttenuation(float attenuation) override;
+
+		/** @copydoc AudioSource::setTime */
+		void setTime(float setTime) override;
+
+		/** @copydoc AudioSource::getTime */
+		float getTime() const override;
+
+		/** @copydoc AudioSource::play */
+		void play() override;
+
+		/** @copydoc AudioSource::pause */
+		void pause() override;
+
+		/** @copydoc AudioSource::stop */
+		void stop() override;
+
+		/** @copydoc AudioSource::getState */
+		AudioSourceState getState() const override;
+
+	private:
+		friend class SoftAudio;
+
+		/** Updates the voice with sample data from the currently assigned clip. Returns false if no clip is loaded. */
+		bool updateVoiceClip();
+
+		/** @copydoc IResourceListener::onClipChanged */
+		void onClipChanged() override;
+
+		AudioMixerVoice mVoice;
+		bool mIsPaused;
+	};
+
+	/** @} */
+}
\ No newline at end of file
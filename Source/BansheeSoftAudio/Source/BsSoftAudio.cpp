@@ -0,0 +1,129 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSoftAudio.h"
+#include "BsSoftAudioClip.h"
+#include "BsSoftAudioSource.h"
+#include "BsSoftAudioListener.h"
+#include "BsTime.h"
+
+namespace BansheeEngine
+{
+	const float SoftAudio::MAX_MIX_TIME = 0.25f;
+
+	SoftAudio::SoftAudio()
+		:mPendingFrames(0.0), mIsPaused(false)
+	{
+		mMixer.setSink(bs_shared_ptr_new<NullAudioSink>());
+
+		LOGWRN("Using the headless SoftAudio backend. It has no output device, so no audio will be heard.");
+
+		mDevice.name = L"Headless";
+		mAllDevices.push_back(mDevice);
+	}
+
+	SoftAudio::~SoftAudio()
+	{
+		assert(mListeners.size() == 0 && mSources.size() == 0); // Everything should be destroyed at this point
+	}
+
+	void SoftAudio::setVolume(float volume)
+	{
+		mMixer.setVolume(volume);
+	}
+
+	float SoftAudio::getVolume() const
+	{
+		return mMixer.getVolume();
+	}
+
+	void SoftAudio::setPaused(bool paused)
+	{
+		mIsPaused = paused;
+	}
+
+	void SoftAudio::_update()
+	{
+		UINT32 sampleRate = mMixer.getSampleRate();
+
+		// Mix as much audio as the time that passed, carrying over the fractional frame to the next update
+		mPendingFrames += gTime().getFrameDelta() * (double)sampleRate;
+		mPendingFrames = std::min(mPendingFrames, (double)(MAX_MIX_TIME * sampleRate));
+
+		UINT32 numFrames = (UINT32)mPendingFrames;
+		mPendingFrames -= numFrames;
+
+		mVoices.clear();
+		if (!mIsPaused) // When paused sources keep their position, and silence is written to the sink
+		{
+			for (auto& source : mSources)
+			{
+				if (source->mVoice.playing)
+					mVoices.push_back(&source->mVoice);
+			}
+		}
+
+		mMixerListeners.resize(mListeners.size());
+		for (UINT32 i = 0; i < (UINT32)mListeners.size(); i++)
+		{
+			mMixerListeners[i].position = mListeners[i]->getPosition();
+			mMixerListeners[i].direction = mListeners[i]->getDirection();
+			mMixerListeners[i].up = mListeners[i]->getUp();
+		}
+
+		mMixer.mix(mVoices.data(), (UINT32)mVoices.size(), mMixerListeners.data(), (UINT32)mMixerListeners.size(),
+			numFrames);
+
+		Audio::_update();
+	}
+
+	void SoftAudio::setActiveDevice(const AudioDevice& device)
+	{
+		if (device.name == mDevice.name)
+			return;
+
+		LOGWRN("Failed changing audio device to: " + toString(device.name));
+	}
+
+	SPtr<AudioClip> SoftAudio::createClip(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples,
+		const AUDIO_CLIP_DESC& desc)
+	{
+		return bs_core_ptr_new<SoftAudioClip>(samples, streamSize, numSamples, desc);
+	}
+
+	SPtr<AudioListener> SoftAudio::createListener()
+	{
+		return bs_shared_ptr_new<SoftAudioListener>();
+	}
+
+	SPtr<AudioSource> SoftAudio::createSource()
+	{
+		return bs_shared_ptr_new<SoftAudioSource>();
+	}
+
+	void SoftAudio::_registerListener(SoftAudioListener* listener)
+	{
+		mListeners.push_back(listener);
+	}
+
+	void SoftAudio::_unregisterListener(SoftAudioListener* listener)
+	{
+		auto iterFind = std::find(mListeners.begin(), mListeners.end(), listener);
+		if (iterFind != mListeners.end())
+			mListeners.erase(iterFind);
+	}
+
+	void SoftAudio::_registerSource(SoftAudioSource* source)
+	{
+		mSources.insert(source);
+	}
+
+	void SoftAudio::_unregisterSource(SoftAudioSource* source)
+	{
+		mSources.erase(source);
+	}
+
+	SoftAudio& gSoftAudio()
+	{
+		return static_cast<SoftAudio&>(SoftAudio::instance());
+	}
+}
\ No newline at end of file
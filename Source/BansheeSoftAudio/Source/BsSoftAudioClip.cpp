@@ -0,0 +1,109 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSoftAudioClip.h"
+#include "BsOggVorbisDecoder.h"
+#include "BsAudioUtility.h"
+#include "BsDataStream.h"
+
+namespace BansheeEngine
+{
+	SoftAudioClip::SoftAudioClip(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples, const AUDIO_CLIP_DESC& desc)
+		:AudioClip(samples, streamSize, numSamples, desc), mNumFrames(0), mNumDecodedChannels(0), mSourceStreamSize(0)
+	{ }
+
+	SoftAudioClip::~SoftAudioClip()
+	{ }
+
+	void SoftAudioClip::initialize()
+	{
+		AudioDataInfo info;
+		info.bitDepth = mDesc.bitDepth;
+		info.numChannels = mDesc.numChannels;
+		info.numSamples = mNumSamples;
+		info.sampleRate = mDesc.frequency;
+
+		// If we need to keep source data, read everything into memory and keep a copy
+		if (mKeepSourceData)
+		{
+			mStreamData->seek(mStreamOffset);
+
+			UINT8* sampleBuffer = (UINT8*)bs_alloc(mStreamSize);
+			mStreamData->read(sampleBuffer, mStreamSize);
+
+			mSourceStreamData = bs_shared_ptr_new<MemoryDataStream>(sampleBuffer, mStreamSize);
+			mSourceStreamSize = mStreamSize;
+		}
+
+		SPtr<DataStream> stream;
+		UINT32 offset = 0;
+		if (mSourceStreamData != nullptr) // If it's already loaded in memory, use it directly
+			stream = mSourceStreamData;
+		else
+		{
+			stream = mStreamData;
+			offset = mStreamOffset;
+		}
+
+		// Mixer reads samples directly, so everything is decoded regardless of read mode
+		UINT32 bytesPerSample = info.bitDepth / 8;
+		UINT32 bufferSize = info.numSamples * bytesPerSample;
+		UINT8* sampleBuffer = (UINT8*)bs_alloc(bufferSize);
+
+		if (mDesc.format == AudioFormat::VORBIS)
+		{
+			OggVorbisDecoder reader;
+			if (reader.open(stream, info, offset))
+				reader.read(sampleBuffer, info.numSamples);
+			else
+			{
+				LOGERR("Failed decompressing AudioClip stream.");
+				memset(sampleBuffer, 0, bufferSize);
+			}
+		}
+		else
+		{
+			stream->seek(offset);
+			stream->read(sampleBuffer, bufferSize);
+		}
+
+		// Mixer only handles mono and stereo sounds
+		UINT32 numChannels = info.numChannels;
+		UINT32 numSamples = info.numSamples;
+		if (numChannels > 2)
+		{
+			UINT32 numSamplesPerChannel = numSamples / numChannels;
+			UINT8* monoBuffer = (UINT8*)bs_alloc(numSamplesPerChannel * bytesPerSample);
+
+			AudioUtility::convertToMono(sampleBuffer, monoBuffer, info.bitDepth, numSamplesPerChannel, numChannels);
+
+			bs_free(sampleBuffer);
+			sampleBuffer = monoBuffer;
+
+			numChannels = 1;
+			numSamples = numSamplesPerChannel;
+		}
+
+		mSamples.resize(numSamples);
+		if (numSamples > 0)
+			AudioUtility::convertToFloat(sampleBuffer, info.bitDepth, mSamples.data(), numSamples);
+
+		mNumDecodedChannels = std::max(numChannels, 1U);
+		mNumFrames = numSamples / mNumDecodedChannels;
+
+		bs_free(sampleBuffer);
+
+		mStreamData = nullptr;
+		mStreamOffset = 0;
+		mStreamSize = 0;
+
+		AudioClip::initialize();
+	}
+
+	SPtr<DataStream> SoftAudioClip::getSourceStream(UINT32& size)
+	{
+		size = mSourceStreamSize;
+		mSourceStreamData->seek(0);
+
+		return mSourceStreamData;
+	}
+}
\ No newline at end of file
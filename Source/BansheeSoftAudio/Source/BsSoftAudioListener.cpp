@@ -0,0 +1,17 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSoftAudioListener.h"
+#include "BsSoftAudio.h"
+
+namespace BansheeEngine
+{
+	SoftAudioListener::SoftAudioListener()
+	{
+		gSoftAudio()._registerListener(this);
+	}
+
+	SoftAudioListener::~SoftAudioListener()
+	{
+		gSoftAudio()._unregisterListener(this);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSoftAudioPrerequisites.h"
+#include "BsAudioManager.h"
+#include "BsSoftAudio.h"
+#include "BsOAImporter.h"
+#include "BsImporter.h"
+
+namespace BansheeEngine
+{
+	class SoftAudioFactory : public AudioFactory
+	{
+	public:
+		void startUp() override
+		{
+			Audio::startUp<SoftAudio>();
+		}
+
+		void shutDown() override
+		{
+			Audio::shutDown();
+		}
+	};
+
+	/**	Returns a name of the plugin. */
+	extern "C" BS_SOFTAUDIO_EXPORT const char* getPluginName()
+	{
+		static const char* pluginName = "BansheeSoftAudio";
+		return pluginName;
+	}
+
+	/**	Entry point to the plugin. Called by the engine when the plugin is loaded. */
+	extern "C" BS_SOFTAUDIO_EXPORT void* loadPlugin()
+	{
+		OAImporter* importer = bs_new<OAImporter>();
+		Importer::instance()._registerAssetImporter(importer);
+
+		return bs_new<SoftAudioFactory>();
+	}
+
+	/**	Exit point of the plugin. Called by the engine before the plugin is unloaded. */
+	extern "C" BS_SOFTAUDIO_EXPORT void unloadPlugin(SoftAudioFactory* instance)
+	{
+		bs_delete(instance);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSoftAudioSource.h"
+#include "BsSoftAudio.h"
+#include "BsSoftAudioClip.h"
+
+namespace BansheeEngine
+{
+	SoftAudioSource::SoftAudioSource()
+		:mIsPaused(false)
+	{
+		mVoice.position = mPosition;
+		mVoice.volume = mVolume;
+		mVoice.pitch = mPitch;
+		mVoice.loop = mLoop;
+		mVoice.priority = mPriority;
+		mVoice.minDistance = mMinDistance;
+		mVoice.attenuation = mAttenuation;
+
+		gSoftAudio()._registerSource(this);
+	}
+
+	SoftAudioSource::~SoftAudioSource()
+	{
+		gSoftAudio()._unregisterSource(this);
+	}
+
+	void SoftAudioSource::setClip(const HAudioClip& clip)
+	{
+		stop();
+
+		AudioSource::setClip(clip);
+	}
+
+	void SoftAudioSource::setPosition(const Vector3& position)
+	{
+		AudioSource::setPosition(position);
+
+		mVoice.position = position;
+	}
+
+	void SoftAudioSource::setVolume(float volume)
+	{
+		AudioSource::setVolume(volume);
+
+		mVoice.volume = mVolume;
+	}
+
+	void SoftAudioSource::setPitch(float pitch)
+	{
+		AudioSource::setPitch(pitch);
+
+		mVoice.pitch = mPitch;
+	}
+
+	void SoftAudioSource::setIsLooping(bool loop)
+	{
+		AudioSource::setIsLooping(loop);
+
+		mVoice.loop = mLoop;
+	}
+
+	void SoftAudioSource::setPriority(INT32 priority)
+	{
+		AudioSource::setPriority(priority);
+
+		mVoice.priority = mPriority;
+	}
+
+	void SoftAudioSource::setMinDistance(float distance)
+	{
+		AudioSource::setMinDistance(distance);
+
+		mVoice.minDistance = mMinDistance;
+	}
+
+	void SoftAudioSource::setAttenuation(float attenuation)
+	{
+		AudioSource::setAttenuation(attenuation);
+
+		mVoice.attenuation = mAttenuation;
+	}
+
+	void SoftAudioSource::play()
+	{
+		if (!updateVoiceClip())
+			return;
+
+		mVoice.playing = true;
+		mIsPaused = false;
+	}
+
+	void SoftAudioSource::pause()
+	{
+		if (!mVoice.playing)
+			return;
+
+		mVoice.playing = false;
+		mIsPaused = true;
+	}
+
+	void SoftAudioSource::stop()
+	{
+		mVoice.playing = false;
+		mVoice.playPosition = 0.0;
+		mVoice.gains[0] = 0.0f;
+		mVoice.gains[1] = 0.0f;
+
+		mIsPaused = false;
+	}
+
+	AudioSourceState SoftAudioSource::getState() const
+	{
+		if (mVoice.playing)
+			return AudioSourceState::Playing;
+
+		if (mIsPaused)
+			return AudioSourceState::Paused;
+
+		return AudioSourceState::Stopped;
+	}
+
+	void SoftAudioSource::setTime(float time)
+	{
+		if (!updateVoiceClip())
+			return;
+
+		double position = std::max(time, 0.0f) * (double)mVoice.sampleRate;
+		mVoice.playPosition = std::min(position, (double)mVoice.numFrames);
+	}
+
+	float SoftAudioSource::getTime() const
+	{
+		if (mVoice.sampleRate == 0)
+			return 0.0f;
+
+		return (float)(mVoice.playPosition / mVoice.sampleRate);
+	}
+
+	bool SoftAudioSource::updateVoiceClip()
+	{
+		if (!mAudioClip.isLoaded())
+		{
+			mVoice.samples = nullptr;
+			mVoice.numFrames = 0;
+
+			return false;
+		}
+
+		SoftAudioClip* softClip = static_cast<SoftAudioClip*>(mAudioClip.get());
+		mVoice.samples = softClip->getSamples();
+		mVoice.numFrames = softClip->getNumFrames();
+		mVoice.numChannels = softClip->getNumDecodedChannels();
+		mVoice.sampleRate = softClip->getFrequency();
+		mVoice.is3D = softClip->is3D();
+
+		return true;
+	}
+
+	void SoftAudioSource::onClipChanged()
+	{
+		AudioSourceState state = getState();
+		float savedTime = getTime();
+
+		stop();
+
+		setTime(savedTime);
+
+		if (state != AudioSourceState::Stopped)
+			play();
+
+		if (state == AudioSourceState::Paused)
+			pause();
+	}
+}
\ No newline at end of file
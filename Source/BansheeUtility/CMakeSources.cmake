@@ -49,6 +49,7 @@ set(BS_BANSHEEUTILITY_SRC_GENERAL
 	"Source/BsTimer.cpp"
 	"Source/BsTime.cpp"
 	"Source/BsUtil.cpp"
+	"Source/BsRadixSort.cpp"
 )
 
 set(BS_BANSHEEUTILITY_INC_DEBUG
@@ -89,6 +90,7 @@ set(BS_BANSHEEUTILITY_INC_GENERAL
 	"Include/BsTimer.h"
 	"Include/BsUtil.h"
 	"Include/BsFlags.h"
+	"Include/BsRadixSort.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_ALLOCATORS
@@ -149,6 +151,7 @@ set(BS_BANSHEEUTILITY_SRC_MATH
 	"Source/BsVector4.cpp"
 	"Source/BsBounds.cpp"
 	"Source/BsConvexVolume.cpp"
+	"Source/BsBoundsArray.cpp"
 	"Source/BsTorus.cpp"
 	"Source/BsRect3.cpp"
 	"Source/BsRect2.cpp"
@@ -193,6 +196,7 @@ set(BS_BANSHEEUTILITY_INC_MATH
 	"Include/BsVector4.h"
 	"Include/BsBounds.h"
 	"Include/BsConvexVolume.h"
+	"Include/BsBoundsArray.h"
 	"Include/BsTorus.h"
 	"Include/BsLineSegment3.h"
 	"Include/BsRect3.h"
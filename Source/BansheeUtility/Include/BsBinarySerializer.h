@@ -67,9 +67,11 @@ namespace BansheeEngine
 			bool shallow = false, const UnorderedMap<String, UINT64>& params = UnorderedMap<String, UINT64>());
 
 		/**
-		 * Decodes an object from binary data.
+		 * Decodes an object from binary data. Data is decoded directly into the output objects, without building the
+		 * intermediate SerializedObject representation.
 		 *
-		 * @param[in]	data  		Binary data to decode.
+		 * @param[in]	data  		Binary data to decode. Stream must be seekable, as referenced objects are decoded 
+		 *							before the objects referencing them, regardless of their location in the stream.
 		 * @param[in]	dataLength	Length of the data in bytes.
 		 * @param[in]	params		Optional parameters to be passed to the serialization callbacks on the objects being
 		 *							serialized.
@@ -140,6 +142,36 @@ namespace BansheeEngine
 			bool decodeInProgress; // Used for error reporting circular references
 		};
 
+		/** Location of a top-level (referenced by pointer) object within the stream, along with its decode state. */
+		struct ObjectLocation
+		{
+			ObjectLocation(size_t _offset, UINT32 _typeId)
+				:offset(_offset), typeId(_typeId), isDecoded(false), decodeInProgress(false)
+			{ }
+
+			size_t offset;
+			UINT32 typeId;
+			SPtr<IReflectable> object;
+			bool isDecoded;
+			bool decodeInProgress; // Used for error reporting circular references
+		};
+
+		/** Location of a single sub-object (i.e. the part of the object belonging to one class in its hierarchy). */
+		struct SubObjectLocation
+		{
+			size_t offset;
+			UINT32 typeId;
+			RTTITypeBase* rtti;
+		};
+
+		/** Layout of a single encoded object (top-level or inline), as recorded by skipEntry(). */
+		struct EntryLayout
+		{
+			UINT32 firstSubObject; /**< Index of the object's first sub-object in mSubObjectLocations. */
+			UINT32 numSubObjects;
+			size_t end; /**< Stream offset right after the object's data. */
+		};
+
 		/** Encodes a single IReflectable object. */
 		UINT8* encodeEntry(IReflectable* object, UINT32 objectId, UINT8* buffer, UINT32& bufferLength, UINT32* bytesWritten,
 			std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback, bool shallow);
@@ -151,6 +183,57 @@ namespace BansheeEngine
 		bool decodeEntry(const SPtr<DataStream>& data, UINT32 dataLength, UINT32& bytesRead, SPtr<SerializedObject>& output, 
 			bool copyData, bool streamDataBlock);
 
+		/**
+		 * Decodes a single IReflectable object directly from the stream, without going through the intermediate 
+		 * representation. Stream must be positioned at the object's meta-data, and will be positioned after the object's 
+		 * last field once done.
+		 */
+		void decodeEntryDirect(const SPtr<IReflectable>& object, const SPtr<DataStream>& data, size_t dataEnd);
+
+		/**
+		 * Decodes all the fields belonging to a single sub-object into @p object. Stream must be positioned after the 
+		 * sub-object's meta-data. Reading stops at the first object meta-data or a terminator field.
+		 */
+		void decodeFieldsDirect(IReflectable* object, RTTITypeBase* rtti, const SPtr<DataStream>& data, size_t dataEnd);
+
+		/**
+		 * Returns an object referenced by @p objectId, decoding it first if required (as determined by @p field flags). 
+		 * Returns null if the object cannot be found or its type is unknown.
+		 */
+		SPtr<IReflectable> resolveObjectPtr(UINT32 objectId, RTTIField* field, const SPtr<DataStream>& data, size_t dataEnd);
+
+		/** 
+		 * Finds locations of all top-level objects in the stream and registers them in mObjectLocations. Layouts of 
+		 * all objects (including inline ones) are recorded as well, so the stream only needs to be scanned once. 
+		 * Returns the location of the root object, or null if there are no objects in the stream.
+		 */
+		ObjectLocation* findObjectLocations(const SPtr<DataStream>& data, size_t dataEnd);
+
+		/**
+		 * Skips over a single encoded object and records its layout, along with layouts of all the inline objects 
+		 * within it. Stream must be positioned at the object's meta-data.
+		 * 
+		 * @return	True if the stream ends at a new top-level object, false if it ends at terminator or end of data.
+		 */
+		bool skipEntry(const SPtr<DataStream>& data, size_t dataEnd);
+
+		/** 
+		 * Skips over a single encoded object using its recorded layout, or scans over it if the layout isn't known 
+		 * yet. Stream must be positioned at the object's meta-data.
+		 */
+		void skipRecordedEntry(const SPtr<DataStream>& data, size_t dataEnd);
+
+		/** Skips the data of a single field, positioning the stream after the field's meta-data at the next field. */
+		void skipFieldData(const SPtr<DataStream>& data, size_t dataEnd, SerializableFieldType type, bool isArray, 
+			UINT8 fieldSize, bool hasDynamicSize);
+
+		/**
+		 * Returns a pointer to @p size bytes of plain field data at the current stream location and advances the stream.
+		 * Memory streams are referenced directly, while others get their data copied into a temporary buffer that stays
+		 * valid until the next call.
+		 */
+		UINT8* readPlainData(const SPtr<DataStream>& data, UINT32 size);
+
 		/**	Helper method for encoding a complex object and copying its data to a buffer. */
 		UINT8* complexTypeToBuffer(IReflectable* object, UINT8* buffer, UINT32& bufferLength, UINT32* bytesWritten,
 			std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback, bool shallow);
@@ -201,6 +284,12 @@ namespace BansheeEngine
 		UnorderedMap<SPtr<SerializedObject>, ObjectToDecode> mObjectMap;
 		UnorderedMap<UINT32, SPtr<SerializedObject>> mInterimObjectMap;
 
+		UnorderedMap<UINT32, ObjectLocation> mObjectLocations;
+		UnorderedMap<size_t, EntryLayout> mEntryLayouts; // Keyed by the stream offset of the object
+		Vector<SubObjectLocation> mSubObjectLocations;
+		Vector<SubObjectLocation> mSubObjectScratch; // Sub-objects of the objects currently being scanned
+		Vector<UINT8> mPlainDataBuffer;
+
 		UnorderedMap<String, UINT64> mParams;
 
 		static const int META_SIZE = 4; // Meta field size
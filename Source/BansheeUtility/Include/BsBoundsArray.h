@@ -0,0 +1,67 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsBounds.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * Stores a list of Bounds in structure-of-arrays layout (each sphere and box component in its own contiguous array).
+	 * This allows a ConvexVolume to test multiple bounds at once using vector instructions. Internal arrays are always
+	 * padded to a multiple of four entries.
+	 */
+	class BS_UTILITY_EXPORT BoundsArray
+	{
+	public:
+		BoundsArray();
+
+		/** Appends a new entry at the end of the array. */
+		void add(const Bounds& bounds);
+
+		/** Updates the entry at the specified index. */
+		void set(UINT32 idx, const Bounds& bounds);
+
+		/** Swaps the contents of the two entries. */
+		void swap(UINT32 idx0, UINT32 idx1);
+
+		/** Removes the last entry in the array. */
+		void removeLast();
+
+		/** Removes all entries. */
+		void clear();
+
+		/** Returns the number of entries in the array. */
+		UINT32 size() const { return mNumEntries; }
+
+		/** Returns the center of the box at the specified index. */
+		Vector3 getBoxCenter(UINT32 idx) const;
+
+	private:
+		friend class ConvexVolume;
+
+		/** Resizes all internal arrays so they can hold at least @p numEntries, padded to a multiple of four. */
+		void resize(UINT32 numEntries);
+
+		UINT32 mNumEntries;
+
+		Vector<float> mSphereX;
+		Vector<float> mSphereY;
+		Vector<float> mSphereZ;
+		Vector<float> mSphereRadius;
+
+		Vector<float> mBoxX;
+		Vector<float> mBoxY;
+		Vector<float> mBoxZ;
+		Vector<float> mBoxExtentX;
+		Vector<float> mBoxExtentY;
+		Vector<float> mBoxExtentZ;
+	};
+
+	/** @} */
+}
@@ -4,6 +4,7 @@
 
 #include "BsPrerequisitesUtil.h"
 #include "BsPlane.h"
+#include "BsBoundsArray.h"
 
 namespace BansheeEngine
 {
@@ -30,6 +31,19 @@ namespace BansheeEngine
 		 */
 		bool intersects(const Sphere& sphere) const;
 
+		/**
+		 * Checks which of the provided bounds intersect the volume. Each entry is first tested using its sphere and then
+		 * using its box, same as calling intersects(const Sphere&) followed by intersects(const AABox&). Multiple entries
+		 * are tested at once using vector instructions, when available.
+		 *
+		 * @param[in]	bounds		Bounds to test.
+		 * @param[in]	start		Index of the first entry in @p bounds to test. Must be a multiple of four.
+		 * @param[in]	count		Number of entries to test, starting at @p start.
+		 * @param[out]	visibility	Bitmask with a bit set for each entry that intersects the volume. Bit 0 corresponds to 
+		 *							entry @p start. Must be able to hold at least (@p count + 31) / 32 elements.
+		 */
+		void intersects(const BoundsArray& bounds, UINT32 start, UINT32 count, UINT32* visibility) const;
+
 		/** Returns the internal set of planes that represent the volume. */
 		Vector<Plane> getPlanes() const { return mPlanes; }
 
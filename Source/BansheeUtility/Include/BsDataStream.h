@@ -50,6 +50,12 @@ namespace BansheeEngine
 		virtual bool isWriteable() const { return (mAccess & WRITE) != 0; }
 		virtual bool isFile() const = 0;
 
+		/**
+		 * Returns true if the stream contents are mapped in memory and can be referenced directly (through
+		 * MemoryDataStream::getCurrentPtr()) for as long as the stream is alive, without needing to copy them.
+		 */
+		virtual bool isMemoryMapped() const { return false; }
+
         /** Reads data from the buffer and copies it to the specified value. */
         template<typename T> DataStream& operator>>(T& val);
 
@@ -221,6 +227,42 @@ namespace BansheeEngine
 		bool mFreeOnClose;
 	};
 
+	/**
+	 * Data stream providing read access to a file by mapping it into memory. Pages are loaded by the OS on demand, so
+	 * data can be referenced directly from the mapping without copying it into a separate buffer first.
+	 *
+	 * @note	
+	 * Mapped memory is read-only and must never be written to.
+	 * @note
+	 * If the file cannot be mapped (or is empty) the stream will be empty.
+	 */
+	class BS_UTILITY_EXPORT MemoryMappedDataStream : public MemoryDataStream
+	{
+	public:
+		/**
+		 * Maps the file at the specified path.
+		 *
+		 * @param[in]	filePath	Path of the file to map.
+		 */
+		MemoryMappedDataStream(const Path& filePath);
+		~MemoryMappedDataStream();
+
+		/** @copydoc DataStream::isMemoryMapped */
+		bool isMemoryMapped() const override { return mData != nullptr; }
+
+		/** @copydoc DataStream::clone */
+		SPtr<DataStream> clone(bool copyData = true) const override;
+
+		/** @copydoc DataStream::close */
+		void close() override;
+
+		/** Returns the path of the file mapped by the stream. */
+		const Path& getPath() const { return mPath; }
+
+	protected:
+		Path mPath;
+	};
+
 	/** Data stream for handling data from standard streams. */
 	class BS_UTILITY_EXPORT FileDataStream : public DataStream
 	{
@@ -44,7 +44,23 @@ namespace BansheeEngine
 	class BS_UTILITY_EXPORT FileDecoder
 	{
 	public:
-		FileDecoder(const Path& fileLocation);
+		/**
+		 * Opens the file for decoding.
+		 *
+		 * @param[in]	fileLocation	Path to the file to decode.
+		 * @param[in]	memoryMapped	If true the file will be mapped into memory instead of being read through a file
+		 *								stream. Decoded objects can then reference the mapped data directly instead of
+		 *								copying it (see DataStream::isMemoryMapped()). Falls back to a file stream if the
+		 *								file cannot be mapped.
+		 */
+		FileDecoder(const Path& fileLocation, bool memoryMapped = false);
+
+		/**
+		 * Decodes objects from an already open stream. Stream data must be in the same format as written by FileEncoder.
+		 *
+		 * @param[in]	stream	Stream to decode the objects from, positioned at the first object to decode.
+		 */
+		FileDecoder(const SPtr<DataStream>& stream);
 
 		/**	
 		 * Deserializes an IReflectable object by reading the binary data at the provided file location. 
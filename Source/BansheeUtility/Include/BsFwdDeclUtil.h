@@ -61,6 +61,7 @@ namespace BansheeEngine
 	class DynLibManager;
 	class DataStream;
 	class MemoryDataStream;
+	class MemoryMappedDataStream;
 	class FileDataStream;
 	class MeshData;
 	class FileSystem;
@@ -94,6 +94,24 @@ namespace BansheeEngine
 		 * location and contains the proper type.
 		 */
 		virtual void arrayElemFromBuffer(void* object, int index, void* buffer) = 0;
+
+		/**
+		 * Sets the first @p numElements values of the array on the provided field of the provided object. Values are
+		 * copied from the buffer in which they must be tightly packed. Only valid for fields without dynamic size. It does
+		 * not check the values in the buffer in any way. Array must already be resized to hold the values. Fields 
+		 * that provide direct access to their array storage are copied with a single memcpy.
+		 */
+		virtual void arrayFromBuffer(void* object, UINT32 numElements, void* buffer)
+		{
+			UINT32 typeSize = getTypeSize();
+
+			UINT8* data = (UINT8*)buffer;
+			for (UINT32 i = 0; i < numElements; i++)
+			{
+				arrayElemFromBuffer(object, i, data);
+				data += typeSize;
+			}
+		}
 	};
 
 	/** Represents a plain class field containing a specific type. */
@@ -134,10 +152,15 @@ namespace BansheeEngine
 		 * @param[in]	setter  	The setter method for the field. Must be a specific signature: void(ObjectType*, UINT32, DataType)
 		 * @param[in]	setSize 	Setter method that allows you to resize an array. Can be null. Must be a specific signature: void(ObjectType*, UINT32)
 		 * @param[in]	flags		Various flags you can use to specialize how outside systems handle this field. See "RTTIFieldFlag".
+		 * @param[in]	getData		Optional method returning a pointer to contiguous storage of the array elements. 
+		 *							If provided, arrays of types without dynamic size are deserialized using a single 
+		 *							memcpy, bypassing the setter. Must be a specific signature: DataType*(ObjectType*)
 		 */
 		void initArray(const String& name, UINT16 uniqueId, Any getter,
-			Any getSize, Any setter, Any setSize, UINT64 flags)
+			Any getSize, Any setter, Any setSize, UINT64 flags, Any getData = Any())
 		{
+			arrayDataGetter = getData;
+
 			static_assert(RTTIPlainType<DataType>::id || true, ""); // Just making sure provided type has a type ID
 
 			static_assert((RTTIPlainType<DataType>::hasDynamicSize != 0 || (sizeof(DataType) <= 255)), 
@@ -287,6 +310,47 @@ namespace BansheeEngine
 			std::function<void(ObjectType*, UINT32, DataType&)> f = any_cast<std::function<void(ObjectType*, UINT32, DataType&)>>(valueSetter);
 			f(castObject, index, value);
 		}
+
+		/** @copydoc RTTIPlainFieldBase::arrayFromBuffer */
+		void arrayFromBuffer(void* object, UINT32 numElements, void* buffer) override
+		{
+			checkIsArray(true);
+			checkType<DataType>();
+
+			if(valueSetter.empty())
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Specified field (" + mName + ") has no setter.");
+			}
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+
+			// Static size types are always serialized as a memcpy, so their data can be copied over in bulk
+			if(!arrayDataGetter.empty() && RTTIPlainType<DataType>::hasDynamicSize == 0)
+			{
+				std::function<DataType*(ObjectType*)> getData = any_cast<std::function<DataType*(ObjectType*)>>(arrayDataGetter);
+				if(numElements > 0)
+					memcpy(getData(castObject), buffer, numElements * sizeof(DataType));
+
+				return;
+			}
+
+			// Retrieve the setter only once for the entire array
+			std::function<void(ObjectType*, UINT32, DataType&)> f = any_cast<std::function<void(ObjectType*, UINT32, DataType&)>>(valueSetter);
+
+			char* data = (char*)buffer;
+			for (UINT32 i = 0; i < numElements; i++)
+			{
+				DataType value;
+				RTTIPlainType<DataType>::fromMemory(value, data);
+
+				f(castObject, i, value);
+				data += sizeof(DataType);
+			}
+		}
+
+	private:
+		Any arrayDataGetter;
 	};
 
 	/** @} */
@@ -77,11 +77,13 @@ namespace BansheeEngine
 	void set##name(OwnerType* obj, UINT32 idx, std::common_type<decltype(OwnerType::name)>::type::value_type& val) { obj->name[idx] = val; }		\
 	UINT32 getSize##name(OwnerType* obj) { return (UINT32)obj->name.size(); }																		\
 	void setSize##name(OwnerType* obj, UINT32 val) { obj->name.resize(val); }																		\
+	std::common_type<decltype(OwnerType::name)>::type::value_type* getData##name(OwnerType* obj) { return obj->name.data(); }						\
 																								\
 	struct META_NextEntry_##name{};																\
 	void META_InitPrevEntry(META_NextEntry_##name typeId)										\
 	{																							\
-		addPlainArrayField(#name, id, &MyType::get##name, &MyType::getSize##name, &MyType::set##name, &MyType::setSize##name);						\
+		addPlainArrayField(#name, id, &MyType::get##name, &MyType::getSize##name, &MyType::set##name, &MyType::setSize##name,	\
+			&MyType::getData##name);																\
 		META_InitPrevEntry(META_Entry_##name());												\
 	}																							\
 																								\
@@ -612,7 +614,8 @@ namespace BansheeEngine
 
 		/**
 		 * Tries to find a field with the specified unique ID. Doesn't throw an exception if it can't find the field 
-		 * (Unlike findField(const String&)). 
+		 * (Unlike findField(const String&)). Lookup is a constant time table access, so this is the preferred way of
+		 * finding fields when decoding.
 		 *
 		 * @param	uniqueFieldId	Unique identifier for the field.
 		 *
@@ -640,6 +643,7 @@ namespace BansheeEngine
 
 	private:
 		Vector<RTTIField*> mFields;
+		Vector<RTTIField*> mFieldsById; /**< Same fields as mFields, indexed by their unique ID. Contains null for unused IDs. */
 	};
 
 	/** Used for initializing a certain type as soon as the program is loaded. */
@@ -1016,6 +1020,36 @@ namespace BansheeEngine
 				std::function<void(ObjectType*, UINT32)>(std::bind(setSize, static_cast<InterfaceType*>(this), _1, _2)), flags);
 		}	
 
+		/**
+		 * Same as other addPlainArrayField overloads, with an additional @p getData method returning a pointer to the 
+		 * array elements, which must be stored contiguously (e.g. in a Vector). Arrays of types without dynamic size 
+		 * are then deserialized using a single memcpy after the array is resized, instead of calling the setter per 
+		 * element.
+		 */
+		template<class InterfaceType, class ObjectType, class DataType>
+		void addPlainArrayField(const String& name, UINT32 uniqueId, 
+			DataType& (InterfaceType::*getter)(ObjectType*, UINT32), 
+			UINT32 (InterfaceType::*getSize)(ObjectType*), 
+			void (InterfaceType::*setter)(ObjectType*, UINT32, DataType&), 
+			void(InterfaceType::*setSize)(ObjectType*, UINT32), 
+			DataType* (InterfaceType::*getData)(ObjectType*), UINT64 flags = 0)
+		{
+			using namespace std::placeholders;
+
+			static_assert((std::is_base_of<BansheeEngine::RTTIType<Type, BaseType, MyRTTIType>, InterfaceType>::value), 
+				"Class with the get/set methods must derive from BansheeEngine::RTTIType.");
+
+			static_assert(!(std::is_base_of<BansheeEngine::IReflectable, DataType>::value), 
+				"Data type derives from IReflectable but it is being added as a plain field.");
+
+			addPlainArrayField<ObjectType, DataType>(name, uniqueId, 
+				std::function<DataType&(ObjectType*, UINT32)>(std::bind(getter, static_cast<InterfaceType*>(this), _1, _2)), 
+				std::function<UINT32(ObjectType*)>(std::bind(getSize, static_cast<InterfaceType*>(this), _1)), 
+				std::function<void(ObjectType*, UINT32, DataType&)>(std::bind(setter, static_cast<InterfaceType*>(this), _1, _2, _3)), 
+				std::function<void(ObjectType*, UINT32)>(std::bind(setSize, static_cast<InterfaceType*>(this), _1, _2)), flags,
+				std::function<DataType*(ObjectType*)>(std::bind(getData, static_cast<InterfaceType*>(this), _1)));
+		}	
+
 		template<class InterfaceType, class ObjectType, class DataType>
 		void addReflectableArrayField(const String& name, UINT32 uniqueId, 
 			DataType& (InterfaceType::*getter)(ObjectType*, UINT32), 
@@ -1095,11 +1129,11 @@ namespace BansheeEngine
 
 		template<class ObjectType, class DataType>
 		void addPlainArrayField(const String& name, UINT32 uniqueId, Any getter, Any getSize,
-			Any setter, Any setSize, UINT64 flags)
+			Any setter, Any setSize, UINT64 flags, Any getData = Any())
 		{
 			RTTIPlainField<DataType, ObjectType>* newField = 
 				bs_new<RTTIPlainField<DataType, ObjectType>>();
-			newField->initArray(name, uniqueId, getter, getSize, setter, setSize, flags);
+			newField->initArray(name, uniqueId, getter, getSize, setter, setSize, flags, getData);
 			addNewField(newField);
 		}	
 
@@ -0,0 +1,43 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/** Sorts integer keys in linear time, using a least significant digit radix sort. */
+	class BS_UTILITY_EXPORT RadixSort
+	{
+	public:
+		/**
+		 * Sorts a set of key/value pairs by key, in ascending order. The sort is stable, meaning pairs with equal keys will
+		 * retain their original order.
+		 *
+		 * @param[in, out]	keys		Keys to sort.
+		 * @param[in, out]	values		Values associated with each key. Re-ordered together with the keys.
+		 * @param[in]		tempKeys	Scratch buffer able to hold @p count keys.
+		 * @param[in]		tempValues	Scratch buffer able to hold @p count values.
+		 * @param[in]		count		Number of entries in the @p keys and @p values arrays.
+		 * @param[in]		numBits		Number of lower key bits to sort by. Higher bits are ignored. Providing the exact
+		 *								number of used bits reduces the number of passes required.
+		 */
+		static void sort(UINT64* keys, UINT32* values, UINT64* tempKeys, UINT32* tempValues, UINT32 count, 
+			UINT32 numBits = 64);
+
+		/**
+		 * Converts a floating point value into an integer whose unsigned ordering matches the ordering of the floating
+		 * point values. Negative and positive zero map to the same key.
+		 */
+		static UINT32 toSortableKey(float value);
+
+		/** Returns the number of bits required to represent the provided value. */
+		static UINT32 getNumBits(UINT64 value);
+	};
+
+	/** @} */
+}
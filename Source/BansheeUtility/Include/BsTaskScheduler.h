@@ -23,12 +23,35 @@ namespace BansheeEngine
 		VeryHigh = 102
 	};
 
+	/** @} */
+	/** @addtogroup Threading-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Smallest unit of work executed by the TaskScheduler. Jobs carry no ownership information, whoever queues a job must
+	 * ensure it stays alive until it has executed.
+	 */
+	struct TaskJob
+	{
+		/** Method that performs the work. Receives the job itself so it can access any data stored alongside it. */
+		void(*execute)(TaskJob* job);
+
+		TaskPriority priority;
+		UINT32 order;
+	};
+
+	/** @} */
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
 	/**
 	 * Represents a single task that may be queued in the TaskScheduler.
 	 * 			
 	 * @note	Thread safe.
 	 */
-	class BS_UTILITY_EXPORT Task
+	class BS_UTILITY_EXPORT Task : private TaskJob
 	{
 		struct PrivatelyConstruct {};
 
@@ -38,7 +61,7 @@ namespace BansheeEngine
 
 		/**
 		 * Creates a new task. Task should be provided to TaskScheduler in order for it to start.
-		 *
+		 * 
 		 * @param[in]	name		Name you can use to more easily identify the task.
 		 * @param[in]	taskWorker	Worker method that does all of the work in the task.
 		 * @param[in]	priority  	(optional) Higher priority means the tasks will be executed sooner.
@@ -57,22 +80,31 @@ namespace BansheeEngine
 		/**
 		 * Blocks the current thread until the task has completed. 
 		 * 
-		 * @note	While waiting adds a new worker thread, so that the blocking threads core can be utilized.
+		 * @note	While waiting the calling thread executes other queued jobs, so the blocked threads core is utilized.
 		 */
 		void wait();
 
-		/** Cancels the task and removes it from the TaskSchedulers queue. */
+		/**
+		 * Cancels the task and removes it from the TaskSchedulers queue. Has no effect if the task already started 
+		 * executing.
+		 * 
+		 * @note	
+		 * Any tasks depending on this task are canceled as well (recursively), as they can never start. Waiting on any of
+		 * them returns once they are canceled.
+		 */
 		void cancel();
 
 	private:
 		friend class TaskScheduler;
 
 		String mName;
-		TaskPriority mPriority;
-		UINT32 mTaskId;
 		std::function<void()> mTaskWorker;
 		SPtr<Task> mTaskDependency;
+		Vector<SPtr<Task>> mDependents;
+		SPtr<Task> mSelf;
+		SPtr<Task> mParentTask;
 		std::atomic<UINT32> mState; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
+		std::atomic<UINT32> mNumPending; /**< One for the task's own work, plus one for each unfinished child task. */
 
 		TaskScheduler* mParent;
 	};
@@ -83,22 +115,52 @@ namespace BansheeEngine
 	 * 			
 	 * @note	
 	 * Thread safe.
-	 * @note
-	 * This type of task scheduler uses a global queue and is best used for coarse granularity of tasks. (Number of tasks 
-	 * in the order of hundreds. Higher number of tasks might require different queuing and locking mechanism, potentially 
-	 * at the cost of flexibility.)
-	 * @note
+	 * @note	
+	 * Each worker thread owns a work-stealing deque. Jobs queued from a worker thread are pushed to its own deque and
+	 * executed in LIFO order (ignoring priority), while idle workers steal the oldest jobs from other workers. Jobs queued
+	 * from any other thread go to a shared queue ordered by priority. This makes the scheduler suitable for fine grained
+	 * jobs (see parallelFor()), as well as for coarse Task%s.
+	 * @note	
 	 * By default the task scheduler will create as many threads as there are physical CPU cores. You may add or remove
 	 * threads using addWorker()/removeWorker() methods.
 	 */
 	class BS_UTILITY_EXPORT TaskScheduler : public Module<TaskScheduler>
 	{
+		struct WorkerData;
+
 	public:
 		TaskScheduler();
 		~TaskScheduler();
 
-		/** Queues a new task. */
-		void addTask(const SPtr<Task>& task);
+		/**
+		 * Queues a new task.
+		 * 
+		 * @param[in]	task	Task to queue.
+		 * @param[in]	parent	(optional) Task the new task is a child of. The parent won't be considered complete (and
+		 *						tasks depending on it won't start) until all of its children complete. Must be provided
+		 *						before the parent finishes executing, normally from within the parent's worker.
+		 */
+		void addTask(const SPtr<Task>& task, const SPtr<Task>& parent = nullptr);
+
+		/**
+		 * Splits the range [@p begin, @p end) into chunks of @p granularity elements and executes @p func on each chunk
+		 * in parallel. The calling thread participates in the work and the method returns once all chunks complete.
+		 * 
+		 * @param[in]	begin		Index of the first element in the range.
+		 * @param[in]	end			Index one past the last element in the range.
+		 * @param[in]	granularity	Maximum number of elements processed by a single call to @p func.
+		 * @param[in]	func		Callable with the signature void(UINT32 rangeBegin, UINT32 rangeEnd).
+		 */
+		template<class T>
+		void parallelFor(UINT32 begin, UINT32 end, UINT32 granularity, const T& func)
+		{
+			auto invoke = [](void* data, UINT32 rangeBegin, UINT32 rangeEnd)
+			{
+				(*(const T*)data)(rangeBegin, rangeEnd);
+			};
+
+			_parallelFor(begin, end, granularity, invoke, (void*)&func);
+		}
 
 		/**	Adds a new worker thread which will be used for executing queued tasks. */
 		void addWorker();
@@ -107,33 +169,98 @@ namespace BansheeEngine
 		void removeWorker();
 
 		/** Returns the maximum available worker threads (maximum number of tasks that can be executed simultaneously). */
-		UINT32 getNumWorkers() const { return mMaxActiveTasks; }
+		UINT32 getNumWorkers() const { return mMaxActiveTasks.load(); }
+
+		/** 
+		 * Returns the number of worker threads the scheduler creates on start up. Worker threads are never released, so 
+		 * the thread pool must have room for them on top of any other threads.
+		 */
+		static UINT32 getDefaultNumWorkers();
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Type-erased version of parallelFor(). */
+		void _parallelFor(UINT32 begin, UINT32 end, UINT32 granularity, void(*func)(void*, UINT32, UINT32), void* data);
+
+		/**
+		 * Queues a job for execution. Caller must keep the job alive until it executes. Use this instead of addTask() for
+		 * jobs that need to avoid the overhead of Task%s.
+		 */
+		void _queueJob(TaskJob* job);
+
+		/**
+		 * Executes a single queued job on the calling thread, if one is available. Returns true if a job was executed.
+		 * Should be called by threads waiting on other jobs, so they help finish the work instead of blocking.
+		 */
+		bool _runPendingJob();
+
+		/** @} */
+
+		/** Maximum number of worker threads the scheduler can spawn. */
+		static const UINT32 MAX_WORKERS = 128;
+
 	protected:
 		friend class Task;
 
-		/**	Main task scheduler method that dispatches tasks to other threads. */
-		void runMain();
+		/**	Main method of a worker thread. Executes jobs until the scheduler is shut down. */
+		void runWorker(UINT32 idx);
+
+		/** Spawns new worker threads, if the number of active workers is larger than the number of existing threads. */
+		void spawnWorkers();
+
+		/** Attempts to find a job to execute, checking the local deque, the shared queue and then other workers. */
+		TaskJob* findJob(UINT32 workerIdx);
 
-		/**	Worker method that runs a single task. */
-		void runTask(SPtr<Task> task);
+		/** Queues a task for execution, without checking for its dependency. */
+		void queueTask(const SPtr<Task>& task);
 
-		/**	Blocks the calling thread until the specified task has completed. */
+		/** 
+		 * Notifies the scheduler that the task's own work is finished (or was skipped, if not executed). Completes the task
+		 * once all of its children complete as well.
+		 */
+		void finishTask(Task* task, bool executed);
+
+		/**
+		 * Marks the task as completed (if it executed) or canceled. Queues any tasks that were waiting on it, or cancels
+		 * them if the task was canceled, and notifies the parent task, if any.
+		 */
+		void completeTask(Task* task, bool executed);
+
+		/** Cancels all tasks waiting on the provided task. */
+		void cancelDependents(Task* task);
+
+		/** Wakes up threads sleeping in runWorker() or waitUntilComplete(), if any. */
+		void notifyIdle(bool all);
+
+		/**	Blocks the calling thread until the specified task has completed, executing other jobs in the meantime. */
 		void waitUntilComplete(const Task* task);
 
-		/**	Method used for sorting tasks. */
-		static bool taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs);
+		/** Executes a job containing a Task. */
+		static void executeTask(TaskJob* job);
+
+		/**	Method used for ordering jobs in the shared queue. */
+		static bool jobCompare(const TaskJob* lhs, const TaskJob* rhs);
+
+		WorkerData* mWorkers[MAX_WORKERS];
+		std::atomic<UINT32> mNumWorkerThreads;
+		std::atomic<UINT32> mMaxActiveTasks;
+		std::atomic<UINT32> mNextJobOrder;
+		std::atomic<bool> mShutdown;
 
-		HThread mTaskSchedulerThread;
-		Set<SPtr<Task>, std::function<bool(const SPtr<Task>&, const SPtr<Task>&)>> mTaskQueue;
-		Vector<SPtr<Task>> mActiveTasks;
-		UINT32 mMaxActiveTasks;
-		UINT32 mNextTaskId;
-		bool mShutdown;
+		Vector<TaskJob*> mSharedQueue;
+		std::atomic<UINT32> mNumSharedJobs;
+		std::atomic<INT32> mNumQueuedJobs;
+		std::atomic<UINT32> mNumActiveTasks;
+		std::atomic<UINT32> mNumIdleThreads;
 
-		Mutex mReadyMutex;
-		Mutex mCompleteMutex;
-		Signal mTaskReadyCond;
-		Signal mTaskCompleteCond;
+		Mutex mSharedQueueMutex;
+		Mutex mDependencyMutex;
+		Mutex mSpawnMutex;
+		Mutex mIdleMutex;
+		Signal mIdleCond;
+		Signal mParkCond;
 	};
 
 	/** @} */
@@ -35,6 +35,38 @@ namespace BansheeEngine
 	struct TexAtlasPageDesc
 	{
 		UINT32 width, height;
+		float occupancy; /**< Portion of the page area covered by elements, in [0, 1] range. */
+	};
+
+	/** Algorithms that TexAtlasGenerator can use for placing elements within a page. */
+	enum class TexAtlasPackMethod
+	{
+		/** 
+		 * Recursively splits the page into two parts for every placed element. Fast for small element counts but wastes
+		 * space, and becomes slow as the number of elements grows.
+		 */
+		BinaryTree,
+		/** 
+		 * Keeps track of the top edge of the placed elements and places new elements on top of it, filling the gaps 
+		 * left below it with smaller elements. Fast, with good space usage for elements of similar heights. Only
+		 * supports the BottomLeft heuristic.
+		 */
+		Skyline,
+		/** 
+		 * Keeps track of all maximal free rectangles in the page and places elements within them. Slowest, but yields 
+		 * the tightest atlases. 
+		 */
+		MaxRects
+	};
+
+	/** Determines how is the position for an element chosen, when using the MaxRects pack method. */
+	enum class TexAtlasHeuristic
+	{
+		BestShortSideFit, /**< Position where the shorter leftover side of the free area is smallest. */
+		BestLongSideFit, /**< Position where the longer leftover side of the free area is smallest. */
+		BestAreaFit, /**< Position where the least area is left over. */
+		BottomLeft, /**< Position with the lowest top edge, with ties resolved by the leftmost position. */
+		ContactPoint /**< Position where the element touches the most edges of the page and other elements. */
 	};
 
 	class TexAtlasNode;
@@ -53,8 +85,14 @@ namespace BansheeEngine
 		 * @param[in]	fixedSize   	(optional) If this field is false, algorithm will try to reduce the size of the texture
 		 * 								if possible. If it is true, the algorithm will always produce textures of the specified
 		 * 								@p maxTexWidth, @p maxTexHeight size.
+		 * @param[in]	method			(optional) Algorithm to use for placing elements within a page.
+		 * @param[in]	heuristic		(optional) Determines how to choose the position of an element. Ignored by the
+		 *								BinaryTree pack method. Must be BottomLeft when using the Skyline pack method,
+		 *								as it doesn't support any other heuristic.
 		 */
-		TexAtlasGenerator(bool square = false, UINT32 maxTexWidth = 2048, UINT32 maxTexHeight = 2048, bool fixedSize = false);
+		TexAtlasGenerator(bool square = false, UINT32 maxTexWidth = 2048, UINT32 maxTexHeight = 2048, bool fixedSize = false,
+			TexAtlasPackMethod method = TexAtlasPackMethod::BinaryTree, 
+			TexAtlasHeuristic heuristic = TexAtlasHeuristic::BestShortSideFit);
 
 		/**
 		 * Creates an optimal texture layout by packing texture elements in order to end up with as little empty space 
@@ -68,6 +106,9 @@ namespace BansheeEngine
 		 * @note	
 		 * Algorithm will split elements over multiple textures if they don't fit in a single texture (Determined by 
 		 * maximum texture size).
+		 * @note
+		 * If the size isn't fixed, the sizes tried for the last page are packed concurrently using the TaskScheduler, if 
+		 * it is running.
 		 */
 		Vector<TexAtlasPageDesc> createAtlasLayout(Vector<TexAtlasElementDesc>& elements) const;
 
@@ -76,6 +117,27 @@ namespace BansheeEngine
 		bool mFixedSize;
 		UINT32 mMaxTexWidth;
 		UINT32 mMaxTexHeight;
+		TexAtlasPackMethod mMethod;
+		TexAtlasHeuristic mHeuristic;
+
+		/** 
+		 * Generates pages for the specified size, using the pack method provided on construction. Same requirements as
+		 * for generatePagesForSize() apply.
+		 */
+		int generatePages(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage = 0) const;
+
+		/**
+		 * Organize all of the provided elements and place them into minimum number of pages with the specified width and
+		 * height, using the Skyline or MaxRects pack method.
+		 * 			
+		 * Caller must ensure @p elements array has the page indexes reset to -1 before calling, otherwise it will be assumed
+		 * those elements already have assigned pages.
+		 * 			
+		 * Using @p startPage parameter you may add an offset to the generated page indexes.
+		 *
+		 * @return	Number of pages generated.
+		 */
+		int generatePagesPacked(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage = 0) const;
 
 		/**
 		 * Organize all of the provide elements and place them into minimum number of pages with the specified width and height.
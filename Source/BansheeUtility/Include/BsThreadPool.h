@@ -156,7 +156,7 @@ namespace BansheeEngine
 		 *								exception will be thrown.
 		 * @param[in]	idleTimeout   	(optional) How many seconds do threads need to be idle before we remove them from the pool.
 		 */
-		ThreadPool(UINT32 threadCapacity, UINT32 maxCapacity = 16, UINT32 idleTimeout = 60);
+		ThreadPool(UINT32 threadCapacity, UINT32 maxCapacity = DEFAULT_MAX_CAPACITY, UINT32 idleTimeout = 60);
 		virtual ~ThreadPool();
 
 		/**
@@ -186,6 +186,9 @@ namespace BansheeEngine
 		/**	Returns the total number of created threads in the pool	(both running and unused). */
 		UINT32 getNumAllocated() const;
 
+		/** Maximum number of threads the pool can create, unless specified otherwise. */
+		static const UINT32 DEFAULT_MAX_CAPACITY = 16;
+
 	protected:
 		friend class HThread;
 
@@ -242,7 +245,7 @@ namespace BansheeEngine
 	class TThreadPool : public ThreadPool
 	{
 	public:
-		TThreadPool(UINT32 threadCapacity, UINT32 maxCapacity = 16, UINT32 idleTimeout = 60)
+		TThreadPool(UINT32 threadCapacity, UINT32 maxCapacity = DEFAULT_MAX_CAPACITY, UINT32 idleTimeout = 60)
 			:ThreadPool(threadCapacity, maxCapacity, idleTimeout)
 		{
 
@@ -129,11 +129,52 @@ namespace BansheeEngine
 		if (dataLength == 0)
 			return nullptr;
 
-		SPtr<SerializedObject> intermediateObject = _decodeToIntermediate(data, dataLength);
-		if (intermediateObject == nullptr)
-			return nullptr;
+		size_t dataEnd = data->tell() + dataLength;
+
+		mObjectLocations.clear();
+		mEntryLayouts.clear();
+		mSubObjectLocations.clear();
+		mSubObjectScratch.clear();
 
-		return _decodeFromIntermediate(intermediateObject);
+		SPtr<IReflectable> output;
+		ObjectLocation* rootLocation = findObjectLocations(data, dataEnd);
+		if (rootLocation != nullptr)
+		{
+			RTTITypeBase* type = IReflectable::_getRTTIfromTypeId(rootLocation->typeId);
+			if (type != nullptr)
+			{
+				output = type->newRTTIObject();
+				rootLocation->object = output;
+
+				rootLocation->decodeInProgress = true;
+				data->seek(rootLocation->offset);
+				decodeEntryDirect(output, data, dataEnd);
+				rootLocation->decodeInProgress = false;
+				rootLocation->isDecoded = true;
+			}
+		}
+
+		// Go through the remaining referenced objects (should be only ones with weak refs)
+		for (auto& entry : mObjectLocations)
+		{
+			ObjectLocation& location = entry.second;
+
+			if (location.object == nullptr || location.isDecoded)
+				continue;
+
+			location.decodeInProgress = true;
+			data->seek(location.offset);
+			decodeEntryDirect(location.object, data, dataEnd);
+			location.decodeInProgress = false;
+			location.isDecoded = true;
+		}
+
+		data->seek(dataEnd);
+
+		mObjectLocations.clear();
+		mEntryLayouts.clear();
+		mSubObjectLocations.clear();
+		return output;
 	}
 
 	SPtr<IReflectable> BinarySerializer::_decodeFromIntermediate(const SPtr<SerializedObject>& serializedObject)
@@ -1115,6 +1156,548 @@ namespace BansheeEngine
 		}
 	}
 
+	void BinarySerializer::decodeEntryDirect(const SPtr<IReflectable>& object, const SPtr<DataStream>& data, size_t dataEnd)
+	{
+		// Sub-objects are decoded starting with the base class, same as the intermediate decode does. Their locations
+		// were recorded when the stream was first scanned.
+		size_t entryOffset = data->tell();
+
+		auto iterFind = mEntryLayouts.find(entryOffset);
+		if (iterFind == mEntryLayouts.end())
+		{
+			skipEntry(data, dataEnd);
+			iterFind = mEntryLayouts.find(entryOffset);
+		}
+
+		EntryLayout layout = iterFind->second;
+
+		UINT32 firstSubObjectIdx = layout.firstSubObject;
+		UINT32 lastSubObjectIdx = layout.firstSubObject + layout.numSubObjects;
+
+		// Saved and current base classes might not match, in which case we skip all the data from the mismatch onward
+		RTTITypeBase* rtti = IReflectable::_getRTTIfromTypeId(mSubObjectLocations[firstSubObjectIdx].typeId);
+		mSubObjectLocations[firstSubObjectIdx].rtti = rtti;
+
+		for (UINT32 i = firstSubObjectIdx + 1; i < lastSubObjectIdx; i++)
+		{
+			if (rtti != nullptr)
+				rtti = rtti->getBaseClass();
+
+			if (rtti == nullptr || rtti->getRTTIId() != mSubObjectLocations[i].typeId)
+				rtti = nullptr;
+
+			mSubObjectLocations[i].rtti = rtti;
+		}
+
+		// Note: Not keeping references to mSubObjectLocations entries, as decoding child objects can resize it
+		for (INT32 i = (INT32)lastSubObjectIdx - 1; i >= (INT32)firstSubObjectIdx; i--)
+		{
+			RTTITypeBase* subObjectRtti = mSubObjectLocations[i].rtti;
+			if (subObjectRtti == nullptr)
+				continue;
+
+			subObjectRtti->onDeserializationStarted(object.get(), mParams);
+
+			data->seek(mSubObjectLocations[i].offset + sizeof(ObjectMetaData));
+			decodeFieldsDirect(object.get(), subObjectRtti, data, dataEnd);
+		}
+
+		for (INT32 i = (INT32)lastSubObjectIdx - 1; i >= (INT32)firstSubObjectIdx; i--)
+		{
+			RTTITypeBase* subObjectRtti = mSubObjectLocations[i].rtti;
+			if (subObjectRtti != nullptr)
+				subObjectRtti->onDeserializationEnded(object.get(), mParams);
+		}
+
+		data->seek(layout.end);
+	}
+
+	void BinarySerializer::decodeFieldsDirect(IReflectable* object, RTTITypeBase* rtti, const SPtr<DataStream>& data, 
+		size_t dataEnd)
+	{
+		while (data->tell() < dataEnd)
+		{
+			UINT32 metaData = 0;
+			if (data->read(&metaData, META_SIZE) != META_SIZE)
+			{
+				BS_EXCEPT(InternalErrorException, "Error decoding data.");
+			}
+
+			// We've reached a base class of the current object, or a new object
+			if (isObjectMetaData(metaData))
+				return;
+
+			bool isArray;
+			SerializableFieldType fieldType;
+			UINT16 fieldId;
+			UINT8 fieldSize;
+			bool hasDynamicSize;
+			bool terminator;
+			decodeFieldMetaData(metaData, fieldId, fieldSize, isArray, fieldType, hasDynamicSize, terminator);
+
+			if (terminator)
+				return;
+
+			RTTIField* curGenericField = rtti->findField(fieldId);
+			if (curGenericField == nullptr)
+			{
+				skipFieldData(data, dataEnd, fieldType, isArray, fieldSize, hasDynamicSize);
+				continue;
+			}
+
+			if (!hasDynamicSize && curGenericField->getTypeSize() != fieldSize)
+			{
+				BS_EXCEPT(InternalErrorException,
+					"Data type mismatch. Type size stored in file and actual type size don't match. ("
+					+ toString(curGenericField->getTypeSize()) + " vs. " + toString(fieldSize) + ")");
+			}
+
+			if (curGenericField->mIsVectorType != isArray)
+			{
+				BS_EXCEPT(InternalErrorException,
+					"Data type mismatch. One is array, other is a single type.");
+			}
+
+			if (curGenericField->mType != fieldType)
+			{
+				BS_EXCEPT(InternalErrorException,
+					"Data type mismatch. Field types don't match. " + toString(UINT32(curGenericField->mType)) + " vs. " + toString(UINT32(fieldType)));
+			}
+
+			if (isArray)
+			{
+				UINT32 arrayNumElems = 0;
+				if (data->read(&arrayNumElems, NUM_ELEM_FIELD_SIZE) != NUM_ELEM_FIELD_SIZE)
+				{
+					BS_EXCEPT(InternalErrorException, "Error decoding data.");
+				}
+
+				curGenericField->setArraySize(object, arrayNumElems);
+
+				switch (fieldType)
+				{
+				case SerializableFT_ReflectablePtr:
+				{
+					RTTIReflectablePtrFieldBase* curField = static_cast<RTTIReflectablePtrFieldBase*>(curGenericField);
+
+					for (UINT32 i = 0; i < arrayNumElems; i++)
+					{
+						UINT32 childObjectId = 0;
+						if (data->read(&childObjectId, COMPLEX_TYPE_FIELD_SIZE) != COMPLEX_TYPE_FIELD_SIZE)
+						{
+							BS_EXCEPT(InternalErrorException, "Error decoding data.");
+						}
+
+						SPtr<IReflectable> childObject = resolveObjectPtr(childObjectId, curField, data, dataEnd);
+						curField->setArrayValue(object, i, childObject);
+					}
+
+					break;
+				}
+				case SerializableFT_Reflectable:
+				{
+					RTTIReflectableFieldBase* curField = static_cast<RTTIReflectableFieldBase*>(curGenericField);
+
+					for (UINT32 i = 0; i < arrayNumElems; i++)
+					{
+						size_t childOffset = data->tell();
+
+						ObjectMetaData childMetaData;
+						childMetaData.objectMeta = 0;
+						childMetaData.typeId = 0;
+
+						if (data->read(&childMetaData, sizeof(ObjectMetaData)) != sizeof(ObjectMetaData))
+						{
+							BS_EXCEPT(InternalErrorException, "Error decoding data.");
+						}
+
+						data->seek(childOffset);
+
+						RTTITypeBase* childRtti = IReflectable::_getRTTIfromTypeId(childMetaData.typeId);
+						if (childRtti != nullptr)
+						{
+							SPtr<IReflectable> newObject = childRtti->newRTTIObject();
+							decodeEntryDirect(newObject, data, dataEnd);
+							curField->setArrayValue(object, i, *newObject);
+						}
+						else
+							skipRecordedEntry(data, dataEnd);
+					}
+
+					break;
+				}
+				case SerializableFT_Plain:
+				{
+					RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
+
+					if (!hasDynamicSize)
+					{
+						// All elements are the same size and tightly packed, so the entire array can be read at once
+						UINT8* arrayData = readPlainData(data, arrayNumElems * fieldSize);
+						curField->arrayFromBuffer(object, arrayNumElems, arrayData);
+					}
+					else
+					{
+						for (UINT32 i = 0; i < arrayNumElems; i++)
+						{
+							UINT32 typeSize = 0;
+							data->read(&typeSize, sizeof(UINT32));
+							data->seek(data->tell() - sizeof(UINT32));
+
+							curField->arrayElemFromBuffer(object, i, readPlainData(data, typeSize));
+						}
+					}
+
+					break;
+				}
+				default:
+					BS_EXCEPT(InternalErrorException,
+						"Error decoding data. Encountered a type I don't know how to decode. Type: " + toString(UINT32(fieldType)) +
+						", Is array: " + toString(isArray));
+				}
+			}
+			else
+			{
+				switch (fieldType)
+				{
+				case SerializableFT_ReflectablePtr:
+				{
+					RTTIReflectablePtrFieldBase* curField = static_cast<RTTIReflectablePtrFieldBase*>(curGenericField);
+
+					UINT32 childObjectId = 0;
+					if (data->read(&childObjectId, COMPLEX_TYPE_FIELD_SIZE) != COMPLEX_TYPE_FIELD_SIZE)
+					{
+						BS_EXCEPT(InternalErrorException, "Error decoding data.");
+					}
+
+					SPtr<IReflectable> childObject = resolveObjectPtr(childObjectId, curField, data, dataEnd);
+					curField->setValue(object, childObject);
+
+					break;
+				}
+				case SerializableFT_Reflectable:
+				{
+					RTTIReflectableFieldBase* curField = static_cast<RTTIReflectableFieldBase*>(curGenericField);
+
+					size_t childOffset = data->tell();
+
+					ObjectMetaData childMetaData;
+					childMetaData.objectMeta = 0;
+					childMetaData.typeId = 0;
+
+					if (data->read(&childMetaData, sizeof(ObjectMetaData)) != sizeof(ObjectMetaData))
+					{
+						BS_EXCEPT(InternalErrorException, "Error decoding data.");
+					}
+
+					data->seek(childOffset);
+
+					RTTITypeBase* childRtti = IReflectable::_getRTTIfromTypeId(childMetaData.typeId);
+					if (childRtti != nullptr)
+					{
+						SPtr<IReflectable> newObject = childRtti->newRTTIObject();
+						decodeEntryDirect(newObject, data, dataEnd);
+						curField->setValue(object, *newObject);
+					}
+					else
+						skipRecordedEntry(data, dataEnd);
+
+					break;
+				}
+				case SerializableFT_Plain:
+				{
+					RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
+
+					UINT32 typeSize = fieldSize;
+					if (hasDynamicSize)
+					{
+						data->read(&typeSize, sizeof(UINT32));
+						data->seek(data->tell() - sizeof(UINT32));
+					}
+
+					curField->fromBuffer(object, readPlainData(data, typeSize));
+					break;
+				}
+				case SerializableFT_DataBlock:
+				{
+					RTTIManagedDataBlockFieldBase* curField = static_cast<RTTIManagedDataBlockFieldBase*>(curGenericField);
+
+					// Data block size
+					UINT32 dataBlockSize = 0;
+					if (data->read(&dataBlockSize, DATA_BLOCK_TYPE_FIELD_SIZE) != DATA_BLOCK_TYPE_FIELD_SIZE)
+					{
+						BS_EXCEPT(InternalErrorException, "Error decoding data.");
+					}
+
+					// Data block data, read directly from the source stream. Setter isn't required to read all of it.
+					size_t dataBlockOffset = data->tell();
+					curField->setValue(object, data, dataBlockSize);
+					data->seek(dataBlockOffset + dataBlockSize);
+
+					break;
+				}
+				default:
+					BS_EXCEPT(InternalErrorException,
+						"Error decoding data. Encountered a type I don't know how to decode. Type: " + toString(UINT32(fieldType)) +
+						", Is array: " + toString(isArray));
+				}
+			}
+		}
+	}
+
+	SPtr<IReflectable> BinarySerializer::resolveObjectPtr(UINT32 objectId, RTTIField* field, const SPtr<DataStream>& data, 
+		size_t dataEnd)
+	{
+		if (objectId == 0)
+			return nullptr;
+
+		auto iterFind = mObjectLocations.find(objectId);
+		if (iterFind == mObjectLocations.end())
+			return nullptr;
+
+		ObjectLocation& location = iterFind->second;
+		if (location.object == nullptr)
+		{
+			RTTITypeBase* childRtti = IReflectable::_getRTTIfromTypeId(location.typeId);
+			if (childRtti == nullptr)
+				return nullptr;
+
+			location.object = childRtti->newRTTIObject();
+		}
+
+		bool needsDecoding = (field->getFlags() & RTTI_Flag_WeakRef) == 0 && !location.isDecoded;
+		if (needsDecoding)
+		{
+			if (location.decodeInProgress)
+			{
+				LOGWRN("Detected a circular reference when decoding. Referenced object's fields " \
+					"will be resolved in an undefined order (i.e. one of the objects will not " \
+					"be fully deserialized when assigned to its field). Use RTTI_Flag_WeakRef to " \
+					"get rid of this warning and tell the system which of the objects is allowed " \
+					"to be deserialized after it is assigned to its field.");
+			}
+			else
+			{
+				size_t returnOffset = data->tell();
+				data->seek(location.offset);
+
+				location.decodeInProgress = true;
+				decodeEntryDirect(location.object, data, dataEnd);
+				location.decodeInProgress = false;
+				location.isDecoded = true;
+
+				data->seek(returnOffset);
+			}
+		}
+
+		return location.object;
+	}
+
+	BinarySerializer::ObjectLocation* BinarySerializer::findObjectLocations(const SPtr<DataStream>& data, size_t dataEnd)
+	{
+		ObjectLocation* rootLocation = nullptr;
+		while (data->tell() < dataEnd)
+		{
+			size_t offset = data->tell();
+
+			ObjectMetaData objectMetaData;
+			objectMetaData.objectMeta = 0;
+			objectMetaData.typeId = 0;
+
+			if (data->read(&objectMetaData, sizeof(ObjectMetaData)) != sizeof(ObjectMetaData))
+			{
+				BS_EXCEPT(InternalErrorException, "Error decoding data.");
+			}
+
+			UINT32 objectId = 0;
+			UINT32 objectTypeId = 0;
+			bool objectIsBaseClass = false;
+			decodeObjectMetaData(objectMetaData, objectId, objectTypeId, objectIsBaseClass);
+
+			if (objectIsBaseClass)
+			{
+				BS_EXCEPT(InternalErrorException, "Encountered a base-class object while looking for a new object. " \
+					"Base class objects are only supposed to be parts of a larger object.");
+			}
+
+			auto iterNewObj = mObjectLocations.insert(std::make_pair(objectId, ObjectLocation(offset, objectTypeId)));
+			if (rootLocation == nullptr)
+				rootLocation = &iterNewObj.first->second;
+
+			data->seek(offset);
+			skipEntry(data, dataEnd);
+		}
+
+		return rootLocation;
+	}
+
+	bool BinarySerializer::skipEntry(const SPtr<DataStream>& data, size_t dataEnd)
+	{
+		size_t offset = data->tell();
+
+		ObjectMetaData objectMetaData;
+		objectMetaData.objectMeta = 0;
+		objectMetaData.typeId = 0;
+
+		if (data->read(&objectMetaData, sizeof(ObjectMetaData)) != sizeof(ObjectMetaData))
+		{
+			BS_EXCEPT(InternalErrorException, "Error decoding data.");
+		}
+
+		// Inline objects move their sub-objects out of the scratch buffer once scanned, so the sub-objects belonging 
+		// to this object stay contiguous
+		UINT32 scratchStart = (UINT32)mSubObjectScratch.size();
+		mSubObjectScratch.push_back({ offset, objectMetaData.typeId, nullptr });
+
+		bool foundNewObject = false;
+		while (data->tell() < dataEnd)
+		{
+			UINT32 metaData = 0;
+			if (data->read(&metaData, META_SIZE) != META_SIZE)
+			{
+				BS_EXCEPT(InternalErrorException, "Error decoding data.");
+			}
+
+			if (isObjectMetaData(metaData)) // We've reached a new object or a base class of the current one
+			{
+				ObjectMetaData objMetaData;
+				objMetaData.objectMeta = metaData;
+				objMetaData.typeId = 0;
+
+				if (data->read(&objMetaData.typeId, sizeof(UINT32)) != sizeof(UINT32))
+				{
+					BS_EXCEPT(InternalErrorException, "Error decoding data.");
+				}
+
+				UINT32 objId = 0;
+				UINT32 objTypeId = 0;
+				bool objIsBaseClass = false;
+				decodeObjectMetaData(objMetaData, objId, objTypeId, objIsBaseClass);
+
+				if (objIsBaseClass)
+				{
+					mSubObjectScratch.push_back({ data->tell() - sizeof(ObjectMetaData), objTypeId, nullptr });
+					continue;
+				}
+
+				// Found new object, we're done
+				data->seek(data->tell() - sizeof(ObjectMetaData));
+				foundNewObject = true;
+				break;
+			}
+
+			bool isArray;
+			SerializableFieldType fieldType;
+			UINT16 fieldId;
+			UINT8 fieldSize;
+			bool hasDynamicSize;
+			bool terminator;
+			decodeFieldMetaData(metaData, fieldId, fieldSize, isArray, fieldType, hasDynamicSize, terminator);
+
+			if (terminator)
+				break;
+
+			skipFieldData(data, dataEnd, fieldType, isArray, fieldSize, hasDynamicSize);
+		}
+
+		EntryLayout layout;
+		layout.firstSubObject = (UINT32)mSubObjectLocations.size();
+		layout.numSubObjects = (UINT32)mSubObjectScratch.size() - scratchStart;
+		layout.end = data->tell();
+
+		mSubObjectLocations.insert(mSubObjectLocations.end(), mSubObjectScratch.begin() + scratchStart, 
+			mSubObjectScratch.end());
+		mSubObjectScratch.resize(scratchStart);
+
+		mEntryLayouts[offset] = layout;
+		return foundNewObject;
+	}
+
+	void BinarySerializer::skipRecordedEntry(const SPtr<DataStream>& data, size_t dataEnd)
+	{
+		auto iterFind = mEntryLayouts.find(data->tell());
+		if (iterFind != mEntryLayouts.end())
+			data->seek(iterFind->second.end);
+		else
+			skipEntry(data, dataEnd);
+	}
+
+	void BinarySerializer::skipFieldData(const SPtr<DataStream>& data, size_t dataEnd, SerializableFieldType type, 
+		bool isArray, UINT8 fieldSize, bool hasDynamicSize)
+	{
+		UINT32 arrayNumElems = 1;
+		if (isArray)
+		{
+			if (data->read(&arrayNumElems, NUM_ELEM_FIELD_SIZE) != NUM_ELEM_FIELD_SIZE)
+			{
+				BS_EXCEPT(InternalErrorException, "Error decoding data.");
+			}
+		}
+
+		switch (type)
+		{
+		case SerializableFT_ReflectablePtr:
+			data->skip(arrayNumElems * COMPLEX_TYPE_FIELD_SIZE);
+			break;
+		case SerializableFT_Reflectable:
+			for (UINT32 i = 0; i < arrayNumElems; i++)
+				skipRecordedEntry(data, dataEnd);
+			break;
+		case SerializableFT_Plain:
+			if (hasDynamicSize)
+			{
+				for (UINT32 i = 0; i < arrayNumElems; i++)
+				{
+					// Dynamic size includes the size field itself
+					UINT32 typeSize = 0;
+					data->read(&typeSize, sizeof(UINT32));
+					data->skip(typeSize - sizeof(UINT32));
+				}
+			}
+			else
+				data->skip(arrayNumElems * fieldSize);
+			break;
+		case SerializableFT_DataBlock:
+		{
+			UINT32 dataBlockSize = 0;
+			if (data->read(&dataBlockSize, DATA_BLOCK_TYPE_FIELD_SIZE) != DATA_BLOCK_TYPE_FIELD_SIZE)
+			{
+				BS_EXCEPT(InternalErrorException, "Error decoding data.");
+			}
+
+			data->skip(dataBlockSize);
+			break;
+		}
+		default:
+			BS_EXCEPT(InternalErrorException,
+				"Error decoding data. Encountered a type I don't know how to decode. Type: " + toString(UINT32(type)) +
+				", Is array: " + toString(isArray));
+		}
+	}
+
+	UINT8* BinarySerializer::readPlainData(const SPtr<DataStream>& data, UINT32 size)
+	{
+		// Memory streams can be referenced directly
+		if (!data->isFile())
+		{
+			MemoryDataStream* memStream = static_cast<MemoryDataStream*>(data.get());
+			UINT8* output = memStream->getCurrentPtr();
+
+			data->skip(size);
+			return output;
+		}
+
+		if (mPlainDataBuffer.size() < size)
+			mPlainDataBuffer.resize(size);
+
+		if (data->read(mPlainDataBuffer.data(), size) != size)
+		{
+			BS_EXCEPT(InternalErrorException, "Error decoding data.");
+		}
+
+		return mPlainDataBuffer.data();
+	}
+
 	UINT32 BinarySerializer::encodeFieldMetaData(UINT16 id, UINT8 size, bool array, 
 		SerializableFieldType type, bool hasDynamicSize, bool terminator)
 	{
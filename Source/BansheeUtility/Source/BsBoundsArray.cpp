@@ -0,0 +1,97 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBoundsArray.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	BoundsArray::BoundsArray()
+		:mNumEntries(0)
+	{ }
+
+	void BoundsArray::add(const Bounds& bounds)
+	{
+		UINT32 idx = mNumEntries;
+		resize(mNumEntries + 1);
+
+		set(idx, bounds);
+	}
+
+	void BoundsArray::set(UINT32 idx, const Bounds& bounds)
+	{
+		assert(idx < mNumEntries);
+
+		const Sphere& sphere = bounds.getSphere();
+		const Vector3& sphereCenter = sphere.getCenter();
+
+		mSphereX[idx] = sphereCenter.x;
+		mSphereY[idx] = sphereCenter.y;
+		mSphereZ[idx] = sphereCenter.z;
+		mSphereRadius[idx] = sphere.getRadius();
+
+		const AABox& box = bounds.getBox();
+		Vector3 boxCenter = box.getCenter();
+		Vector3 boxExtents = box.getHalfSize();
+
+		mBoxX[idx] = boxCenter.x;
+		mBoxY[idx] = boxCenter.y;
+		mBoxZ[idx] = boxCenter.z;
+		mBoxExtentX[idx] = Math::abs(boxExtents.x);
+		mBoxExtentY[idx] = Math::abs(boxExtents.y);
+		mBoxExtentZ[idx] = Math::abs(boxExtents.z);
+	}
+
+	void BoundsArray::swap(UINT32 idx0, UINT32 idx1)
+	{
+		assert(idx0 < mNumEntries && idx1 < mNumEntries);
+
+		std::swap(mSphereX[idx0], mSphereX[idx1]);
+		std::swap(mSphereY[idx0], mSphereY[idx1]);
+		std::swap(mSphereZ[idx0], mSphereZ[idx1]);
+		std::swap(mSphereRadius[idx0], mSphereRadius[idx1]);
+
+		std::swap(mBoxX[idx0], mBoxX[idx1]);
+		std::swap(mBoxY[idx0], mBoxY[idx1]);
+		std::swap(mBoxZ[idx0], mBoxZ[idx1]);
+		std::swap(mBoxExtentX[idx0], mBoxExtentX[idx1]);
+		std::swap(mBoxExtentY[idx0], mBoxExtentY[idx1]);
+		std::swap(mBoxExtentZ[idx0], mBoxExtentZ[idx1]);
+	}
+
+	void BoundsArray::removeLast()
+	{
+		assert(mNumEntries > 0);
+
+		resize(mNumEntries - 1);
+	}
+
+	void BoundsArray::clear()
+	{
+		resize(0);
+	}
+
+	Vector3 BoundsArray::getBoxCenter(UINT32 idx) const
+	{
+		return Vector3(mBoxX[idx], mBoxY[idx], mBoxZ[idx]);
+	}
+
+	void BoundsArray::resize(UINT32 numEntries)
+	{
+		mNumEntries = numEntries;
+
+		// Pad so vector code can always read a full group of four
+		UINT32 paddedSize = (numEntries + 3) & ~3;
+
+		mSphereX.resize(paddedSize, 0.0f);
+		mSphereY.resize(paddedSize, 0.0f);
+		mSphereZ.resize(paddedSize, 0.0f);
+		mSphereRadius.resize(paddedSize, 0.0f);
+
+		mBoxX.resize(paddedSize, 0.0f);
+		mBoxY.resize(paddedSize, 0.0f);
+		mBoxZ.resize(paddedSize, 0.0f);
+		mBoxExtentX.resize(paddedSize, 0.0f);
+		mBoxExtentY.resize(paddedSize, 0.0f);
+		mBoxExtentZ.resize(paddedSize, 0.0f);
+	}
+}
@@ -6,6 +6,13 @@
 #include "BsPlane.h"
 #include "BsMath.h"
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	define BS_CULL_SSE 1
+#	include <xmmintrin.h>
+#else
+#	define BS_CULL_SSE 0
+#endif
+
 namespace BansheeEngine
 {
 	ConvexVolume::ConvexVolume(const Vector<Plane>& planes)
@@ -48,4 +55,123 @@ namespace BansheeEngine
 
 		return true;
 	}
+
+	void ConvexVolume::intersects(const BoundsArray& bounds, UINT32 start, UINT32 count, UINT32* visibility) const
+	{
+		assert((start % 4) == 0);
+		assert(start + count <= bounds.size());
+
+		UINT32 numWords = (count + 31) / 32;
+		memset(visibility, 0, numWords * sizeof(UINT32));
+
+		const float* sphereX = bounds.mSphereX.data();
+		const float* sphereY = bounds.mSphereY.data();
+		const float* sphereZ = bounds.mSphereZ.data();
+		const float* sphereRadius = bounds.mSphereRadius.data();
+
+		const float* boxX = bounds.mBoxX.data();
+		const float* boxY = bounds.mBoxY.data();
+		const float* boxZ = bounds.mBoxZ.data();
+		const float* boxExtentX = bounds.mBoxExtentX.data();
+		const float* boxExtentY = bounds.mBoxExtentY.data();
+		const float* boxExtentZ = bounds.mBoxExtentZ.data();
+
+		UINT32 numPlanes = (UINT32)mPlanes.size();
+
+#if BS_CULL_SSE
+		const __m128 zero = _mm_setzero_ps();
+		for (UINT32 i = 0; i < count; i += 4)
+		{
+			UINT32 idx = start + i;
+
+			// Spheres
+			__m128 cx = _mm_loadu_ps(sphereX + idx);
+			__m128 cy = _mm_loadu_ps(sphereY + idx);
+			__m128 cz = _mm_loadu_ps(sphereZ + idx);
+			__m128 negRadius = _mm_sub_ps(zero, _mm_loadu_ps(sphereRadius + idx));
+
+			__m128 inside = _mm_cmpeq_ps(zero, zero);
+			for (UINT32 j = 0; j < numPlanes; j++)
+			{
+				const Plane& plane = mPlanes[j];
+
+				__m128 dist = _mm_mul_ps(cx, _mm_set1_ps(plane.normal.x));
+				dist = _mm_add_ps(dist, _mm_mul_ps(cy, _mm_set1_ps(plane.normal.y)));
+				dist = _mm_add_ps(dist, _mm_mul_ps(cz, _mm_set1_ps(plane.normal.z)));
+				dist = _mm_sub_ps(dist, _mm_set1_ps(plane.d));
+
+				inside = _mm_and_ps(inside, _mm_cmpnlt_ps(dist, negRadius));
+			}
+
+			if (_mm_movemask_ps(inside) == 0)
+				continue;
+
+			// Boxes
+			cx = _mm_loadu_ps(boxX + idx);
+			cy = _mm_loadu_ps(boxY + idx);
+			cz = _mm_loadu_ps(boxZ + idx);
+
+			__m128 ex = _mm_loadu_ps(boxExtentX + idx);
+			__m128 ey = _mm_loadu_ps(boxExtentY + idx);
+			__m128 ez = _mm_loadu_ps(boxExtentZ + idx);
+
+			for (UINT32 j = 0; j < numPlanes; j++)
+			{
+				const Plane& plane = mPlanes[j];
+
+				__m128 dist = _mm_mul_ps(cx, _mm_set1_ps(plane.normal.x));
+				dist = _mm_add_ps(dist, _mm_mul_ps(cy, _mm_set1_ps(plane.normal.y)));
+				dist = _mm_add_ps(dist, _mm_mul_ps(cz, _mm_set1_ps(plane.normal.z)));
+				dist = _mm_sub_ps(dist, _mm_set1_ps(plane.d));
+
+				__m128 effectiveRadius = _mm_mul_ps(ex, _mm_set1_ps(Math::abs(plane.normal.x)));
+				effectiveRadius = _mm_add_ps(effectiveRadius, _mm_mul_ps(ey, _mm_set1_ps(Math::abs(plane.normal.y))));
+				effectiveRadius = _mm_add_ps(effectiveRadius, _mm_mul_ps(ez, _mm_set1_ps(Math::abs(plane.normal.z))));
+
+				inside = _mm_and_ps(inside, _mm_cmpnlt_ps(dist, _mm_sub_ps(zero, effectiveRadius)));
+			}
+
+			UINT32 mask = (UINT32)_mm_movemask_ps(inside);
+
+			// Discard padding entries past the requested range
+			UINT32 numValid = count - i;
+			if (numValid < 4)
+				mask &= (1U << numValid) - 1;
+
+			visibility[i / 32] |= mask << (i % 32);
+		}
+#else
+		for (UINT32 i = 0; i < count; i++)
+		{
+			UINT32 idx = start + i;
+
+			bool inside = true;
+			for (UINT32 j = 0; j < numPlanes && inside; j++)
+			{
+				const Plane& plane = mPlanes[j];
+
+				float dist = sphereX[idx] * plane.normal.x + sphereY[idx] * plane.normal.y + 
+					sphereZ[idx] * plane.normal.z - plane.d;
+
+				inside = !(dist < -sphereRadius[idx]);
+			}
+
+			for (UINT32 j = 0; j < numPlanes && inside; j++)
+			{
+				const Plane& plane = mPlanes[j];
+
+				float dist = boxX[idx] * plane.normal.x + boxY[idx] * plane.normal.y + boxZ[idx] * plane.normal.z - plane.d;
+
+				float effectiveRadius = boxExtentX[idx] * Math::abs(plane.normal.x);
+				effectiveRadius += boxExtentY[idx] * Math::abs(plane.normal.y);
+				effectiveRadius += boxExtentZ[idx] * Math::abs(plane.normal.z);
+
+				inside = !(dist < -effectiveRadius);
+			}
+
+			if (inside)
+				visibility[i / 32] |= 1U << (i % 32);
+		}
+#endif
+	}
 }
\ No newline at end of file
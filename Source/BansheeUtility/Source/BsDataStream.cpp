@@ -4,6 +4,15 @@
 #include "BsDebug.h"
 #include <codecvt>
 
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+#include "windows.h"
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace BansheeEngine 
 {
 	const UINT32 DataStream::StreamTempSize = 128;
@@ -368,6 +377,100 @@ namespace BansheeEngine
         }
     }
 
+	MemoryMappedDataStream::MemoryMappedDataStream(const Path& filePath)
+		:MemoryDataStream(nullptr, 0, false), mPath(filePath)
+	{
+		mAccess = READ;
+
+		void* mappedData = nullptr;
+		size_t mappedSize = 0;
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		WString pathWString = filePath.toWString();
+
+		HANDLE file = CreateFileW(pathWString.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (file != INVALID_HANDLE_VALUE)
+		{
+			// Empty files can't be mapped, and there's nothing to read from them anyway
+			LARGE_INTEGER fileSize;
+			if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+			{
+				// Mapping and the view keep their own references to the file, so handles can be closed right away
+				HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (mapping != nullptr)
+				{
+					mappedData = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+					mappedSize = (size_t)fileSize.QuadPart;
+
+					CloseHandle(mapping);
+				}
+			}
+
+			CloseHandle(file);
+		}
+#else
+		String pathString = filePath.toString();
+
+		int file = open(pathString.c_str(), O_RDONLY);
+		if (file != -1)
+		{
+			// Empty files can't be mapped, and there's nothing to read from them anyway
+			struct stat fileInfo;
+			if (fstat(file, &fileInfo) == 0 && fileInfo.st_size > 0)
+			{
+				void* mapping = mmap(nullptr, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+				if (mapping != MAP_FAILED)
+				{
+					mappedData = mapping;
+					mappedSize = (size_t)fileInfo.st_size;
+
+					madvise(mapping, mappedSize, MADV_SEQUENTIAL);
+				}
+			}
+
+			::close(file);
+		}
+#endif
+
+		// Not an error, callers are expected to fall back to reading the file normally
+		if (mappedData == nullptr)
+			return;
+
+		mData = mPos = (UINT8*)mappedData;
+		mSize = mappedSize;
+		mEnd = mData + mSize;
+	}
+
+	MemoryMappedDataStream::~MemoryMappedDataStream()
+	{
+		close();
+	}
+
+	SPtr<DataStream> MemoryMappedDataStream::clone(bool copyData) const
+	{
+		if (!copyData)
+			return bs_shared_ptr_new<MemoryMappedDataStream>(mPath);
+
+		return MemoryDataStream::clone(true);
+	}
+
+	void MemoryMappedDataStream::close()
+	{
+		if (mData != nullptr)
+		{
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+			UnmapViewOfFile(mData);
+#else
+			munmap(mData, mSize);
+#endif
+
+			mData = mPos = mEnd = nullptr;
+			mSize = 0;
+		}
+	}
+
     FileDataStream::FileDataStream(const Path& path, AccessMode accessMode, bool freeOnClose)
         : DataStream(accessMode), mPath(path), mFreeOnClose(freeOnClose)
     {
@@ -63,9 +63,17 @@ namespace BansheeEngine
 		return bufferStart;
 	}
 
-	FileDecoder::FileDecoder(const Path& fileLocation)
+	FileDecoder::FileDecoder(const Path& fileLocation, bool memoryMapped)
 	{
-		mInputStream = FileSystem::openFile(fileLocation, true);
+		if (memoryMapped)
+		{
+			SPtr<DataStream> mappedStream = bs_shared_ptr_new<MemoryMappedDataStream>(fileLocation);
+			if (mappedStream->isMemoryMapped())
+				mInputStream = mappedStream;
+		}
+
+		if (mInputStream == nullptr)
+			mInputStream = FileSystem::openFile(fileLocation, true);
 
 		if (mInputStream == nullptr)
 			return;
@@ -77,6 +85,10 @@ namespace BansheeEngine
 		}
 	}
 
+	FileDecoder::FileDecoder(const SPtr<DataStream>& stream)
+		:mInputStream(stream)
+	{ }
+
 	SPtr<IReflectable> FileDecoder::decode(const UnorderedMap<String, UINT64>& params)
 	{
 		if (mInputStream->eof())
@@ -31,12 +31,10 @@ namespace BansheeEngine
 
 	RTTIField* RTTITypeBase::findField(int uniqueFieldId)
 	{
-		auto foundElement = std::find_if(mFields.begin(), mFields.end(), [&uniqueFieldId](RTTIField* x) { return x->mUniqueId == uniqueFieldId; });
-
-		if(foundElement == mFields.end())
+		if(uniqueFieldId < 0 || uniqueFieldId >= (int)mFieldsById.size())
 			return nullptr;
 
-		return *foundElement;
+		return mFieldsById[uniqueFieldId];
 	}
 
 	void RTTITypeBase::addNewField(RTTIField* field)
@@ -66,6 +64,12 @@ namespace BansheeEngine
 		}
 
 		mFields.push_back(field);
+
+		// Field IDs are 16-bit and in practice small and densely packed, so a direct lookup table is cheap
+		if(uniqueId >= (int)mFieldsById.size())
+			mFieldsById.resize(uniqueId + 1, nullptr);
+
+		mFieldsById[uniqueId] = field;
 	}
 
 	SPtr<IReflectable> rtti_create(UINT32 rttiId)
@@ -0,0 +1,92 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRadixSort.h"
+
+namespace BansheeEngine
+{
+	void RadixSort::sort(UINT64* keys, UINT32* values, UINT64* tempKeys, UINT32* tempValues, UINT32 count, UINT32 numBits)
+	{
+		static const UINT32 DIGIT_BITS = 8;
+		static const UINT32 NUM_BUCKETS = 1 << DIGIT_BITS;
+
+		if (count <= 1)
+			return;
+
+		numBits = std::min(numBits, 64U);
+
+		UINT64* srcKeys = keys;
+		UINT32* srcValues = values;
+		UINT64* dstKeys = tempKeys;
+		UINT32* dstValues = tempValues;
+
+		UINT32 offsets[NUM_BUCKETS];
+		for (UINT32 shift = 0; shift < numBits; shift += DIGIT_BITS)
+		{
+			memset(offsets, 0, sizeof(offsets));
+
+			for (UINT32 i = 0; i < count; i++)
+			{
+				UINT32 digit = (UINT32)(srcKeys[i] >> shift) & (NUM_BUCKETS - 1);
+				offsets[digit]++;
+			}
+
+			// All keys share the same digit, ordering wouldn't change so skip the pass
+			UINT32 firstDigit = (UINT32)(srcKeys[0] >> shift) & (NUM_BUCKETS - 1);
+			if (offsets[firstDigit] == count)
+				continue;
+
+			UINT32 total = 0;
+			for (UINT32 i = 0; i < NUM_BUCKETS; i++)
+			{
+				UINT32 bucketSize = offsets[i];
+				offsets[i] = total;
+				total += bucketSize;
+			}
+
+			for (UINT32 i = 0; i < count; i++)
+			{
+				UINT32 digit = (UINT32)(srcKeys[i] >> shift) & (NUM_BUCKETS - 1);
+				UINT32 dstIdx = offsets[digit]++;
+
+				dstKeys[dstIdx] = srcKeys[i];
+				dstValues[dstIdx] = srcValues[i];
+			}
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcValues, dstValues);
+		}
+
+		// Ended up in the scratch buffers, copy back
+		if (srcKeys != keys)
+		{
+			memcpy(keys, srcKeys, count * sizeof(UINT64));
+			memcpy(values, srcValues, count * sizeof(UINT32));
+		}
+	}
+
+	UINT32 RadixSort::toSortableKey(float value)
+	{
+		// Ensure -0 and +0 produce the same key
+		if (value == 0.0f)
+			value = 0.0f;
+
+		UINT32 bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		// Flip all bits of negative numbers (so larger magnitudes sort first), and only the sign bit of positive ones
+		UINT32 mask = (UINT32)(-(INT32)(bits >> 31)) | 0x80000000;
+		return bits ^ mask;
+	}
+
+	UINT32 RadixSort::getNumBits(UINT64 value)
+	{
+		UINT32 numBits = 0;
+		while (value != 0)
+		{
+			numBits++;
+			value >>= 1;
+		}
+
+		return numBits;
+	}
+}
@@ -5,12 +5,166 @@
 
 namespace BansheeEngine
 {
+	/** Index of the worker the current thread belongs to, or -1 if the thread is not a TaskScheduler worker. */
+	static BS_THREADLOCAL UINT32 gTaskWorkerIdx = (UINT32)-1;
+
+	/**
+	 * Fixed size work-stealing deque (Chase-Lev). Only the owning thread may push and pop jobs (from the bottom), while
+	 * any other thread may steal jobs (from the top).
+	 */
+	class TaskJobDeque
+	{
+	public:
+		static const UINT32 CAPACITY = 4096;
+
+		TaskJobDeque()
+			:mTop(0), mBottom(0)
+		{
+			for (UINT32 i = 0; i < CAPACITY; i++)
+				mJobs[i].store(nullptr, std::memory_order_relaxed);
+		}
+
+		/** Pushes a job to the bottom of the deque. Returns false if the deque is full. Owner thread only. */
+		bool push(TaskJob* job)
+		{
+			INT64 bottom = mBottom.load(std::memory_order_relaxed);
+			INT64 top = mTop.load(std::memory_order_acquire);
+
+			if (bottom - top >= (INT64)CAPACITY)
+				return false;
+
+			mJobs[bottom & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		/** Pops the most recently pushed job, or returns null if the deque is empty. Owner thread only. */
+		TaskJob* pop()
+		{
+			INT64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			INT64 top = mTop.load(std::memory_order_relaxed);
+
+			TaskJob* job = nullptr;
+			if (top <= bottom)
+			{
+				job = mJobs[bottom & (CAPACITY - 1)].load(std::memory_order_relaxed);
+
+				// Last job, race against stealers
+				if (top == bottom)
+				{
+					if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						job = nullptr;
+
+					mBottom.store(bottom + 1, std::memory_order_relaxed);
+				}
+			}
+			else
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return job;
+		}
+
+		/** Steals the oldest job, or returns null if the deque is empty or another thread won the race. */
+		TaskJob* steal()
+		{
+			INT64 top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			INT64 bottom = mBottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return nullptr;
+
+			TaskJob* job = mJobs[top & (CAPACITY - 1)].load(std::memory_order_relaxed);
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return job;
+		}
+
+	private:
+		std::atomic<INT64> mTop;
+		UINT8 mPadding[64];
+		std::atomic<INT64> mBottom;
+		std::atomic<TaskJob*> mJobs[CAPACITY];
+	};
+
+	struct ParallelForData;
+
+	/** Job executing a part of the range provided to TaskScheduler::parallelFor(). */
+	struct ParallelForJob : TaskJob
+	{
+		ParallelForData* data;
+		UINT32 firstChunk;
+		UINT32 lastChunk;
+	};
+
+	/** Information shared by all jobs created by a single TaskScheduler::parallelFor() call. */
+	struct ParallelForData
+	{
+		TaskScheduler* scheduler;
+		void(*func)(void*, UINT32, UINT32);
+		void* funcData;
+		UINT32 begin;
+		UINT32 end;
+		UINT32 granularity;
+		ParallelForJob* jobs;
+		std::atomic<UINT32> numPending;
+	};
+
+	/**
+	 * Executes a parallel-for job. The job keeps splitting off the upper half of its range into new jobs (to be picked
+	 * up by other workers) until it is left with a single chunk, which it executes.
+	 */
+	static void executeParallelFor(TaskJob* job)
+	{
+		ParallelForJob* pfJob = static_cast<ParallelForJob*>(job);
+		ParallelForData* data = pfJob->data;
+
+		UINT32 first = pfJob->firstChunk;
+		UINT32 last = pfJob->lastChunk;
+		while ((last - first) > 1)
+		{
+			UINT32 mid = first + (last - first) / 2;
+
+			// Each split point is unique, so the chunk index can be used as storage for the new job
+			ParallelForJob& child = data->jobs[mid];
+			child.execute = &executeParallelFor;
+			child.priority = TaskPriority::High;
+			child.order = 0;
+			child.data = data;
+			child.firstChunk = mid;
+			child.lastChunk = last;
+
+			data->numPending.fetch_add(1, std::memory_order_relaxed);
+			data->scheduler->_queueJob(&child);
+
+			last = mid;
+		}
+
+		UINT32 rangeBegin = data->begin + first * data->granularity;
+		UINT32 rangeEnd = std::min(data->end, rangeBegin + data->granularity);
+		data->func(data->funcData, rangeBegin, rangeEnd);
+
+		data->numPending.fetch_sub(1, std::memory_order_release);
+	}
+
+	struct TaskScheduler::WorkerData
+	{
+		TaskJobDeque deque;
+		HThread thread;
+	};
+
 	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker, 
 		TaskPriority priority, SPtr<Task> dependency)
-		:mName(name), mPriority(priority), mTaskId(0), mTaskWorker(taskWorker), mTaskDependency(dependency),
-		mParent(nullptr)
+		:mName(name), mTaskWorker(taskWorker), mTaskDependency(dependency), mState(0), mNumPending(1), mParent(nullptr)
 	{
-
+		execute = &TaskScheduler::executeTask;
+		this->priority = priority;
+		order = 0;
 	}
 
 	SPtr<Task> Task::create(const String& name, std::function<void()> taskWorker, TaskPriority priority, SPtr<Task> dependency)
@@ -35,154 +189,410 @@ namespace BansheeEngine
 
 	void Task::cancel()
 	{
-		mState.store(3);
+		UINT32 expectedState = 0;
+		if (!mState.compare_exchange_strong(expectedState, 3))
+			return;
+
+		// Dependents might never get released if this task is never queued, so cancel them right away
+		if (TaskScheduler::isStarted())
+			TaskScheduler::instance().cancelDependents(this);
 	}
 
 	TaskScheduler::TaskScheduler()
-		:mTaskQueue(&TaskScheduler::taskCompare), mMaxActiveTasks(0), mNextTaskId(0), mShutdown(false)
+		:mNumWorkerThreads(0), mMaxActiveTasks(0), mNextJobOrder(0), mShutdown(false), mNumSharedJobs(0)
+		, mNumQueuedJobs(0), mNumActiveTasks(0), mNumIdleThreads(0)
 	{
-		mMaxActiveTasks = BS_THREAD_HARDWARE_CONCURRENCY;
+		for (UINT32 i = 0; i < MAX_WORKERS; i++)
+			mWorkers[i] = nullptr;
 
-		mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
+		mMaxActiveTasks = getDefaultNumWorkers();
+
+		spawnWorkers();
 	}
 
 	TaskScheduler::~TaskScheduler()
 	{
 		// Wait until all tasks complete
+		while (mNumActiveTasks.load() > 0)
+		{
+			if (!_runPendingJob())
+				std::this_thread::yield();
+		}
+
+		// Shut down the workers and wait until they exit
+		{
+			Lock lock(mIdleMutex);
+			mShutdown = true;
+		}
+
+		mIdleCond.notify_all();
+		mParkCond.notify_all();
+
+		// All workers need to exit before any are destroyed, as they might still be stealing from each other
+		UINT32 numWorkers = mNumWorkerThreads.load();
+		for (UINT32 i = 0; i < numWorkers; i++)
+			mWorkers[i]->thread.blockUntilComplete();
+
+		for (UINT32 i = 0; i < numWorkers; i++)
+			bs_delete(mWorkers[i]);
+	}
+
+	void TaskScheduler::addTask(const SPtr<Task>& task, const SPtr<Task>& parent)
+	{
+		task->mParent = this;
+
+		if (parent != nullptr)
 		{
-			Lock activeTaskLock(mReadyMutex);
+			// Parent's own work keeps the counter above zero until it finishes executing
+			UINT32 numPending = parent->mNumPending.fetch_add(1);
+			BS_ASSERT(numPending > 0);
+
+			task->mParentTask = parent;
+		}
 
-			while (mActiveTasks.size() > 0)
+		if (task->mTaskDependency != nullptr)
+		{
+			bool dependencyCanceled = false;
 			{
-				SPtr<Task> task = mActiveTasks[0];
-				activeTaskLock.unlock();
+				Lock lock(mDependencyMutex);
+
+				Task* dependency = task->mTaskDependency.get();
+				if (!dependency->isComplete())
+				{
+					dependencyCanceled = dependency->isCanceled();
+
+					if (!dependencyCanceled)
+					{
+						dependency->mDependents.push_back(task);
+						return;
+					}
+				}
+			}
 
-				task->wait();
-				activeTaskLock.lock();
+			// Task can never start
+			if (dependencyCanceled)
+			{
+				completeTask(task.get(), false);
+				return;
 			}
 		}
 
-		// Start shutdown of the main queue worker and wait until it exits
-		{
-			Lock lock(mReadyMutex);
+		queueTask(task);
+	}
 
-			mShutdown = true;
+	void TaskScheduler::_parallelFor(UINT32 begin, UINT32 end, UINT32 granularity, void(*func)(void*, UINT32, UINT32),
+		void* data)
+	{
+		if (begin >= end)
+			return;
+
+		granularity = std::max(granularity, 1U);
+		UINT32 numChunks = (end - begin + granularity - 1) / granularity;
+		if (numChunks == 1)
+		{
+			func(data, begin, end);
+			return;
 		}
 
-		mTaskReadyCond.notify_one();
+		ParallelForData pfData;
+		pfData.scheduler = this;
+		pfData.func = func;
+		pfData.funcData = data;
+		pfData.begin = begin;
+		pfData.end = end;
+		pfData.granularity = granularity;
+		pfData.jobs = bs_allocN<ParallelForJob>(numChunks);
+		pfData.numPending = 1;
+
+		ParallelForJob& rootJob = pfData.jobs[0];
+		rootJob.execute = &executeParallelFor;
+		rootJob.priority = TaskPriority::High;
+		rootJob.order = 0;
+		rootJob.data = &pfData;
+		rootJob.firstChunk = 0;
+		rootJob.lastChunk = numChunks;
+
+		executeParallelFor(&rootJob);
+
+		// Help with the remaining chunks (or any other work) until all chunks are done
+		while (pfData.numPending.load(std::memory_order_acquire) > 0)
+		{
+			if (!_runPendingJob())
+				std::this_thread::yield();
+		}
 
-		mTaskSchedulerThread.blockUntilComplete();
+		bs_free(pfData.jobs);
 	}
 
-	void TaskScheduler::addTask(const SPtr<Task>& task)
+	void TaskScheduler::_queueJob(TaskJob* job)
 	{
-		Lock lock(mReadyMutex);
+		// Increment before the job becomes visible, so the counter never goes negative
+		mNumQueuedJobs.fetch_add(1);
 
-		task->mParent = this;
-		task->mTaskId = mNextTaskId++;
+		UINT32 workerIdx = gTaskWorkerIdx;
+		if (workerIdx == (UINT32)-1 || !mWorkers[workerIdx]->deque.push(job))
+		{
+			Lock lock(mSharedQueueMutex);
 
-		mTaskQueue.insert(task);
+			job->order = mNextJobOrder++;
+			mSharedQueue.push_back(job);
+			std::push_heap(mSharedQueue.begin(), mSharedQueue.end(), &TaskScheduler::jobCompare);
 
-		// Wake main scheduler thread
-		mTaskReadyCond.notify_one();
+			mNumSharedJobs.fetch_add(1);
+		}
+
+		notifyIdle(false);
 	}
 
-	void TaskScheduler::addWorker()
+	bool TaskScheduler::_runPendingJob()
 	{
-		Lock lock(mReadyMutex);
+		TaskJob* job = findJob(gTaskWorkerIdx);
+		if (job == nullptr)
+			return false;
+
+		job->execute(job);
+		return true;
+	}
 
-		mMaxActiveTasks++;
+	void TaskScheduler::addWorker()
+	{
+		{
+			Lock lock(mIdleMutex);
+			mMaxActiveTasks++;
+		}
 
-		// A spot freed up, queue new tasks on main scheduler thread if they exist
-		mTaskReadyCond.notify_one();
+		// A spot freed up, wake a parked worker (or create a new one)
+		mParkCond.notify_all();
+		spawnWorkers();
 	}
 
 	void TaskScheduler::removeWorker()
 	{
-		Lock lock(mReadyMutex);
+		Lock lock(mIdleMutex);
 
 		if(mMaxActiveTasks > 0)
 			mMaxActiveTasks--;
 	}
 
-	void TaskScheduler::runMain()
+	void TaskScheduler::runWorker(UINT32 idx)
 	{
-		while(true)
+		gTaskWorkerIdx = idx;
+
+		while (true)
 		{
-			Lock lock(mReadyMutex);
+			if (mShutdown.load())
+				break;
 
-			while((mTaskQueue.size() == 0 || (UINT32)mActiveTasks.size() >= mMaxActiveTasks) && !mShutdown)
-				mTaskReadyCond.wait(lock);
+			// Park workers over the active limit. Any jobs left in their deque will get stolen by others.
+			if (idx >= mMaxActiveTasks.load())
+			{
+				Lock lock(mIdleMutex);
 
-			if(mShutdown)
-				break;
+				while (idx >= mMaxActiveTasks.load() && !mShutdown.load())
+					mParkCond.wait(lock);
+
+				continue;
+			}
+
+			if (_runPendingJob())
+				continue;
+
+			Lock lock(mIdleMutex);
+			mNumIdleThreads++;
+
+			while (mNumQueuedJobs.load() == 0 && idx < mMaxActiveTasks.load() && !mShutdown.load())
+				mIdleCond.wait(lock);
+
+			mNumIdleThreads--;
+		}
 
-			for(UINT32 i = 0; (i < mTaskQueue.size()) && ((UINT32)mActiveTasks.size() < mMaxActiveTasks); i++)
+		gTaskWorkerIdx = (UINT32)-1;
+	}
+
+	void TaskScheduler::spawnWorkers()
+	{
+		Lock lock(mSpawnMutex);
+
+		UINT32 numWorkers = mNumWorkerThreads.load();
+		UINT32 maxWorkers = MAX_WORKERS;
+		UINT32 numRequired = std::min(mMaxActiveTasks.load(), maxWorkers);
+		for (UINT32 i = numWorkers; i < numRequired; i++)
+		{
+			WorkerData* worker = bs_new<WorkerData>();
+			mWorkers[i] = worker;
+			mNumWorkerThreads.store(i + 1);
+
+			worker->thread = ThreadPool::instance().run("TaskWorker", std::bind(&TaskScheduler::runWorker, this, i));
+		}
+	}
+
+	TaskJob* TaskScheduler::findJob(UINT32 workerIdx)
+	{
+		TaskJob* job = nullptr;
+
+		// Local jobs first, most recent ones are likely still in cache
+		if (workerIdx != (UINT32)-1)
+			job = mWorkers[workerIdx]->deque.pop();
+
+		// Jobs queued from outside of the worker threads
+		if (job == nullptr && mNumSharedJobs.load() > 0)
+		{
+			Lock lock(mSharedQueueMutex);
+
+			if (!mSharedQueue.empty())
 			{
-				SPtr<Task> curTask = *mTaskQueue.begin();
-				mTaskQueue.erase(mTaskQueue.begin());
+				std::pop_heap(mSharedQueue.begin(), mSharedQueue.end(), &TaskScheduler::jobCompare);
+				job = mSharedQueue.back();
+				mSharedQueue.pop_back();
 
-				if(curTask->isCanceled())
-					continue;
+				mNumSharedJobs.fetch_sub(1);
+			}
+		}
 
-				if(curTask->mTaskDependency != nullptr && !curTask->mTaskDependency->isComplete())
-					continue;
+		// Steal from other workers, starting with the next one so thieves spread out
+		if (job == nullptr)
+		{
+			UINT32 numWorkers = mNumWorkerThreads.load();
+			UINT32 start = workerIdx != (UINT32)-1 ? workerIdx + 1 : 0;
 
-				curTask->mState.store(1);
-				mActiveTasks.push_back(curTask);
+			for (UINT32 i = 0; i < numWorkers && job == nullptr; i++)
+			{
+				UINT32 victimIdx = (start + i) % numWorkers;
+				if (victimIdx == workerIdx)
+					continue;
 
-				ThreadPool::instance().run(curTask->mName, std::bind(&TaskScheduler::runTask, this, curTask));
+				job = mWorkers[victimIdx]->deque.steal();
 			}
 		}
+
+		if (job != nullptr)
+			mNumQueuedJobs.fetch_sub(1);
+
+		return job;
+	}
+
+	UINT32 TaskScheduler::getDefaultNumWorkers()
+	{
+		return std::min((UINT32)BS_THREAD_HARDWARE_CONCURRENCY, MAX_WORKERS);
+	}
+
+	void TaskScheduler::queueTask(const SPtr<Task>& task)
+	{
+		task->mSelf = task;
+		mNumActiveTasks.fetch_add(1);
+
+		_queueJob(task.get());
+	}
+
+	void TaskScheduler::finishTask(Task* task, bool executed)
+	{
+		// Children might still be running, in which case the last one to finish completes the task
+		if (task->mNumPending.fetch_sub(1) == 1)
+			completeTask(task, executed);
+	}
+
+	void TaskScheduler::cancelDependents(Task* task)
+	{
+		Vector<SPtr<Task>> dependents;
+		{
+			Lock lock(mDependencyMutex);
+			std::swap(dependents, task->mDependents);
+		}
+
+		for (auto& dependent : dependents)
+			completeTask(dependent.get(), false);
 	}
 
-	void TaskScheduler::runTask(SPtr<Task> task)
+	void TaskScheduler::completeTask(Task* task, bool executed)
 	{
-		task->mTaskWorker();
+		// Parent might have been canceled before it started, while its children were already queued
+		if (task->isCanceled())
+			executed = false;
 
+		Vector<SPtr<Task>> dependents;
 		{
-			Lock lock(mReadyMutex);
+			Lock lock(mDependencyMutex);
 
-			auto findIter = std::find(mActiveTasks.begin(), mActiveTasks.end(), task);
-			if (findIter != mActiveTasks.end())
-				mActiveTasks.erase(findIter);
+			task->mState.store(executed ? 2 : 3);
+			std::swap(dependents, task->mDependents);
 		}
 
+		// Dependents of a canceled task can never start, so they are canceled as well. They were never queued, so they
+		// can be completed right away.
+		for (auto& dependent : dependents)
 		{
-			Lock lock(mCompleteMutex);
-			task->mState.store(2);
+			if (executed)
+				queueTask(dependent);
+			else
+				completeTask(dependent.get(), false);
+		}
 
-			mTaskCompleteCond.notify_all();
+		if (task->mParentTask != nullptr)
+		{
+			SPtr<Task> parentTask = std::move(task->mParentTask);
+			finishTask(parentTask.get(), true);
 		}
 
-		// Possibly this task was someones dependency, so wake the main scheduler thread
-		mTaskReadyCond.notify_one();
+		// Someone might be waiting on this task
+		notifyIdle(true);
 	}
 
-	void TaskScheduler::waitUntilComplete(const Task* task)
+	void TaskScheduler::notifyIdle(bool all)
 	{
-		if(task->isCanceled())
+		if (mNumIdleThreads.load() == 0)
 			return;
 
+		Lock lock(mIdleMutex);
+
+		if (all)
+			mIdleCond.notify_all();
+		else
+			mIdleCond.notify_one();
+	}
+
+	void TaskScheduler::waitUntilComplete(const Task* task)
+	{
+		while (!task->isComplete() && !task->isCanceled())
 		{
-			Lock lock(mCompleteMutex);
-			
-			while(!task->isComplete())
-			{
-				addWorker();
-				mTaskCompleteCond.wait(lock);
-				removeWorker();
-			}
+			// Help out instead of blocking
+			if (_runPendingJob())
+				continue;
+
+			Lock lock(mIdleMutex);
+			mNumIdleThreads++;
+
+			while (!task->isComplete() && !task->isCanceled() && mNumQueuedJobs.load() == 0)
+				mIdleCond.wait(lock);
+
+			mNumIdleThreads--;
 		}
 	}
 
-	bool TaskScheduler::taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs)
+	void TaskScheduler::executeTask(TaskJob* job)
 	{
-		// If one tasks priority is higher, that one goes first
-		if(lhs->mPriority > rhs->mPriority)
-			return true;
+		Task* task = static_cast<Task*>(job);
+
+		// Keep the task alive until we're done with it
+		SPtr<Task> self = std::move(task->mSelf);
+		TaskScheduler* scheduler = task->mParent;
+
+		UINT32 expectedState = 0;
+		bool executed = task->mState.compare_exchange_strong(expectedState, 1);
+
+		if (executed)
+			task->mTaskWorker();
+
+		scheduler->finishTask(task, executed);
+		scheduler->mNumActiveTasks.fetch_sub(1);
+	}
+
+	bool TaskScheduler::jobCompare(const TaskJob* lhs, const TaskJob* rhs)
+	{
+		// Max-heap, so jobs that should execute later compare as smaller. Higher priority goes first, otherwise the job
+		// queued earlier goes first.
+		if (lhs->priority != rhs->priority)
+			return lhs->priority < rhs->priority;
 
-		// Otherwise we go by smaller id, as that task was queued earlier than the other
-		return lhs->mTaskId < rhs->mTaskId;
+		return lhs->order > rhs->order;
 	}
 }
\ No newline at end of file
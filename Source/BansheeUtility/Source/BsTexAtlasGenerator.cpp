@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsTexAtlasGenerator.h"
 #include "BsDebug.h"
+#include "BsTaskScheduler.h"
 
 namespace BansheeEngine
 {
@@ -94,9 +95,480 @@ namespace BansheeEngine
 		}
 	};
 
-	TexAtlasGenerator::TexAtlasGenerator(bool square, UINT32 maxTexWidth, UINT32 maxTexHeight, bool fixedSize)
-		:mSquare(square), mFixedSize(fixedSize), mMaxTexWidth(maxTexWidth), mMaxTexHeight(maxTexHeight)
+	/** 
+	 * Packs elements into a single page using the Skyline algorithm. Areas left unused below the skyline are kept track
+	 * of, and are filled with later elements that fit in them.
+	 */
+	class TexAtlasSkyline
 	{
+		/** Horizontal segment of the top edge of the placed elements. */
+		struct Node
+		{
+			UINT32 x, y, width;
+		};
+
+		/** Unused area below the skyline. */
+		struct WasteRect
+		{
+			UINT32 x, y, width, height;
+		};
+
+	public:
+		TexAtlasSkyline(UINT32 width, UINT32 height)
+			:mWidth(width), mHeight(height)
+		{
+			Node node;
+			node.x = 0;
+			node.y = 0;
+			node.width = width;
+
+			mNodes.push_back(node);
+		}
+
+		bool insert(TexAtlasElementDesc& element)
+		{
+			UINT32 width = element.input.width;
+			UINT32 height = element.input.height;
+
+			if(insertIntoWaste(element))
+				return true;
+
+			UINT64 bestScore1 = std::numeric_limits<UINT64>::max();
+			UINT64 bestScore2 = std::numeric_limits<UINT64>::max();
+			INT32 bestIdx = -1;
+			UINT32 bestY = 0;
+
+			for(UINT32 i = 0; i < (UINT32)mNodes.size(); i++)
+			{
+				UINT32 y;
+				if(!fits(i, width, height, y))
+					continue;
+
+				UINT64 score1 = y + height;
+				UINT64 score2 = mNodes[i].width;
+
+				if(score1 < bestScore1 || (score1 == bestScore1 && score2 < bestScore2))
+				{
+					bestScore1 = score1;
+					bestScore2 = score2;
+					bestIdx = (INT32)i;
+					bestY = y;
+				}
+			}
+
+			if(bestIdx == -1)
+				return false;
+
+			element.output.x = mNodes[bestIdx].x;
+			element.output.y = bestY;
+
+			addWaste((UINT32)bestIdx, width, bestY);
+			addLevel((UINT32)bestIdx, element.output.x, bestY + height, width);
+			return true;
+		}
+
+	private:
+		/** Attempts to place the element in the best fitting unused area below the skyline. */
+		bool insertIntoWaste(TexAtlasElementDesc& element)
+		{
+			UINT32 width = element.input.width;
+			UINT32 height = element.input.height;
+
+			UINT64 bestArea = std::numeric_limits<UINT64>::max();
+			INT32 bestIdx = -1;
+			for(UINT32 i = 0; i < (UINT32)mWasteRects.size(); i++)
+			{
+				const WasteRect& rect = mWasteRects[i];
+				if(width > rect.width || height > rect.height)
+					continue;
+
+				UINT64 area = (UINT64)rect.width * rect.height;
+				if(area < bestArea)
+				{
+					bestArea = area;
+					bestIdx = (INT32)i;
+				}
+			}
+
+			if(bestIdx == -1)
+				return false;
+
+			WasteRect rect = mWasteRects[bestIdx];
+			mWasteRects[bestIdx] = mWasteRects.back();
+			mWasteRects.pop_back();
+
+			element.output.x = rect.x;
+			element.output.y = rect.y;
+
+			// Split the remaining area in two, giving the larger part the longer of the leftover sides
+			WasteRect right = { rect.x + width, rect.y, rect.width - width, 0 };
+			WasteRect top = { rect.x, rect.y + height, 0, rect.height - height };
+			if(right.width < top.height)
+			{
+				right.height = height;
+				top.width = rect.width;
+			}
+			else
+			{
+				right.height = rect.height;
+				top.width = width;
+			}
+
+			if(right.width > 0 && right.height > 0)
+				mWasteRects.push_back(right);
+
+			if(top.width > 0 && top.height > 0)
+				mWasteRects.push_back(top);
+
+			return true;
+		}
+
+		/** Records the areas between the skyline and an element placed at the specified node and height as unused. */
+		void addWaste(UINT32 nodeIdx, UINT32 width, UINT32 y)
+		{
+			UINT32 widthLeft = width;
+			for(UINT32 i = nodeIdx; widthLeft > 0; i++)
+			{
+				UINT32 spanWidth = std::min(widthLeft, mNodes[i].width);
+				if(mNodes[i].y < y)
+				{
+					WasteRect rect = { mNodes[i].x, mNodes[i].y, spanWidth, y - mNodes[i].y };
+					mWasteRects.push_back(rect);
+				}
+
+				widthLeft -= spanWidth;
+			}
+		}
+
+		/** 
+		 * Checks if an element can be placed with its left edge at the start of the specified node, and returns the
+		 * lowest position it can be placed at.
+		 */
+		bool fits(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32& y) const
+		{
+			UINT32 x = mNodes[nodeIdx].x;
+			if(x + width > mWidth)
+				return false;
+
+			// Find the highest node the element spans
+			y = 0;
+			UINT32 widthLeft = width;
+			for(UINT32 i = nodeIdx; widthLeft > 0; i++)
+			{
+				y = std::max(y, mNodes[i].y);
+				if(y + height > mHeight)
+					return false;
+
+				widthLeft -= std::min(widthLeft, mNodes[i].width);
+			}
+
+			return true;
+		}
+
+		/** Adds a new segment to the skyline, and removes or shortens the segments it covers. */
+		void addLevel(UINT32 nodeIdx, UINT32 x, UINT32 y, UINT32 width)
+		{
+			Node newNode;
+			newNode.x = x;
+			newNode.y = y;
+			newNode.width = width;
+
+			mNodes.insert(mNodes.begin() + nodeIdx, newNode);
+
+			for(UINT32 i = nodeIdx + 1; i < (UINT32)mNodes.size();)
+			{
+				UINT32 prevEnd = mNodes[i - 1].x + mNodes[i - 1].width;
+				if(mNodes[i].x >= prevEnd)
+					break;
+
+				UINT32 shrink = prevEnd - mNodes[i].x;
+				if(mNodes[i].width <= shrink)
+				{
+					mNodes.erase(mNodes.begin() + i);
+					continue;
+				}
+
+				mNodes[i].x += shrink;
+				mNodes[i].width -= shrink;
+				break;
+			}
+
+			// Merge neighboring segments of the same height
+			for(UINT32 i = 0; i + 1 < (UINT32)mNodes.size();)
+			{
+				if(mNodes[i].y == mNodes[i + 1].y)
+				{
+					mNodes[i].width += mNodes[i + 1].width;
+					mNodes.erase(mNodes.begin() + i + 1);
+				}
+				else
+					i++;
+			}
+		}
+
+		UINT32 mWidth, mHeight;
+		Vector<Node> mNodes;
+		Vector<WasteRect> mWasteRects;
+	};
+
+	/** Packs elements into a single page using the MaxRects algorithm. */
+	class TexAtlasMaxRects
+	{
+		struct Rect
+		{
+			UINT32 x, y, width, height;
+
+			bool contains(const Rect& other) const
+			{
+				return other.x >= x && other.y >= y && other.x + other.width <= x + width && 
+					other.y + other.height <= y + height;
+			}
+		};
+
+	public:
+		TexAtlasMaxRects(UINT32 width, UINT32 height, TexAtlasHeuristic heuristic)
+			:mWidth(width), mHeight(height), mHeuristic(heuristic)
+		{
+			Rect rect;
+			rect.x = 0;
+			rect.y = 0;
+			rect.width = width;
+			rect.height = height;
+
+			mFreeRects.push_back(rect);
+		}
+
+		bool insert(TexAtlasElementDesc& element)
+		{
+			UINT32 width = element.input.width;
+			UINT32 height = element.input.height;
+
+			INT64 bestScore1 = std::numeric_limits<INT64>::max();
+			INT64 bestScore2 = std::numeric_limits<INT64>::max();
+			INT32 bestIdx = -1;
+
+			for(UINT32 i = 0; i < (UINT32)mFreeRects.size(); i++)
+			{
+				const Rect& freeRect = mFreeRects[i];
+				if(width > freeRect.width || height > freeRect.height)
+					continue;
+
+				INT64 leftoverX = freeRect.width - width;
+				INT64 leftoverY = freeRect.height - height;
+
+				INT64 score1, score2;
+				switch(mHeuristic)
+				{
+				default:
+				case TexAtlasHeuristic::BestShortSideFit:
+					score1 = std::min(leftoverX, leftoverY);
+					score2 = std::max(leftoverX, leftoverY);
+					break;
+				case TexAtlasHeuristic::BestLongSideFit:
+					score1 = std::max(leftoverX, leftoverY);
+					score2 = std::min(leftoverX, leftoverY);
+					break;
+				case TexAtlasHeuristic::BestAreaFit:
+					score1 = (INT64)freeRect.width * freeRect.height - (INT64)width * height;
+					score2 = std::min(leftoverX, leftoverY);
+					break;
+				case TexAtlasHeuristic::BottomLeft:
+					score1 = freeRect.y + height;
+					score2 = freeRect.x;
+					break;
+				case TexAtlasHeuristic::ContactPoint:
+					score1 = -(INT64)getContactLength(freeRect.x, freeRect.y, width, height);
+					score2 = freeRect.y + height;
+					break;
+				}
+
+				if(score1 < bestScore1 || (score1 == bestScore1 && score2 < bestScore2))
+				{
+					bestScore1 = score1;
+					bestScore2 = score2;
+					bestIdx = (INT32)i;
+				}
+			}
+
+			if(bestIdx == -1)
+				return false;
+
+			Rect usedRect;
+			usedRect.x = mFreeRects[bestIdx].x;
+			usedRect.y = mFreeRects[bestIdx].y;
+			usedRect.width = width;
+			usedRect.height = height;
+
+			place(usedRect);
+
+			element.output.x = usedRect.x;
+			element.output.y = usedRect.y;
+			return true;
+		}
+
+	private:
+		/** Returns the length of the element edges touching the page edges or other elements. */
+		UINT32 getContactLength(UINT32 x, UINT32 y, UINT32 width, UINT32 height) const
+		{
+			UINT32 length = 0;
+			if(x == 0 || x + width == mWidth)
+				length += height;
+
+			if(y == 0 || y + height == mHeight)
+				length += width;
+
+			for(auto& usedRect : mUsedRects)
+			{
+				if(usedRect.x == x + width || usedRect.x + usedRect.width == x)
+					length += getOverlap(usedRect.y, usedRect.y + usedRect.height, y, y + height);
+
+				if(usedRect.y == y + height || usedRect.y + usedRect.height == y)
+					length += getOverlap(usedRect.x, usedRect.x + usedRect.width, x, x + width);
+			}
+
+			return length;
+		}
+
+		/** Returns the length of the overlap between two intervals. */
+		static UINT32 getOverlap(UINT32 start0, UINT32 end0, UINT32 start1, UINT32 end1)
+		{
+			if(end0 <= start1 || end1 <= start0)
+				return 0;
+
+			return std::min(end0, end1) - std::max(start0, start1);
+		}
+
+		/** Marks the provided area as used, splitting any free rectangles it intersects. */
+		void place(const Rect& usedRect)
+		{
+			mNewFreeRects.clear();
+
+			for(UINT32 i = 0; i < (UINT32)mFreeRects.size();)
+			{
+				if(split(mFreeRects[i], usedRect))
+				{
+					mFreeRects[i] = mFreeRects.back();
+					mFreeRects.pop_back();
+				}
+				else
+					i++;
+			}
+
+			// Rectangles created by the split are parts of removed rectangles, so they can't contain any of the remaining
+			// ones. Only they need to be checked for containment.
+			UINT32 numNewRects = (UINT32)mNewFreeRects.size();
+			for(UINT32 i = 0; i < numNewRects; i++)
+			{
+				const Rect& newRect = mNewFreeRects[i];
+
+				bool isContained = false;
+				for(auto& freeRect : mFreeRects)
+				{
+					if(freeRect.contains(newRect))
+					{
+						isContained = true;
+						break;
+					}
+				}
+
+				for(UINT32 j = 0; j < numNewRects && !isContained; j++)
+				{
+					if(i == j || !mNewFreeRects[j].contains(newRect))
+						continue;
+
+					// Keep only the first of identical rectangles
+					if(newRect.contains(mNewFreeRects[j]) && i < j)
+						continue;
+
+					isContained = true;
+				}
+
+				if(!isContained)
+					mFreeRects.push_back(newRect);
+			}
+
+			if(mHeuristic == TexAtlasHeuristic::ContactPoint)
+				mUsedRects.push_back(usedRect);
+		}
+
+		/** 
+		 * Splits the free rectangle into up to four maximal rectangles around the used area. Returns false if the areas
+		 * don't intersect.
+		 */
+		bool split(const Rect& freeRect, const Rect& usedRect)
+		{
+			if(usedRect.x >= freeRect.x + freeRect.width || usedRect.x + usedRect.width <= freeRect.x ||
+				usedRect.y >= freeRect.y + freeRect.height || usedRect.y + usedRect.height <= freeRect.y)
+			{
+				return false;
+			}
+
+			if(usedRect.x > freeRect.x)
+			{
+				Rect rect = freeRect;
+				rect.width = usedRect.x - freeRect.x;
+				mNewFreeRects.push_back(rect);
+			}
+
+			if(usedRect.x + usedRect.width < freeRect.x + freeRect.width)
+			{
+				Rect rect = freeRect;
+				rect.x = usedRect.x + usedRect.width;
+				rect.width = freeRect.x + freeRect.width - rect.x;
+				mNewFreeRects.push_back(rect);
+			}
+
+			if(usedRect.y > freeRect.y)
+			{
+				Rect rect = freeRect;
+				rect.height = usedRect.y - freeRect.y;
+				mNewFreeRects.push_back(rect);
+			}
+
+			if(usedRect.y + usedRect.height < freeRect.y + freeRect.height)
+			{
+				Rect rect = freeRect;
+				rect.y = usedRect.y + usedRect.height;
+				rect.height = freeRect.y + freeRect.height - rect.y;
+				mNewFreeRects.push_back(rect);
+			}
+
+			return true;
+		}
+
+		UINT32 mWidth, mHeight;
+		TexAtlasHeuristic mHeuristic;
+		Vector<Rect> mFreeRects;
+		Vector<Rect> mNewFreeRects;
+		Vector<Rect> mUsedRects;
+	};
+
+	/** 
+	 * Inserts the provided elements into a page using the specified packer. Elements that don't fit are output in
+	 * @p leftover.
+	 */
+	template<class T>
+	void fillPage(T& packer, Vector<TexAtlasElementDesc>& elements, const Vector<UINT32>& candidates, INT32 page, 
+		Vector<UINT32>& leftover)
+	{
+		for(auto& elementIdx : candidates)
+		{
+			TexAtlasElementDesc& element = elements[elementIdx];
+			if(packer.insert(element))
+				element.output.page = page;
+			else
+				leftover.push_back(elementIdx);
+		}
+	}
+
+	TexAtlasGenerator::TexAtlasGenerator(bool square, UINT32 maxTexWidth, UINT32 maxTexHeight, bool fixedSize,
+		TexAtlasPackMethod method, TexAtlasHeuristic heuristic)
+		:mSquare(square), mFixedSize(fixedSize), mMaxTexWidth(maxTexWidth), mMaxTexHeight(maxTexHeight), mMethod(method)
+		, mHeuristic(heuristic)
+	{
+		// Skyline only supports a single heuristic
+		assert(method != TexAtlasPackMethod::Skyline || heuristic == TexAtlasHeuristic::BottomLeft);
+
 		if(square)
 		{
 			if(maxTexWidth > maxTexHeight)
@@ -113,7 +585,7 @@ namespace BansheeEngine
 			elements[i].output.page = -1;
 
 		//sortBySize(elements);
-		int numPages = generatePagesForSize(elements, mMaxTexWidth, mMaxTexHeight);
+		int numPages = generatePages(elements, mMaxTexWidth, mMaxTexHeight);
 
 		if(numPages == -1)
 		{
@@ -131,54 +603,83 @@ namespace BansheeEngine
 		// If size isn't fixed, try to reduce the size of the last page
 		if(!mFixedSize)
 		{
-			while (true)
+			// Each candidate size halves the larger dimension of the previous one
+			Vector<std::pair<UINT32, UINT32>> candidateSizes;
+			UINT32 candidateWidth = lastPageWidth;
+			UINT32 candidateHeight = lastPageHeight;
+			while (candidateWidth > 1 && candidateHeight > 1)
 			{
-				if (lastPageWidth <= 1 || lastPageHeight <= 1)
-					break;
+				if (candidateWidth > candidateHeight)
+					candidateWidth /= 2;
+				else
+					candidateHeight /= 2;
 
-				int newLastPageWidth = lastPageWidth;
-				int newLastPageHeight = lastPageHeight;
+				candidateSizes.push_back(std::make_pair(candidateWidth, candidateHeight));
+			}
 
-				if(mSquare)
-				{
-					if (newLastPageWidth > newLastPageHeight)
-						newLastPageWidth /= 2;
-					else
-						newLastPageHeight /= 2;
-				}
-				else
+			// Candidates only differ in size, and each re-packs its own copy of the last page elements, so they can be
+			// packed independently
+			Vector<UINT32> lastPageElements;
+			Vector<TexAtlasElementDesc> lastPageTemplate;
+			for(UINT32 i = 0; i < (UINT32)elements.size(); i++)
+			{
+				if(elements[i].output.page >= lastPageIdx)
 				{
-					if (newLastPageWidth > newLastPageHeight)
-						newLastPageWidth /= 2;
-					else
-						newLastPageHeight /= 2;
+					lastPageElements.push_back(i);
+					lastPageTemplate.push_back(elements[i]);
+					lastPageTemplate.back().output.page = -1;
 				}
+			}
+
+			UINT32 numCandidates = (UINT32)candidateSizes.size();
+			Vector<Vector<TexAtlasElementDesc>> candidateElements(numCandidates);
+			Vector<int> candidateNumPages(numCandidates, 0);
 
-				// Clear page indexes so we know which pages to process
-				for(size_t i = 0; i < elements.size(); i++)
+			auto packCandidates = [&](UINT32 begin, UINT32 end)
+			{
+				for(UINT32 i = begin; i < end; i++)
 				{
-					if(elements[i].output.page >= lastPageIdx)
-						elements[i].output.page = -1;
+					candidateElements[i] = lastPageTemplate;
+					candidateNumPages[i] = generatePages(candidateElements[i], candidateSizes[i].first, 
+						candidateSizes[i].second, lastPageIdx);
 				}
+			};
 
-				if(generatePagesForSize(elements, newLastPageWidth, newLastPageHeight, lastPageIdx) == 1)
+			// A smaller candidate can only fit if all the larger ones did, so when packing sequentially stop at the 
+			// first failure
+			UINT32 numPackedCandidates = 0;
+			if(numCandidates > 1 && TaskScheduler::isStarted())
+			{
+				TaskScheduler::instance().parallelFor(0, numCandidates, 1, packCandidates);
+				numPackedCandidates = numCandidates;
+			}
+			else
+			{
+				for(; numPackedCandidates < numCandidates; numPackedCandidates++)
 				{
-					lastPageWidth = newLastPageWidth;
-					lastPageHeight = newLastPageHeight;
+					packCandidates(numPackedCandidates, numPackedCandidates + 1);
+					if(candidateNumPages[numPackedCandidates] != 1)
+						break;
 				}
-				else
-				{
-					// We're done but we need to re-do all the pages with the last valid size
-					for(size_t i = 0; i < elements.size(); i++)
-					{
-						if(elements[i].output.page >= lastPageIdx)
-							elements[i].output.page = -1;
-					}
-
-					generatePagesForSize(elements, lastPageWidth, lastPageHeight, lastPageIdx);
+			}
 
+			INT32 bestCandidate = -1;
+			for(UINT32 i = 0; i < numPackedCandidates; i++)
+			{
+				if(candidateNumPages[i] != 1)
 					break;
-				}
+
+				bestCandidate = (INT32)i;
+			}
+
+			if(bestCandidate != -1)
+			{
+				lastPageWidth = candidateSizes[bestCandidate].first;
+				lastPageHeight = candidateSizes[bestCandidate].second;
+
+				const Vector<TexAtlasElementDesc>& bestElements = candidateElements[bestCandidate];
+				for(UINT32 i = 0; i < (UINT32)lastPageElements.size(); i++)
+					elements[lastPageElements[i]].output = bestElements[i].output;
 			}
 		}
 
@@ -199,6 +700,7 @@ namespace BansheeEngine
 			TexAtlasPageDesc pageDesc;
 			pageDesc.width = mMaxTexWidth;
 			pageDesc.height = mMaxTexHeight;
+			pageDesc.occupancy = 0.0f;
 
 			pages.push_back(pageDesc);
 		}
@@ -206,12 +708,94 @@ namespace BansheeEngine
 		TexAtlasPageDesc lastPageDesc;
 		lastPageDesc.width = lastPageWidth;
 		lastPageDesc.height = lastPageHeight;
+		lastPageDesc.occupancy = 0.0f;
 
 		pages.push_back(lastPageDesc);
 
+		Vector<UINT64> usedArea(pages.size(), 0);
+		for(auto& element : elements)
+		{
+			if(element.output.page >= 0)
+				usedArea[element.output.page] += (UINT64)element.input.width * element.input.height;
+		}
+
+		for(UINT32 i = 0; i < (UINT32)pages.size(); i++)
+			pages[i].occupancy = usedArea[i] / (float)((UINT64)pages[i].width * pages[i].height);
+
 		return pages;
 	}
 
+	int TexAtlasGenerator::generatePages(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage) const
+	{
+		if(mMethod == TexAtlasPackMethod::BinaryTree)
+			return generatePagesForSize(elements, width, height, startPage);
+
+		return generatePagesPacked(elements, width, height, startPage);
+	}
+
+	int TexAtlasGenerator::generatePagesPacked(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage) const
+	{
+		// Elements without area are handled by the caller, same as with the binary tree
+		Vector<UINT32> remaining;
+		for(UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			const TexAtlasElementDesc& element = elements[i];
+			if(element.output.page != -1 || element.input.width * element.input.height == 0)
+				continue;
+
+			// If the texture is larger than the atlas size then it can never fit
+			if(element.input.width > width || element.input.height > height)
+				return -1;
+
+			remaining.push_back(i);
+		}
+
+		// Placing larger elements first yields tighter pages with both algorithms
+		std::sort(remaining.begin(), remaining.end(), 
+			[&](UINT32 lhs, UINT32 rhs)
+		{
+			const TexAtlasElementDesc& lhsElem = elements[lhs];
+			const TexAtlasElementDesc& rhsElem = elements[rhs];
+
+			UINT32 lhsSide = std::max(lhsElem.input.width, lhsElem.input.height);
+			UINT32 rhsSide = std::max(rhsElem.input.width, rhsElem.input.height);
+			if(lhsSide != rhsSide)
+				return lhsSide > rhsSide;
+
+			UINT32 lhsArea = lhsElem.input.width * lhsElem.input.height;
+			UINT32 rhsArea = rhsElem.input.width * rhsElem.input.height;
+			if(lhsArea != rhsArea)
+				return lhsArea > rhsArea;
+
+			return lhs < rhs;
+		});
+
+		// Each page receives the elements that didn't fit in the previous one
+		int numPages = 0;
+		Vector<UINT32> leftover;
+		while(!remaining.empty())
+		{
+			INT32 page = (INT32)(startPage + numPages);
+			if(mMethod == TexAtlasPackMethod::Skyline)
+			{
+				TexAtlasSkyline skyline(width, height);
+				fillPage(skyline, elements, remaining, page, leftover);
+			}
+			else
+			{
+				TexAtlasMaxRects maxRects(width, height, mHeuristic);
+				fillPage(maxRects, elements, remaining, page, leftover);
+			}
+
+			std::swap(remaining, leftover);
+			leftover.clear();
+
+			numPages++;
+		}
+
+		return numPages;
+	}
+
 	int TexAtlasGenerator::generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage) const
 	{
 		if(elements.size() == 0)
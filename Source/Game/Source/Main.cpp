@@ -8,6 +8,7 @@
 #include "BsFileSystem.h"
 #include "BsResources.h"
 #include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
 #include "BsPrefab.h"
 #include "BsSceneObject.h"
 #include "BsSceneManager.h"
@@ -140,6 +141,12 @@ void runApplication()
 		gResources().registerResourceManifest(manifest);
 	}
 
+	Path resourcePackagePath = resourcesPath + GAME_RESOURCE_PACKAGE_NAME;
+
+	SPtr<ResourcePackage> resourcePackage = ResourcePackage::load(resourcePackagePath);
+	if (resourcePackage != nullptr)
+		gResources().registerResourcePackage(resourcePackage);
+
 	{
 		HPrefab mainScene = static_resource_cast<Prefab>(gResources().loadFromUUID(gameSettings->mainSceneUUID, 
 			false, ResourceLoadFlag::LoadDependencies));
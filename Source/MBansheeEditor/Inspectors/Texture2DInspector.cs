@@ -18,6 +18,9 @@ namespace BansheeEditor
         private GUIEnumField formatField = new GUIEnumField(typeof(PixelFormat), new LocEdString("Format"));
         private GUIToggleField generateMipsField = new GUIToggleField(new LocEdString("Generate mipmaps"));
         private GUIIntField maximumMipsField = new GUIIntField(new LocEdString("Maximum mipmap level"));
+        private GUIEnumField mipFilterField = new GUIEnumField(typeof(MipMapFilter), new LocEdString("Mipmap filter"));
+        private GUIToggleField alphaCoverageField = new GUIToggleField(new LocEdString("Preserve alpha coverage"));
+        private GUIFloatField alphaCutoffField = new GUIFloatField(new LocEdString("Alpha coverage cutoff"));
         private GUIToggleField srgbField = new GUIToggleField(new LocEdString("Gamma space"));
         private GUIToggleField cpuReadableField = new GUIToggleField(new LocEdString("CPU readable"));
         private GUIButton reimportButton = new GUIButton(new LocEdString("Reimport"));
@@ -34,6 +37,9 @@ namespace BansheeEditor
                 formatField.OnSelectionChanged += x => importOptions.Format = (PixelFormat)x;
                 generateMipsField.OnChanged += x => importOptions.GenerateMipmaps = x;
                 maximumMipsField.OnChanged += x => importOptions.MaxMipmapLevel = x;
+                mipFilterField.OnSelectionChanged += x => importOptions.MipmapFilter = (MipMapFilter)x;
+                alphaCoverageField.OnChanged += x => importOptions.PreserveAlphaCoverage = x;
+                alphaCutoffField.OnChanged += x => importOptions.AlphaCoverageCutoff = x;
                 srgbField.OnChanged += x => importOptions.IsSRGB = x;
                 cpuReadableField.OnChanged += x => importOptions.CPUReadable = x;
 
@@ -42,6 +48,9 @@ namespace BansheeEditor
                 Layout.AddElement(formatField);
                 Layout.AddElement(generateMipsField);
                 Layout.AddElement(maximumMipsField);
+                Layout.AddElement(mipFilterField);
+                Layout.AddElement(alphaCoverageField);
+                Layout.AddElement(alphaCutoffField);
                 Layout.AddElement(srgbField);
                 Layout.AddElement(cpuReadableField);
                 Layout.AddSpace(10);
@@ -60,6 +69,9 @@ namespace BansheeEditor
             formatField.Value = (ulong)newImportOptions.Format;
             generateMipsField.Value = newImportOptions.GenerateMipmaps;
             maximumMipsField.Value = newImportOptions.MaxMipmapLevel;
+            mipFilterField.Value = (ulong)newImportOptions.MipmapFilter;
+            alphaCoverageField.Value = newImportOptions.PreserveAlphaCoverage;
+            alphaCutoffField.Value = newImportOptions.AlphaCoverageCutoff;
             srgbField.Value = newImportOptions.IsSRGB;
             cpuReadableField.Value = newImportOptions.CPUReadable;
 
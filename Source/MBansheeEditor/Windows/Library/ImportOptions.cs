@@ -77,6 +77,34 @@ namespace BansheeEditor
             set { Internal_SetIsSRGB(mCachedPtr, value); }
         }
 
+        /// <summary>
+        /// Filter to use when downsampling the texture into mipmaps.
+        /// </summary>
+        public MipMapFilter MipmapFilter
+        {
+            get { return Internal_GetMipmapFilter(mCachedPtr); }
+            set { Internal_SetMipmapFilter(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Determines should mipmap alpha be scaled so that the fraction of pixels passing the alpha test stays the same
+        /// as in the full size texture. Prevents alpha tested geometry (e.g. foliage) from thinning out in the distance.
+        /// </summary>
+        public bool PreserveAlphaCoverage
+        {
+            get { return Internal_GetPreserveAlphaCoverage(mCachedPtr); }
+            set { Internal_SetPreserveAlphaCoverage(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Alpha test reference value used when preserving alpha coverage.
+        /// </summary>
+        public float AlphaCoverageCutoff
+        {
+            get { return Internal_GetAlphaCoverageCutoff(mCachedPtr); }
+            set { Internal_SetAlphaCoverageCutoff(mCachedPtr, value); }
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_CreateInstance(TextureImportOptions instance);
 
@@ -109,6 +137,24 @@ namespace BansheeEditor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetIsSRGB(IntPtr thisPtr, bool value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern MipMapFilter Internal_GetMipmapFilter(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetMipmapFilter(IntPtr thisPtr, MipMapFilter value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetPreserveAlphaCoverage(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetPreserveAlphaCoverage(IntPtr thisPtr, bool value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetAlphaCoverageCutoff(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetAlphaCoverageCutoff(IntPtr thisPtr, float value);
     }
 
     /// <summary>
@@ -121,7 +121,8 @@ namespace BansheeEngine
         /// the base level.
         /// </summary>
         /// <param name="source">Pixels to generate mip-maps for.</param>
-        /// <param name="options">Options controlling mip-map generation.</param>
+        /// <param name="options">Options controlling mip-map generation. See <see cref="MipMapGenOptions.CreateDefault"/>
+        ///                       for the default options.</param>
         /// <returns>A list of calculated mip-map data. First entry is the largest mip and other follow in order from 
         ///          largest to smallest.</returns>
 		public static PixelData[] GenerateMipmaps(PixelData source, MipMapGenOptions options)
@@ -197,7 +198,16 @@ namespace BansheeEngine
         /// <summary>
         /// Box filter is applied, averaging nearby pixels.
         /// </summary>
-        Linear
+        Linear,
+        /// <summary>
+        /// Kaiser windowed sinc filter is applied. Sharper than the box filter. Only supports 2D images.
+        /// </summary>
+        Kaiser,
+        /// <summary>
+        /// Lanczos filter with a three pixel window is applied. Sharpest, but may introduce ringing. Only supports 2D 
+        /// images.
+        /// </summary>
+        Lanczos
     };
 
     /// <summary>
@@ -247,7 +257,8 @@ namespace BansheeEngine
 	{
 		Box,
 		Triangle,
-		Kaiser
+		Kaiser,
+		Lanczos
 	};
 
     /// <summary>
@@ -307,6 +318,36 @@ namespace BansheeEngine
         /// Should the downsampled values be re-normalized. Only relevant for mip-maps representing normal maps.
         /// </summary>
 		public bool normalizeMipmaps;
+
+        /// <summary>
+        /// Determines has the input data been gamma corrected. If true, filtering is performed in linear space.
+        /// </summary>
+		public bool isSRGB;
+
+        /// <summary>
+        /// Should alpha of each mip level be scaled so the fraction of pixels with alpha above 
+        /// <see cref="alphaCoverageCutoff"/> stays the same as in the base level. Useful for alpha tested textures.
+        /// </summary>
+		public bool preserveAlphaCoverage;
+
+        /// <summary>
+        /// Alpha value used as the alpha test reference when preserving alpha coverage.
+        /// </summary>
+		public float alphaCoverageCutoff;
+
+        /// <summary>
+        /// Creates a new instance of mip map generation options with the same default values as used by the engine.
+        /// </summary>
+        /// <returns>New instance of mip map generation options.</returns>
+        public static MipMapGenOptions CreateDefault()
+        {
+            MipMapGenOptions output = new MipMapGenOptions();
+            output.filter = MipMapFilter.Box;
+            output.wrapMode = MipMapWrapMode.Mirror;
+            output.alphaCoverageCutoff = 0.5f;
+
+            return output;
+        }
 	};
 
     /** @} */
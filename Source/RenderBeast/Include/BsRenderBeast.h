@@ -5,6 +5,9 @@
 #include "BsRenderBeastPrerequisites.h"
 #include "BsRenderer.h"
 #include "BsBounds.h"
+#include "BsBoundsArray.h"
+#include "BsConvexVolume.h"
+#include "BsRenderQueue.h"
 #include "BsRenderableElement.h"
 #include "BsSamplerOverrides.h"
 #include "BsRendererMaterial.h"
@@ -93,6 +96,13 @@ namespace BansheeEngine
 			Vector<const CameraCore*> cameras;
 		};
 
+		/** Render queues populated by a single visibility task, before they are merged into the camera's queues. */
+		struct VisibilityChunk
+		{
+			RenderQueue opaqueQueue;
+			RenderQueue transparentQueue;
+		};
+
 		/**	Data used by the renderer for a camera. */
 		struct CameraData
 		{
@@ -101,6 +111,10 @@ namespace BansheeEngine
 
 			SPtr<RenderTargets> target;
 			PostProcessInfo postProcessInfo;
+
+			ConvexVolume worldFrustum;
+			Vector<UINT32> visibility;
+			Vector<VisibilityChunk> chunks;
 		};
 
 		/**	Data used by the renderer for lights. */
@@ -192,6 +206,30 @@ namespace BansheeEngine
 		 */
 		void determineVisible(const CameraCore& camera);
 
+		/**
+		 * Populates render queues of all cameras by determining visible renderable objects. Work is split per camera and
+		 * per group of renderables, and executed in parallel on the TaskScheduler. Results are identical to calling
+		 * determineVisible() for each camera.
+		 */
+		void determineVisibleParallel();
+
+		/**
+		 * Tests a range of renderables for visibility and adds elements of the visible ones to the provided queues.
+		 *
+		 * @param[in]	camera				Camera to determine visibility for.
+		 * @param[in]	worldFrustum		World space frustum of @p camera.
+		 * @param[out]	visibility			Bitmask that will receive a bit per tested renderable, set if it is visible. 
+		 *									Bit 0 corresponds to the renderable at @p start.
+		 * @param[in]	start				Index of the first renderable to test. Must be a multiple of 32.
+		 * @param[in]	count				Number of renderables to test.
+		 * @param[in]	opaqueQueue			Queue to add visible opaque elements to.
+		 * @param[in]	transparentQueue	Queue to add visible transparent elements to.
+		 *
+		 * @note	Thread safe as long as multiple callers use different queues and non-overlapping visibility ranges.
+		 */
+		void queueVisible(const CameraCore& camera, const ConvexVolume& worldFrustum, UINT32* visibility, UINT32 start, 
+			UINT32 count, RenderQueue& opaqueQueue, RenderQueue& transparentQueue);
+
 		/**
 		 * Renders all objects visible by the provided camera.
 		 *
@@ -274,6 +312,7 @@ namespace BansheeEngine
 		Vector<RenderableData> mRenderables;
 		Vector<RenderableShaderData> mRenderableShaderData;
 		Vector<Bounds> mWorldBounds;
+		BoundsArray mCullBounds;
 
 		Vector<LightData> mDirectionalLights;
 		Vector<LightData> mPointLights;
@@ -39,6 +39,12 @@ namespace BansheeEngine
 		 * changes. Sorting by material can reduce CPU usage but could increase overdraw.
 		 */
 		StateReduction stateReductionMode = StateReduction::Distance;
+
+		/**
+		 * If true, visibility determination and render queue generation for all cameras will be split into tasks and
+		 * executed in parallel on the TaskScheduler. Otherwise all cameras are processed sequentially on the core thread.
+		 */
+		bool parallelVisibility = false;
 	};
 
 	/** @} */
@@ -30,6 +30,7 @@
 #include "BsRenderTargets.h"
 #include "BsRendererUtility.h"
 #include "BsRenderStateManager.h"
+#include "BsTaskScheduler.h"
 
 using namespace std::placeholders;
 
@@ -87,6 +88,8 @@ namespace BansheeEngine
 		mRenderTargets.clear();
 		mCameraData.clear();
 		mRenderables.clear();
+		mWorldBounds.clear();
+		mCullBounds.clear();
 
 		PostProcessing::shutDown();
 		RenderTexturePool::shutDown();
@@ -110,6 +113,7 @@ namespace BansheeEngine
 		mRenderables.push_back(RenderableData());
 		mRenderableShaderData.push_back(RenderableShaderData());
 		mWorldBounds.push_back(renderable->getBounds());
+		mCullBounds.add(renderable->getBounds());
 
 		RenderableData& renderableData = mRenderables.back();
 		renderableData.renderable = renderable;
@@ -226,6 +230,7 @@ namespace BansheeEngine
 			// Swap current last element with the one we want to erase
 			std::swap(mRenderables[renderableId], mRenderables[lastRenderableId]);
 			std::swap(mWorldBounds[renderableId], mWorldBounds[lastRenderableId]);
+			mCullBounds.swap(renderableId, lastRenderableId);
 			std::swap(mRenderableShaderData[renderableId], mRenderableShaderData[lastRenderableId]);
 
 			lastRenerable->setRendererId(renderableId);
@@ -237,6 +242,7 @@ namespace BansheeEngine
 		// Last element is the one we want to erase
 		mRenderables.erase(mRenderables.end() - 1);
 		mWorldBounds.erase(mWorldBounds.end() - 1);
+		mCullBounds.removeLast();
 		mRenderableShaderData.erase(mRenderableShaderData.end() - 1);
 	}
 
@@ -252,6 +258,7 @@ namespace BansheeEngine
 		shaderData.worldDeterminantSign = shaderData.worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
 
 		mWorldBounds[renderableId] = renderable->getBounds();
+		mCullBounds.set(renderableId, mWorldBounds[renderableId]);
 	}
 
 	void RenderBeast::notifyLightAdded(LightCore* light)
@@ -498,10 +505,15 @@ namespace BansheeEngine
 		mStaticHandler->updatePerFrameBuffers(time);
 
 		// Generate render queues per camera
-		for (auto& cameraData : mCameraData)
+		if (mCoreOptions->parallelVisibility)
+			determineVisibleParallel();
+		else
 		{
-			const CameraCore* camera = cameraData.first;
-			determineVisible(*camera);
+			for (auto& cameraData : mCameraData)
+			{
+				const CameraCore* camera = cameraData.first;
+				determineVisible(*camera);
+			}
 		}
 
 		// Render everything, target by target
@@ -822,48 +834,141 @@ namespace BansheeEngine
 			return;
 
 		CameraData& cameraData = mCameraData[&camera];
-
-		UINT64 cameraLayers = camera.getLayers();
 		ConvexVolume worldFrustum = camera.getWorldFrustum();
 
-		// Update per-object param buffers and queue render elements
-		for (auto& renderableData : mRenderables)
-		{
-			RenderableCore* renderable = renderableData.renderable;
-			UINT32 rendererId = renderable->getRendererId();
+		UINT32 numRenderables = (UINT32)mRenderables.size();
+		cameraData.visibility.resize((numRenderables + 31) / 32);
 
-			if ((renderable->getLayer() & cameraLayers) == 0)
+		queueVisible(camera, worldFrustum, cameraData.visibility.data(), 0, numRenderables, *cameraData.opaqueQueue, 
+			*cameraData.transparentQueue);
+
+		cameraData.opaqueQueue->sort();
+		cameraData.transparentQueue->sort();
+	}
+
+	void RenderBeast::determineVisibleParallel()
+	{
+		// Amount of renderables processed by a single task. Must be a multiple of 32 so each task writes to its own
+		// portion of the visibility mask.
+		static const UINT32 CHUNK_SIZE = 2048;
+
+		UINT32 numRenderables = (UINT32)mRenderables.size();
+		UINT32 numChunks = (numRenderables + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+		// Prepare per-camera data up front, so that tasks only read shared state
+		Vector<std::pair<const CameraCore*, CameraData*>> cameras;
+		for (auto& entry : mCameraData)
+		{
+			const CameraCore* camera = entry.first;
+			if (camera->getFlags().isSet(CameraFlag::Overlay))
 				continue;
 
-			// Do frustum culling
-			// TODO - This is bound to be a bottleneck at some point. When it is ensure that intersect
-			// methods use vector operations, as it is trivial to update them.
-			const Sphere& boundingSphere = mWorldBounds[rendererId].getSphere();
-			if (worldFrustum.intersects(boundingSphere))
+			CameraData& cameraData = entry.second;
+			cameraData.worldFrustum = camera->getWorldFrustum();
+			cameraData.visibility.resize((numRenderables + 31) / 32);
+			cameraData.chunks.resize(numChunks);
+
+			cameras.push_back(std::make_pair(camera, &cameraData));
+		}
+
+		// Cull and queue each group of renderables for each camera into its own set of queues
+		Vector<SPtr<Task>> tasks;
+		for (auto& entry : cameras)
+		{
+			const CameraCore* camera = entry.first;
+			CameraData* cameraData = entry.second;
+
+			for (UINT32 i = 0; i < numChunks; i++)
 			{
-				// More precise with the box
-				const AABox& boundingBox = mWorldBounds[rendererId].getBox();
+				UINT32 start = i * CHUNK_SIZE;
+				UINT32 count = std::min(CHUNK_SIZE, numRenderables - start);
 
-				if (worldFrustum.intersects(boundingBox))
+				auto worker = [this, camera, cameraData, start, count, i]()
 				{
-					float distanceToCamera = (camera.getPosition() - boundingBox.getCenter()).length();
+					VisibilityChunk& chunk = cameraData->chunks[i];
+					chunk.opaqueQueue.clear();
+					chunk.transparentQueue.clear();
 
-					for (auto& renderElem : renderableData.elements)
-					{
-						bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+					queueVisible(*camera, cameraData->worldFrustum, cameraData->visibility.data() + start / 32, start, count,
+						chunk.opaqueQueue, chunk.transparentQueue);
+				};
 
-						if (isTransparent)
-							cameraData.transparentQueue->add(&renderElem, distanceToCamera);
-						else
-							cameraData.opaqueQueue->add(&renderElem, distanceToCamera);
-					}
+				SPtr<Task> task = Task::create("DetermineVisible", worker, TaskPriority::High);
+				TaskScheduler::instance().addTask(task);
 
-				}
+				tasks.push_back(task);
 			}
 		}
 
-		cameraData.opaqueQueue->sort();
-		cameraData.transparentQueue->sort();
+		for (auto& task : tasks)
+			task->wait();
+
+		tasks.clear();
+
+		// Merge the per-group queues in order, so the result is the same as when processed sequentially, then sort
+		for (auto& entry : cameras)
+		{
+			CameraData* cameraData = entry.second;
+
+			auto worker = [cameraData]()
+			{
+				for (auto& chunk : cameraData->chunks)
+				{
+					cameraData->opaqueQueue->add(chunk.opaqueQueue);
+					cameraData->transparentQueue->add(chunk.transparentQueue);
+				}
+
+				cameraData->opaqueQueue->sort();
+				cameraData->transparentQueue->sort();
+			};
+
+			SPtr<Task> task = Task::create("SortRenderQueues", worker, TaskPriority::High);
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
+	void RenderBeast::queueVisible(const CameraCore& camera, const ConvexVolume& worldFrustum, UINT32* visibility,
+		UINT32 start, UINT32 count, RenderQueue& opaqueQueue, RenderQueue& transparentQueue)
+	{
+		if (count == 0)
+			return;
+
+		// Do frustum culling, all renderables at once
+		worldFrustum.intersects(mCullBounds, start, count, visibility);
+
+		// Queue render elements
+		UINT64 cameraLayers = camera.getLayers();
+		Vector3 cameraPosition = camera.getPosition();
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			if ((visibility[i / 32] & (1U << (i % 32))) == 0)
+				continue;
+
+			RenderableData& renderableData = mRenderables[start + i];
+			RenderableCore* renderable = renderableData.renderable;
+
+			if ((renderable->getLayer() & cameraLayers) == 0)
+				continue;
+
+			const AABox& boundingBox = mWorldBounds[start + i].getBox();
+			float distanceToCamera = (cameraPosition - boundingBox.getCenter()).length();
+
+			for (auto& renderElem : renderableData.elements)
+			{
+				bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+
+				if (isTransparent)
+					transparentQueue.add(&renderElem, distanceToCamera);
+				else
+					opaqueQueue.add(&renderElem, distanceToCamera);
+			}
+		}
 	}
 
 	Vector2 RenderBeast::getDeviceZTransform(const Matrix4& projMatrix)
@@ -5,6 +5,7 @@
 #include "BsScriptEditorPrerequisites.h"
 #include "BsScriptObject.h"
 #include "BsPixelData.h"
+#include "BsPixelUtil.h"
 #include "BsAudioClipImportOptions.h"
 #include "BsGpuProgram.h"
 
@@ -75,6 +76,12 @@ namespace BansheeEngine
 		static void internal_SetCPUReadable(ScriptTextureImportOptions* thisPtr, bool value);
 		static bool internal_GetIsSRGB(ScriptTextureImportOptions* thisPtr);
 		static void internal_SetIsSRGB(ScriptTextureImportOptions* thisPtr, bool value);
+		static MipMapFilter internal_GetMipmapFilter(ScriptTextureImportOptions* thisPtr);
+		static void internal_SetMipmapFilter(ScriptTextureImportOptions* thisPtr, MipMapFilter value);
+		static bool internal_GetPreserveAlphaCoverage(ScriptTextureImportOptions* thisPtr);
+		static void internal_SetPreserveAlphaCoverage(ScriptTextureImportOptions* thisPtr, bool value);
+		static float internal_GetAlphaCoverageCutoff(ScriptTextureImportOptions* thisPtr);
+		static void internal_SetAlphaCoverageCutoff(ScriptTextureImportOptions* thisPtr, float value);
 	};
 
 	/**	Interop class between C++ & CLR for MeshImportOptions. */
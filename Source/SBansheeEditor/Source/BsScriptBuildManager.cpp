@@ -302,6 +302,9 @@ namespace BansheeEngine
 
 		FileSystem::createDir(outputPath);
 
+		Vector<RESOURCE_PACKAGE_ENTRY_DESC> packagedResources;
+		Vector<Path> temporaryFiles;
+
 		Path libraryDir = gProjectLibrary().getResourcesFolder();
 		for (auto& entry : usedResources)
 		{
@@ -316,9 +319,6 @@ namespace BansheeEngine
 			SPtr<ProjectResourceMeta> resMeta = gProjectLibrary().findResourceMeta(sourcePath);
 			assert(resMeta != nullptr);
 
-			Path destPath = outputPath;
-			destPath.setFilename(entry.getFilename());
-
 			// Create library -> packaged resource mapping
 			Path relSourcePath = sourcePath;
 			if (sourcePath.isAbsolute())
@@ -329,6 +329,9 @@ namespace BansheeEngine
 
 			resourceMap->add(relSourcePath, relDestPath);
 
+			// Resources are only written into the package, so by default the library file is packed as is
+			Path packedPath = entry;
+
 			// If resource is prefab make sure to update it in case any of the prefabs it is referencing changed
 			if (resMeta->getTypeID() == TID_Prefab)
 			{
@@ -339,7 +342,7 @@ namespace BansheeEngine
 
 				// Clear prefab diffs as they're not used in standalone
 				Stack<HSceneObject> todo;
-				todo.push(prefab->_getRoot());
+				todo.push(prefab->_editRoot());
 
 				while (!todo.empty())
 				{
@@ -356,7 +359,10 @@ namespace BansheeEngine
 					}
 				}
 
-				gResources().save(prefab, destPath, false);
+				packedPath = Path::combine(FileSystem::getTempDirectoryPath(), entry.getFilename());
+				temporaryFiles.push_back(packedPath);
+
+				gResources().save(prefab, packedPath, true);
 
 				// Need to unload this one as we modified it in memory, and we don't want to persist those changes past
 				// this point
@@ -365,10 +371,21 @@ namespace BansheeEngine
 				if (reload)
 					gProjectLibrary().load(sourcePath);
 			}
-			else
-				FileSystem::copy(entry, destPath);
+
+			RESOURCE_PACKAGE_ENTRY_DESC packageEntry;
+			packageEntry.uuid = uuid;
+			packageEntry.filePath = packedPath;
+
+			packagedResources.push_back(packageEntry);
 		}
 
+		// Pack all resources in a single file, so the game can load them without opening each file individually. Loads
+		// by path are resolved to a UUID through the manifest, and then to the package entry.
+		BuildManager::instance().packageResources(packagedResources, outputPath);
+
+		for (auto& entry : temporaryFiles)
+			FileSystem::remove(entry);
+
 		// Save icon
 		Path iconFolder = FileSystem::getWorkingDirectoryPath();
 		iconFolder.append(BuiltinResources::getIconFolder());
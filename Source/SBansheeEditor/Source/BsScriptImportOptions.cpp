@@ -80,6 +80,12 @@ namespace BansheeEngine
 		metaData.scriptClass->addInternalCall("Internal_SetCPUReadable", &ScriptTextureImportOptions::internal_SetCPUReadable);
 		metaData.scriptClass->addInternalCall("Internal_GetIsSRGB", &ScriptTextureImportOptions::internal_GetIsSRGB);
 		metaData.scriptClass->addInternalCall("Internal_SetIsSRGB", &ScriptTextureImportOptions::internal_SetIsSRGB);
+		metaData.scriptClass->addInternalCall("Internal_GetMipmapFilter", &ScriptTextureImportOptions::internal_GetMipmapFilter);
+		metaData.scriptClass->addInternalCall("Internal_SetMipmapFilter", &ScriptTextureImportOptions::internal_SetMipmapFilter);
+		metaData.scriptClass->addInternalCall("Internal_GetPreserveAlphaCoverage", &ScriptTextureImportOptions::internal_GetPreserveAlphaCoverage);
+		metaData.scriptClass->addInternalCall("Internal_SetPreserveAlphaCoverage", &ScriptTextureImportOptions::internal_SetPreserveAlphaCoverage);
+		metaData.scriptClass->addInternalCall("Internal_GetAlphaCoverageCutoff", &ScriptTextureImportOptions::internal_GetAlphaCoverageCutoff);
+		metaData.scriptClass->addInternalCall("Internal_SetAlphaCoverageCutoff", &ScriptTextureImportOptions::internal_SetAlphaCoverageCutoff);
 	}
 
 	SPtr<TextureImportOptions> ScriptTextureImportOptions::getTexImportOptions()
@@ -156,6 +162,36 @@ namespace BansheeEngine
 		thisPtr->getTexImportOptions()->setSRGB(value);
 	}
 
+	MipMapFilter ScriptTextureImportOptions::internal_GetMipmapFilter(ScriptTextureImportOptions* thisPtr)
+	{
+		return thisPtr->getTexImportOptions()->getMipmapFilter();
+	}
+
+	void ScriptTextureImportOptions::internal_SetMipmapFilter(ScriptTextureImportOptions* thisPtr, MipMapFilter value)
+	{
+		thisPtr->getTexImportOptions()->setMipmapFilter(value);
+	}
+
+	bool ScriptTextureImportOptions::internal_GetPreserveAlphaCoverage(ScriptTextureImportOptions* thisPtr)
+	{
+		return thisPtr->getTexImportOptions()->getPreserveAlphaCoverage();
+	}
+
+	void ScriptTextureImportOptions::internal_SetPreserveAlphaCoverage(ScriptTextureImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getTexImportOptions()->setPreserveAlphaCoverage(value);
+	}
+
+	float ScriptTextureImportOptions::internal_GetAlphaCoverageCutoff(ScriptTextureImportOptions* thisPtr)
+	{
+		return thisPtr->getTexImportOptions()->getAlphaCoverageCutoff();
+	}
+
+	void ScriptTextureImportOptions::internal_SetAlphaCoverageCutoff(ScriptTextureImportOptions* thisPtr, float value)
+	{
+		thisPtr->getTexImportOptions()->setAlphaCoverageCutoff(value);
+	}
+
 	ScriptMeshImportOptions::ScriptMeshImportOptions(MonoObject* instance)
 		:ScriptObject(instance)
 	{